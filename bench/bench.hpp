@@ -0,0 +1,159 @@
+#ifndef BOOST_FLAGS_BENCH_HPP_INCLUDED
+#define BOOST_FLAGS_BENCH_HPP_INCLUDED
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// minimal benchmark harness: each benchmark compares a kernel using Boost.Flags with the
+// equivalent hand-written kernel on the underlying integers, results are written as JSON
+//
+// command line: <benchmark> [--out=<file>] [--repetitions=<n>]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+# define BENCH_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+# define BENCH_NOINLINE __declspec(noinline)
+#else
+# define BENCH_NOINLINE
+#endif
+
+#define BENCH_STRINGIZE_IMPL(x) #x
+#define BENCH_STRINGIZE(x) BENCH_STRINGIZE_IMPL(x)
+
+namespace bench {
+
+    // prevents the compiler from optimizing away `value`
+    template<typename T>
+    inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile char sink;
+        sink = *reinterpret_cast<char const volatile*>(&value);
+#endif
+    }
+
+    // forces all pending writes to memory
+    inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+    struct result {
+        std::string name;
+        double flags_ns;    // per element
+        double raw_ns;      // per element
+    };
+
+    struct options {
+        std::string out;
+        int repetitions = 15;
+    };
+
+    inline options parse_options(int argc, char** argv) {
+        options opts;
+        for (int i = 1; i < argc; ++i) {
+            if (std::strncmp(argv[i], "--out=", 6) == 0) {
+                opts.out = argv[i] + 6;
+            } else if (std::strncmp(argv[i], "--repetitions=", 14) == 0) {
+                opts.repetitions = std::max(1, std::atoi(argv[i] + 14));
+            } else {
+                std::fprintf(stderr, "usage: %s [--out=<file>] [--repetitions=<n>]\n", argv[0]);
+                std::exit(1);
+            }
+        }
+        return opts;
+    }
+
+    // minimal time per element (in ns) of `repetitions` runs of `kernel`, which processes `elements` elements
+    template<typename Kernel>
+    double measure(options const& opts, std::size_t elements, Kernel&& kernel) {
+        using clock = std::chrono::steady_clock;
+        kernel(); // warm-up
+        double best = 1e300;
+        for (int r = 0; r < opts.repetitions; ++r) {
+            auto const start = clock::now();
+            kernel();
+            clobber_memory();
+            auto const stop = clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(elements));
+        }
+        return best;
+    }
+
+    inline std::string compiler() {
+#if defined(__clang__)
+        return "clang " __clang_version__;
+#elif defined(__GNUC__)
+        return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+        return "msvc " + std::to_string(_MSC_FULL_VER);
+#else
+        return "unknown";
+#endif
+    }
+
+    // optimization and Boost.Flags configuration of the benchmark
+    // the build scripts pass the optimization level as BENCH_OPTIMIZATION (e.g. O2, O0, Og),
+    // the fallback cannot distinguish the levels (e.g. gcc defines __OPTIMIZE__ also for -Og)
+    inline std::string configuration() {
+#if defined(BENCH_OPTIMIZATION)
+        std::string config = "optimization " BENCH_STRINGIZE(BENCH_OPTIMIZATION);
+#elif defined(__OPTIMIZE__) || (defined(_MSC_VER) && !defined(_DEBUG))
+        std::string config = "optimized";
+#else
+        std::string config = "unoptimized";
+#endif
+#if defined(BOOST_FLAGS_DEBUG_INLINE)
+        config += ", BOOST_FLAGS_DEBUG_INLINE";
+#endif
+        return config;
+    }
+
+    inline std::string escape(std::string const& s) {
+        std::string result;
+        for (char c : s) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result;
+    }
+
+    inline void write_json(options const& opts, char const* suite, std::vector<result> const& results) {
+        std::FILE* out = opts.out.empty() ? stdout : std::fopen(opts.out.c_str(), "w");
+        if (!out) {
+            std::fprintf(stderr, "cannot open %s\n", opts.out.c_str());
+            std::exit(1);
+        }
+        std::fprintf(out, "{\n  \"suite\": \"%s\",\n  \"compiler\": \"%s\",\n  \"configuration\": \"%s\",\n  \"cplusplus\": %ld,\n  \"repetitions\": %d,\n  \"results\": [\n",
+            suite, escape(compiler()).c_str(), configuration().c_str(), static_cast<long>(__cplusplus), opts.repetitions);
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            auto const& r = results[i];
+            std::fprintf(out, "    { \"name\": \"%s\", \"flags_ns\": %.4f, \"raw_ns\": %.4f, \"ratio\": %.3f }%s\n",
+                r.name.c_str(), r.flags_ns, r.raw_ns, r.raw_ns > 0 ? r.flags_ns / r.raw_ns : 0.0,
+                i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(out, "  ]\n}\n");
+        if (out != stdout) {
+            std::fclose(out);
+        }
+    }
+
+} // namespace bench
+
+#endif // BOOST_FLAGS_BENCH_HPP_INCLUDED
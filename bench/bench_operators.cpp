@@ -0,0 +1,155 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// the operators of Boost.Flags versus the same operations on the underlying integers
+
+#include <boost/flags.hpp>
+
+#include "bench.hpp"
+
+#include <cstdint>
+#include <vector>
+
+
+enum class flags_enum : std::uint32_t {
+    bit_0 = boost::flags::nth_bit(0),
+    bit_1 = boost::flags::nth_bit(1),
+    bit_2 = boost::flags::nth_bit(2),
+    bit_3 = boost::flags::nth_bit(3),
+};
+
+// enable flags_enum (with pre-increment for the bool conversion)
+BOOST_FLAGS_ENABLE_PRE_INCREMENT(flags_enum)
+
+using raw = std::uint32_t;
+
+constexpr std::size_t elements = 1 << 14;
+constexpr int rounds = 16;
+
+
+// binary or
+BENCH_NOINLINE void flags_or(flags_enum const* a, flags_enum const* b, flags_enum* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] | b[i];
+}
+BENCH_NOINLINE void raw_or(raw const* a, raw const* b, raw* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] | b[i];
+}
+
+// binary and
+BENCH_NOINLINE void flags_and(flags_enum const* a, flags_enum const* b, flags_enum* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] & b[i];
+}
+BENCH_NOINLINE void raw_and(raw const* a, raw const* b, raw* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] & b[i];
+}
+
+// complement (applied as mask, as complement<E> is not a flags_enum)
+BENCH_NOINLINE void flags_not(flags_enum const* a, flags_enum const* b, flags_enum* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] & ~b[i];
+}
+BENCH_NOINLINE void raw_not(raw const* a, raw const* b, raw* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) out[i] = a[i] & ~b[i];
+}
+
+// BOOST_FLAGS_AND: test for common bits
+BENCH_NOINLINE std::size_t flags_pseudo_and(flags_enum const* a, flags_enum const* b, std::size_t n) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += (a[i] BOOST_FLAGS_AND b[i]) ? 1 : 0;
+    return count;
+}
+BENCH_NOINLINE std::size_t raw_pseudo_and(raw const* a, raw const* b, std::size_t n) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += (a[i] & b[i]) != 0 ? 1 : 0;
+    return count;
+}
+
+// modify_inplace
+BENCH_NOINLINE void flags_modify_inplace(flags_enum* values, flags_enum const* mod, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) boost::flags::modify_inplace(values[i], mod[i], (i & 1) != 0);
+}
+BENCH_NOINLINE void raw_modify_inplace(raw* values, raw const* mod, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) values[i] = (i & 1) != 0 ? (values[i] | mod[i]) : (values[i] & ~mod[i]);
+}
+
+// subseteq
+BENCH_NOINLINE std::size_t flags_subseteq(flags_enum const* a, flags_enum const* b, std::size_t n) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += boost::flags::subseteq(a[i], b[i]) ? 1 : 0;
+    return count;
+}
+BENCH_NOINLINE std::size_t raw_subseteq(raw const* a, raw const* b, std::size_t n) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) count += (a[i] & ~b[i]) == 0 ? 1 : 0;
+    return count;
+}
+
+// operator++ as bool conversion
+BENCH_NOINLINE std::size_t flags_pre_increment(flags_enum const* a, flags_enum const* b, std::size_t n) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (++(a[i] & b[i])) {
+            ++count;
+        }
+    }
+    return count;
+}
+BENCH_NOINLINE std::size_t raw_pre_increment(raw const* a, raw const* b, std::size_t n) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if ((a[i] & b[i]) != 0) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+
+int main(int argc, char** argv) {
+    auto const opts = bench::parse_options(argc, argv);
+
+    std::vector<raw> ra(elements), rb(elements), rout(elements);
+    std::uint32_t state = 1;
+    for (std::size_t i = 0; i < elements; ++i) {
+        state = state * 1664525u + 1013904223u;
+        ra[i] = state >> 28;
+        rb[i] = (state >> 12) & 0xf;
+    }
+    std::vector<flags_enum> fa(elements), fb(elements), fout(elements);
+    for (std::size_t i = 0; i < elements; ++i) {
+        fa[i] = static_cast<flags_enum>(ra[i]);
+        fb[i] = static_cast<flags_enum>(rb[i]);
+    }
+
+    std::size_t const n = elements * rounds;
+    std::vector<bench::result> results;
+
+    auto binary = [&](char const* name, auto flags_kernel, auto raw_kernel) {
+        results.push_back({ name,
+            bench::measure(opts, n, [&] { for (int r = 0; r < rounds; ++r) { flags_kernel(fa.data(), fb.data(), fout.data(), elements); bench::do_not_optimize(fout[0]); } }),
+            bench::measure(opts, n, [&] { for (int r = 0; r < rounds; ++r) { raw_kernel(ra.data(), rb.data(), rout.data(), elements); bench::do_not_optimize(rout[0]); } }) });
+    };
+    auto predicate = [&](char const* name, auto flags_kernel, auto raw_kernel) {
+        results.push_back({ name,
+            bench::measure(opts, n, [&] { for (int r = 0; r < rounds; ++r) bench::do_not_optimize(flags_kernel(fa.data(), fb.data(), elements)); }),
+            bench::measure(opts, n, [&] { for (int r = 0; r < rounds; ++r) bench::do_not_optimize(raw_kernel(ra.data(), rb.data(), elements)); }) });
+    };
+
+    binary("or", flags_or, raw_or);
+    binary("and", flags_and, raw_and);
+    binary("and_not", flags_not, raw_not);
+    predicate("BOOST_FLAGS_AND", flags_pseudo_and, raw_pseudo_and);
+    predicate("subseteq", flags_subseteq, raw_subseteq);
+    predicate("pre_increment_bool", flags_pre_increment, raw_pre_increment);
+
+    results.push_back({ "modify_inplace",
+        bench::measure(opts, n, [&] { for (int r = 0; r < rounds; ++r) { flags_modify_inplace(fout.data(), fb.data(), elements); bench::do_not_optimize(fout[0]); } }),
+        bench::measure(opts, n, [&] { for (int r = 0; r < rounds; ++r) { raw_modify_inplace(rout.data(), rb.data(), elements); bench::do_not_optimize(rout[0]); } }) });
+
+    bench::write_json(opts, "operators", results);
+    return 0;
+}
@@ -0,0 +1,406 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// compile time benchmark: generates translation units with N enums and M operator uses per enum and
+// measures their compile time (-fsyntax-only, minimum of the repetitions) for
+//  - raw:     the same operations on the underlying integers (no Boost.Flags)
+//  - include: as raw, but including <boost/flags.hpp>
+//  - enabled: all enums enabled, but without any operator uses
+//  - flags:   all enums enabled and the operations using Boost.Flags
+// and for every trait resp. operator in `probes`, which is used once per enum (cost relative to enabled).
+//
+// the overhead per enum ((flags - include) / N) has to stay within the budget.
+// additionally the flags TU is compiled once with -ftime-report (gcc) resp. -ftime-trace (clang) to
+// report the phases resp. the instantiation cost of the Boost.Flags templates.
+//
+// with --module=<boost_flags.cppm> (C++20, gcc or clang) the module boost.flags is built and the parse time of
+// `#include <boost/flags.hpp>` is compared with `import boost.flags;` (plus <boost/flags/macros.hpp>), both on
+// their own and for the flags TU.
+//
+// command line: compile_bench [--out=<file>] [--repetitions=<n>] [--enums=<N>] [--uses=<M>] [--std=<c++ standard>]
+//                             [--budget-us=<overhead per enum in microseconds>] [--module=<module interface unit>]
+
+#include "bench.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef BENCH_CXX_COMPILER
+# error BENCH_CXX_COMPILER must be defined (path of the C++ compiler)
+#endif
+#ifndef BENCH_CXX_COMPILER_ID
+# define BENCH_CXX_COMPILER_ID "GNU"
+#endif
+#ifndef BENCH_INCLUDE_DIR
+# error BENCH_INCLUDE_DIR must be defined (include directory of Boost.Flags)
+#endif
+#ifndef BENCH_WORK_DIR
+# define BENCH_WORK_DIR "."
+#endif
+
+namespace {
+
+    struct compile_options {
+        std::string out;
+        int repetitions = 3;
+        int enums = 400;
+        int uses = 20;
+        int standard = 20;
+        double budget_us = 8000.0;  // gcc 12, C++20: ~5700us (before the trait reductions ~8700us)
+        std::string module;
+    };
+
+    compile_options parse(int argc, char** argv) {
+        compile_options opts;
+        for (int i = 1; i < argc; ++i) {
+            char const* arg = argv[i];
+            auto value = [arg](char const* prefix) -> char const* {
+                std::size_t const n = std::strlen(prefix);
+                return std::strncmp(arg, prefix, n) == 0 ? arg + n : nullptr;
+            };
+            if (char const* v = value("--out=")) {
+                opts.out = v;
+            } else if (char const* v = value("--repetitions=")) {
+                opts.repetitions = std::max(1, std::atoi(v));
+            } else if (char const* v = value("--enums=")) {
+                opts.enums = std::max(1, std::atoi(v));
+            } else if (char const* v = value("--uses=")) {
+                opts.uses = std::max(1, std::atoi(v));
+            } else if (char const* v = value("--std=")) {
+                opts.standard = std::atoi(v);
+            } else if (char const* v = value("--budget-us=")) {
+                opts.budget_us = std::atof(v);
+            } else if (char const* v = value("--module=")) {
+                opts.module = v;
+            } else {
+                std::fprintf(stderr, "usage: %s [--out=<file>] [--repetitions=<n>] [--enums=<N>] [--uses=<M>] [--std=<n>] [--budget-us=<x>] [--module=<file>]\n", argv[0]);
+                std::exit(1);
+            }
+        }
+        if (!opts.module.empty() && opts.standard < 20) {
+            opts.standard = 20;
+        }
+        return opts;
+    }
+
+    bool is_clang() {
+        return std::strcmp(BENCH_CXX_COMPILER_ID, "Clang") == 0 || std::strcmp(BENCH_CXX_COMPILER_ID, "AppleClang") == 0;
+    }
+
+    // module: as flags, but importing boost.flags
+    enum class variant { raw, include, enabled, flags, module };
+
+    // the operator uses, cycled through for every enum
+    // (first: Boost.Flags, second: equivalent on the underlying integers)
+    std::pair<char const*, char const*> const statements[] = {
+        { "r = x | y;",                                       "r = x | y;" },
+        { "r = x & ~y;",                                      "r = x & ~y;" },
+        { "r = x ^ y;",                                       "r = x ^ y;" },
+        { "r |= y;",                                          "r |= y;" },
+        { "r &= ~x;",                                         "r &= ~x;" },
+        { "if (x BOOST_FLAGS_AND y) ++n;",                    "if ((x & y) != 0) ++n;" },
+        { "if (x == y) ++n;",                                 "if (x == y) ++n;" },
+        { "r = ~(x | y) & r;",                                "r = ~(x | y) & r;" },
+        { "boost::flags::modify_inplace(r, x, (n & 1) != 0);", "r = (n & 1) != 0 ? (r | x) : (r & ~x);" },
+        { "if (boost::flags::subseteq(x, r)) ++n;",           "if ((x & ~r) == 0) ++n;" },
+    };
+
+    // single traits and operators, `$E` is replaced by the enum
+    struct probe {
+        char const* name;
+        char const* statement;
+    };
+
+    std::vector<probe> probes(compile_options const& opts) {
+        // concepts are used directly, otherwise the traits' value
+        bool const concepts = opts.standard >= 20;
+        return {
+            { "enable",                         "static_assert(boost::flags::enable<$E>::value, \"\");" },
+            { "is_flags",                       "static_assert(boost::flags::is_flags<$E>::value, \"\");" },
+            { "is_complement",                  "static_assert(boost::flags::is_complement<boost::flags::complement<$E>>::value, \"\");" },
+            { "binary_operation_result",        "static_assert(sizeof(boost::flags::impl::binary_operation_result<$E, $E, boost::flags::impl::disjunction>::type) != 0, \"\");" },
+            { "IsCompatibleFlagsOrComplement",  concepts ? "static_assert(boost::flags::IsCompatibleFlagsOrComplement<$E, $E>, \"\");"
+                                                         : "static_assert(boost::flags::IsCompatibleFlagsOrComplement<$E, $E>::value, \"\");" },
+            { "BinaryOperationEnabled",         concepts ? "static_assert(boost::flags::BinaryOperationEnabled<$E, $E, boost::flags::impl::disjunction>, \"\");"
+                                                         : "static_assert(boost::flags::BinaryOperationEnabled<$E, $E, boost::flags::impl::disjunction>::value, \"\");" },
+            { "operator|",                      statements[0].first },
+            { "operator& ~",                    statements[1].first },
+            { "operator^",                      statements[2].first },
+            { "operator|=",                     statements[3].first },
+            { "operator&= ~",                   statements[4].first },
+            { "BOOST_FLAGS_AND",                statements[5].first },
+            { "operator==",                     statements[6].first },
+            { "~(x | y) & r",                   statements[7].first },
+            { "modify_inplace",                 statements[8].first },
+            { "subseteq",                       statements[9].first },
+        };
+    }
+
+    std::string replace_all(std::string s, std::string const& from, std::string const& to) {
+        for (std::size_t pos = 0; (pos = s.find(from, pos)) != std::string::npos; pos += to.size()) {
+            s.replace(pos, from.size(), to);
+        }
+        return s;
+    }
+
+    // `body(e, u)` returns the u-th statement for the e-th enum
+    template<typename Body>
+    std::string generate(variant v, int enums, int uses, Body body) {
+        std::ostringstream src;
+        if (v == variant::module) {
+            src << "#include <boost/flags/macros.hpp>\nimport boost.flags;\n";
+        } else if (v != variant::raw) {
+            src << "#include <boost/flags.hpp>\n";
+        }
+        src << "\n";
+        bool const enabled = v == variant::enabled || v == variant::flags || v == variant::module;
+        for (int e = 0; e < enums; ++e) {
+            std::string const name = "e_" + std::to_string(e);
+            std::string const type = enabled ? name : "unsigned";
+            src << "enum class " << name << " : unsigned { a = 1, b = 2, c = 4, d = 8 };\n";
+            if (enabled) {
+                src << "BOOST_FLAGS_ENABLE(" << name << ")\n";
+            }
+            src << "int use_" << e << "(" << type << " x, " << type << " y) {\n";
+            src << "    " << type << " r = x;\n    int n = 0;\n    (void)y;\n";
+            for (int u = 0; u < uses; ++u) {
+                src << "    " << replace_all(body(e, u), "$E", name) << "\n";
+            }
+            src << "    return n + static_cast<int>(r);\n}\n\n";
+        }
+        return src.str();
+    }
+
+    std::string write_source(std::string const& name, std::string const& source) {
+        std::string const path = std::string(BENCH_WORK_DIR) + "/compile_bench_" + name + ".cpp";
+        std::ofstream(path) << source;
+        return path;
+    }
+
+    // runs in the work directory, where gcc looks for the compiled module interfaces (gcm.cache)
+    std::string compiler(compile_options const& opts) {
+        std::string cmd = std::string("cd \"") + BENCH_WORK_DIR + "\" && \"" + BENCH_CXX_COMPILER + "\" -std=c++" + std::to_string(opts.standard)
+            + " -I\"" + BENCH_INCLUDE_DIR + "\"";
+        if (!opts.module.empty()) {
+            cmd += is_clang() ? std::string(" -fprebuilt-module-path=\"") + BENCH_WORK_DIR + "\"" : std::string(" -fmodules-ts");
+        }
+        return cmd;
+    }
+
+    std::string command(compile_options const& opts, std::string const& source, std::string const& extra) {
+        return compiler(opts) + " -fsyntax-only " + extra + " \"" + source + "\"";
+    }
+
+    // minimal wall time (in ms) of running `cmd`
+    double run_time(compile_options const& opts, std::string const& cmd) {
+        double best = 1e300;
+        for (int r = 0; r < opts.repetitions; ++r) {
+            auto const start = std::chrono::steady_clock::now();
+            if (std::system(cmd.c_str()) != 0) {
+                std::fprintf(stderr, "compilation failed: %s\n", cmd.c_str());
+                std::exit(1);
+            }
+            auto const stop = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(stop - start).count());
+        }
+        return best;
+    }
+
+    // minimal wall time (in ms) of compiling `source`
+    double compile_time(compile_options const& opts, std::string const& source) {
+        return run_time(opts, command(opts, source, ""));
+    }
+
+    // wall time (in ms) of building the module interface unit (object file and compiled interface)
+    double build_module(compile_options const& opts) {
+        std::string const interface_unit = "\"" + opts.module + "\"";
+        if (is_clang()) {
+            return run_time(opts, compiler(opts) + " -x c++-module --precompile " + interface_unit + " -o boost.flags.pcm")
+                + run_time(opts, compiler(opts) + " -c boost.flags.pcm -o compile_bench_module.o");
+        }
+        return run_time(opts, compiler(opts) + " -x c++ -c " + interface_unit + " -o compile_bench_module.o");
+    }
+
+    std::string read_file(std::string const& path) {
+        std::ifstream in(path);
+        std::ostringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+
+    // named time (in ms) with a count (number of instantiations, or 0 for phases)
+    struct entry {
+        std::string name;
+        double ms;
+        long count;
+    };
+
+    // phases reported by gcc's -ftime-report, e.g.
+    //  " template instantiation             :   0.23 ( 36%)   0.14 ( 35%)   0.30 ( 28%)    18M ( 32%)"
+    std::vector<entry> gcc_time_report(compile_options const& opts, std::string const& source) {
+        std::string const report = std::string(BENCH_WORK_DIR) + "/compile_bench_time_report.txt";
+        std::system((command(opts, source, "-ftime-report") + " 2> \"" + report + "\"").c_str());
+        std::vector<entry> result;
+        std::istringstream in(read_file(report));
+        for (std::string line; std::getline(in, line);) {
+            auto const colon = line.find(':');
+            if (colon == std::string::npos) {
+                continue;
+            }
+            double usr = 0, sys = 0, wall = 0;
+            if (std::sscanf(line.c_str() + colon + 1, " %lf (%*[^)]) %lf (%*[^)]) %lf", &usr, &sys, &wall) == 3) {
+                std::string name = line.substr(0, colon);
+                name.erase(0, name.find_first_not_of(" |"));
+                name.erase(name.find_last_not_of(' ') + 1);
+                result.push_back({ name, wall * 1000.0, 0 });
+            }
+        }
+        return result;
+    }
+
+    // template instantiations of Boost.Flags in clang's -ftime-trace, aggregated by template name, e.g.
+    //  {"pid":1,"tid":2,"ph":"X","ts":10,"dur":42,"name":"InstantiateClass","args":{"detail":"boost::flags::is_flags<e_1>"}}
+    std::vector<entry> clang_time_trace(compile_options const& opts, std::string const& source) {
+        std::string const trace = std::string(BENCH_WORK_DIR) + "/compile_bench_time_trace.json";
+        std::system(command(opts, source, "-ftime-trace=\"" + trace + "\" -ftime-trace-granularity=0").c_str());
+        std::string const json = read_file(trace);
+
+        auto field = [&json](std::size_t begin, std::size_t end, char const* key) -> std::string {
+            std::size_t pos = json.find(key, begin);
+            if (pos == std::string::npos || pos >= end) {
+                return {};
+            }
+            pos += std::strlen(key);
+            if (json[pos] == '"') {
+                std::size_t const stop = json.find('"', pos + 1);
+                return json.substr(pos + 1, stop - pos - 1);
+            }
+            return json.substr(pos, json.find_first_of(",}", pos) - pos);
+        };
+
+        std::map<std::string, entry> templates;
+        for (std::size_t pos = 0; (pos = json.find("{\"pid\"", pos)) != std::string::npos; ++pos) {
+            std::size_t const end = json.find("}}", pos);
+            std::string const name = field(pos, end, "\"name\":");
+            if (name != "InstantiateClass" && name != "InstantiateFunction") {
+                continue;
+            }
+            std::string detail = field(pos, end, "\"detail\":");
+            if (detail.find("boost::flags::") == std::string::npos) {
+                continue;
+            }
+            detail = detail.substr(0, detail.find('<'));
+            auto& e = templates[detail];
+            e.name = detail;
+            e.ms += std::atof(field(pos, end, "\"dur\":").c_str()) / 1000.0;
+            ++e.count;
+        }
+
+        std::vector<entry> result;
+        for (auto const& t : templates) {
+            result.push_back(t.second);
+        }
+        std::sort(result.begin(), result.end(), [](entry const& a, entry const& b) { return a.ms > b.ms; });
+        return result;
+    }
+
+} // namespace
+
+
+int main(int argc, char** argv) {
+    auto const opts = parse(argc, argv);
+    std::size_t const statement_count = sizeof(statements) / sizeof(statements[0]);
+
+    auto const operations = [](bool flags) {
+        return [flags](int e, int u) -> std::string {
+            auto const& s = statements[static_cast<std::size_t>(u + e) % statement_count];
+            return flags ? s.first : s.second;
+        };
+    };
+    auto const nothing = [](int, int) -> std::string { return {}; };
+
+    std::string const raw_source = write_source("raw", generate(variant::raw, opts.enums, opts.uses, operations(false)));
+    std::string const include_source = write_source("include", generate(variant::include, opts.enums, opts.uses, operations(false)));
+    std::string const enabled_source = write_source("enabled", generate(variant::enabled, opts.enums, 0, nothing));
+    std::string const flags_source = write_source("flags", generate(variant::flags, opts.enums, opts.uses, operations(true)));
+
+    double const raw_ms = compile_time(opts, raw_source);
+    double const include_ms = compile_time(opts, include_source);
+    double const enabled_ms = compile_time(opts, enabled_source);
+    double const flags_ms = compile_time(opts, flags_source);
+
+    double const per_enum_us = (flags_ms - include_ms) * 1000.0 / opts.enums;
+    bool const within_budget = per_enum_us <= opts.budget_us;
+
+    // cost of single traits / operators per enum
+    std::vector<entry> probe_results;
+    for (auto const& p : probes(opts)) {
+        std::string const statement = p.statement;
+        std::string const source = write_source("probe", generate(variant::enabled, opts.enums, 1,
+            [&statement](int, int) { return statement; }));
+        probe_results.push_back({ p.name, (compile_time(opts, source) - enabled_ms) * 1000.0 / opts.enums, 0 });
+    }
+
+    std::vector<entry> const details = is_clang() ? clang_time_trace(opts, flags_source) : gcc_time_report(opts, flags_source);
+
+    // header vs. module: parse time of the bare include / import, and of the flags TU
+    double module_interface_ms = 0, header_only_ms = 0, import_only_ms = 0, flags_module_ms = 0;
+    if (!opts.module.empty()) {
+        module_interface_ms = build_module(opts);
+        header_only_ms = compile_time(opts, write_source("header_only", generate(variant::include, 0, 0, nothing)));
+        import_only_ms = compile_time(opts, write_source("import_only", generate(variant::module, 0, 0, nothing)));
+        flags_module_ms = compile_time(opts, write_source("flags_module", generate(variant::module, opts.enums, opts.uses, operations(true))));
+    }
+
+    std::FILE* out = opts.out.empty() ? stdout : std::fopen(opts.out.c_str(), "w");
+    if (!out) {
+        std::fprintf(stderr, "cannot open %s\n", opts.out.c_str());
+        return 1;
+    }
+    std::fprintf(out, "{\n  \"suite\": \"compile_time\",\n  \"compiler\": \"%s\",\n  \"standard\": %d,\n  \"repetitions\": %d,\n",
+        bench::escape(BENCH_CXX_COMPILER).c_str(), opts.standard, opts.repetitions);
+    std::fprintf(out, "  \"enums\": %d,\n  \"uses_per_enum\": %d,\n", opts.enums, opts.uses);
+    std::fprintf(out, "  \"raw_ms\": %.1f,\n  \"include_ms\": %.1f,\n  \"enabled_ms\": %.1f,\n  \"flags_ms\": %.1f,\n",
+        raw_ms, include_ms, enabled_ms, flags_ms);
+    std::fprintf(out, "  \"header_ms\": %.1f,\n  \"overhead_per_enum_us\": %.1f,\n", include_ms - raw_ms, per_enum_us);
+    std::fprintf(out, "  \"budget_per_enum_us\": %.1f,\n  \"within_budget\": %s,\n", opts.budget_us, within_budget ? "true" : "false");
+    if (!opts.module.empty()) {
+        std::fprintf(out, "  \"module\": { \"interface_ms\": %.1f, \"include_ms\": %.1f, \"import_ms\": %.1f, \"flags_include_ms\": %.1f, \"flags_import_ms\": %.1f },\n",
+            module_interface_ms, header_only_ms, import_only_ms, flags_ms, flags_module_ms);
+    }
+    std::fprintf(out, "  \"probes_per_enum_us\": [\n");
+    for (std::size_t i = 0; i < probe_results.size(); ++i) {
+        std::fprintf(out, "    { \"name\": \"%s\", \"us\": %.1f }%s\n",
+            bench::escape(probe_results[i].name).c_str(), probe_results[i].ms, i + 1 < probe_results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ],\n  \"%s\": [\n", is_clang() ? "instantiations" : "phases");
+    for (std::size_t i = 0; i < details.size(); ++i) {
+        std::fprintf(out, "    { \"name\": \"%s\", \"ms\": %.2f%s }%s\n",
+            bench::escape(details[i].name).c_str(), details[i].ms,
+            is_clang() ? (", \"count\": " + std::to_string(details[i].count)).c_str() : "",
+            i + 1 < details.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+    if (out != stdout) {
+        std::fclose(out);
+    }
+
+    if (!within_budget) {
+        std::fprintf(stderr, "compile time budget exceeded: %.1f us per enum (budget %.1f us)\n", per_enum_us, opts.budget_us);
+        return 1;
+    }
+    return 0;
+}
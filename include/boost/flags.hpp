@@ -8,135 +8,10 @@
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt
 
-#include <type_traits>
-
+#include <boost/flags/macros.hpp>
 
-// detect g++ compiler
-#if defined(__GNUC__) && (!defined(__clang__) || defined(__MINGW32__))
-# define BOOST_FLAGS_IS_GCC_COMPILER 1
-#else // defined(__GNUC__) && !defined(__clang__)
-# define BOOST_FLAGS_IS_GCC_COMPILER 0
-#endif // defined(__GNUC__) && !defined(__clang__)
-
-
-// check if the spaceship has already landed
-#if !defined(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
-// g++ does not allow overwriting rel. operators with spaceship for enums 
-// cf. https://cplusplus.github.io/CWG/issues/2673.html
-// cf. https://gcc.gnu.org/bugzilla/show_bug.cgi?id=105200
-// hopefully g++ 15 will have fixed it
-# if (BOOST_FLAGS_IS_GCC_COMPILER && __GNUC__ < 15) || !defined(__cpp_impl_three_way_comparison)
-#  define BOOST_FLAGS_HAS_THREE_WAY_COMPARISON 0
-# else // (BOOST_FLAGS_IS_GCC_COMPILER && __GNUC__ < 15) || !defined(__cpp_impl_three_way_comparison)
-#  define BOOST_FLAGS_HAS_THREE_WAY_COMPARISON 1
-# endif // (BOOST_FLAGS_IS_GCC_COMPILER && __GNUC__ < 15) || !defined(__cpp_impl_three_way_comparison)
-#endif // !defined(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
-
-
-// check for library support of three-way-comparison (flags will use std::partial_ordering)
-#if !defined(BOOST_FLAGS_HAS_PARTIAL_ORDERING)
-# if defined(__has_include)
-#  if __has_include(<compare>) && defined(__cpp_lib_three_way_comparison) && (__cpp_lib_three_way_comparison >= 201907L)
-#   define BOOST_FLAGS_HAS_PARTIAL_ORDERING 1
-#  else // __has_include(<compare>) && defined(__cpp_lib_three_way_comparison) && (__cpp_lib_three_way_comparison >= 201907L)
-#   define BOOST_FLAGS_HAS_PARTIAL_ORDERING 0
-#  endif // __has_include(<compare>) && defined(__cpp_lib_three_way_comparison) && (__cpp_lib_three_way_comparison >= 201907L)
-# else // defined(__has_include)
-#  define BOOST_FLAGS_HAS_PARTIAL_ORDERING 0
-# endif // defined(__has_include)
-#endif // !defined(BOOST_FLAGS_HAS_PARTIAL_ORDERING)
-
-#if (BOOST_FLAGS_HAS_THREE_WAY_COMPARISON) && !(BOOST_FLAGS_HAS_PARTIAL_ORDERING)
-// this should usually not happen as spaceship requires std::partial_ordering
-# undef BOOST_FLAGS_HAS_PARTIAL_ORDERING
-# define BOOST_FLAGS_HAS_PARTIAL_ORDERING 1
-#endif // (BOOST_FLAGS_HAS_THREE_WAY_COMPARISON) && !(BOOST_FLAGS_HAS_PARTIAL_ORDERING)
-
-// [[nodiscard]] attribute
-#if !defined(BOOST_FLAGS_ATTRIBUTE_NODISCARD)
-# if defined(__has_attribute) && defined(__SUNPRO_CC) && (__SUNPRO_CC > 0x5130)
-# if __has_attribute(nodiscard)
-#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD [[nodiscard]]
-# endif
-# elif defined(__has_cpp_attribute)
-// clang-6 accepts [[nodiscard]] with -std=c++14, but warns about it -pedantic
-# if __has_cpp_attribute(nodiscard) && !(defined(__clang__) && (__cplusplus < 201703L)) && !(defined(__GNUC__) && (__cplusplus < 201100))
-#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD [[nodiscard]]
-# endif
-# endif
-# ifndef BOOST_FLAGS_ATTRIBUTE_NODISCARD
-#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD
-# endif
-#endif // !defined(BOOST_FLAGS_ATTRIBUTE_NODISCARD)
-
-
-#if !defined(BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR)
-# if (defined(__clang_major__) && (__clang_major__ < 10)) || (defined(__GNUC__) && (__GNUC__ < 10))
-#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR
-# else // (defined(__clang_major__) && (__clang_major__ < 10)) || (defined(__GNUC__) && (__GNUC__ < 10))
-#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR BOOST_FLAGS_ATTRIBUTE_NODISCARD
-# endif // (defined(__clang_major__) && (__clang_major__ < 10)) || (defined(__GNUC__) && (__GNUC__ < 10))
-#endif // !defined(BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR)
-
-
-// adapted from boost/asio/detail/config.hpp
-// Support concepts on compilers known to allow them.
-#if !defined(BOOST_FLAGS_HAS_CONCEPTS)
-# if !defined(BOOST_FLAGS_DISABLE_CONCEPTS)
-#  if defined(__cpp_concepts)
-#   define BOOST_FLAGS_HAS_CONCEPTS 1
-#   if (__cpp_concepts >= 201707)
-#    define BOOST_FLAGS_CONCEPT concept
-#   else // (__cpp_concepts >= 201707)
-#    define BOOST_FLAGS_CONCEPT concept bool
-#   endif // (__cpp_concepts >= 201707)
-#  else // defined(__cpp_concepts)
-#   define BOOST_FLAGS_HAS_CONCEPTS 0
-#  endif // defined(__cpp_concepts)
-# else // !defined(BOOST_FLAGS_DISABLE_CONCEPTS)
-#  define BOOST_FLAGS_HAS_CONCEPTS 0
-# endif // !defined(BOOST_FLAGS_DISABLE_CONCEPTS)
-#endif // !defined(BOOST_FLAGS_HAS_CONCEPTS)
-
-
-// check if std::is_scoped_enum is available
-#if !defined(BOOST_FLAGS_HAS_IS_SCOPED_ENUM)
-# if defined(__cpp_lib_is_scoped_enum)
-#  define BOOST_FLAGS_HAS_IS_SCOPED_ENUM 1
-# else // defined(__cpp_lib_is_scoped_enum)
-#  define BOOST_FLAGS_HAS_IS_SCOPED_ENUM 0
-# endif // defined(__cpp_lib_is_scoped_enum)
-#endif // !defined(BOOST_FLAGS_HAS_IS_SCOPED_ENUM)
-
-
-// check for std::conjunction, std::disjunction and std::negation
-#if !defined(BOOST_FLAGS_HAS_LOGICAL_TRAITS)
-# if defined(__cpp_lib_logical_traits)
-#  define BOOST_FLAGS_HAS_LOGICAL_TRAITS 1
-# else //  defined(__cpp_lib_logical_traits)
-#  define BOOST_FLAGS_HAS_LOGICAL_TRAITS 0
-# endif //  defined(__cpp_lib_logical_traits)
-#endif // !defined(BOOST_FLAGS_HAS_LOGICAL_TRAITS)
-
-
-// operator rewritten candidates
-#if !defined(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
-# if __cplusplus < 202002L
-#  define BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES 0
-# else // __cplusplus < 202002L
-#  define BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES 1
-# endif // __cplusplus<202002L
-#endif // !defined(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
-
-
-// Variable templates
-#if !defined(BOOST_FLAGS_HAS_VARIABLE_TEMPLATES)
-# if defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
-#  define BOOST_FLAGS_HAS_VARIABLE_TEMPLATES 1
-# else // defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
-#  define BOOST_FLAGS_HAS_VARIABLE_TEMPLATES 0
-# endif // defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
-#endif // !defined(BOOST_FLAGS_HAS_VARIABLE_TEMPLATES)
+#include <cstddef>
+#include <type_traits>
 
 
 // include <compare> if available
@@ -144,16 +19,11 @@
 #include <compare>
 #endif
 
-
-// check, if consteval is available
-#ifdef __cpp_consteval
-#define BOOST_FLAGS_CONSTEVAL consteval
-#else
-#define BOOST_FLAGS_CONSTEVAL constexpr
+#if BOOST_FLAGS_PROFILE
+#include <boost/flags/profile.hpp>
 #endif
 
 
-
 namespace boost {
     namespace flags {
 
@@ -181,6 +51,10 @@ namespace boost {
             disable_complement  = 0x2,
             logical_and         = 0x4,
             pre_increment       = 0x8,
+            assume_domain       = 0x10,
+            check_assert        = 0x20,
+            check_mask          = 0x40,
+            check_trap          = 0x80,
         };
 
         template< options Opts >
@@ -195,6 +69,31 @@ namespace boost {
         // derive `enable` from this type to enable support for pre-increment operator
         struct pre_increment {};
 
+        // derive `enable` from this type to let the optimizer assume that values only contain bits
+        // of the domain (`boost_flags_domain(E)`, cf. <boost/flags/domain.hpp>)
+        struct assume_domain {};
+
+        // derive `enable` from one of these types to check, that values passed to `from_underlying` and the
+        // results of the binary operators only contain bits of the domain:
+        // - check_assert: BOOST_FLAGS_ASSERT fails (only if BOOST_FLAGS_ENABLE_CHECKS, i.e. by default not for NDEBUG)
+        // - check_mask: all bits outside of the domain are cleared
+        // - check_trap: BOOST_FLAGS_TRAP is invoked (only if BOOST_FLAGS_ENABLE_CHECKS, i.e. by default not for NDEBUG)
+        struct check_assert {};
+        struct check_mask {};
+        struct check_trap {};
+
+        // masks of the multi-bit fields (e.g. a 3-bit priority) of an enabled enum E, declared by
+        //
+        //      constexpr boost::flags::bit_fields<E, E::mask_1, E::mask_2, ...> boost_flags_fields(E) { return {}; }
+        //
+        // in the namespace of E (found by ADL, like boost_flags_enable) before the operators are used.
+        // The masks must be non-empty, contiguous and disjoint. The operators | and ^ reject operands with
+        // different non-zero values in a field: constant expressions don't compile, at runtime BOOST_FLAGS_ASSERT
+        // fails (only if BOOST_FLAGS_ENABLE_CHECKS, i.e. by default not for NDEBUG).
+        // The fields are accessed with get_field / set_field / modify_field
+        template<typename E, E... Masks>
+        struct bit_fields {};
+
 
 
         namespace impl {
@@ -212,6 +111,34 @@ namespace boost {
             BOOST_FLAGS_CONSTEVAL inline bool has_option_disable_complement(bool) { return false; }
             BOOST_FLAGS_CONSTEVAL inline bool has_option_logical_and(bool) { return false; }
             BOOST_FLAGS_CONSTEVAL inline bool has_option_pre_increment(bool) { return false; }
+            BOOST_FLAGS_CONSTEVAL inline bool has_option_assume_domain(bool) { return false; }
+            BOOST_FLAGS_CONSTEVAL inline bool has_option_check_assert(bool) { return false; }
+            BOOST_FLAGS_CONSTEVAL inline bool has_option_check_mask(bool) { return false; }
+            BOOST_FLAGS_CONSTEVAL inline bool has_option_check_trap(bool) { return false; }
+
+
+            // evaluates the options returned by `boost_flags_enable`
+            // (`Opts` is the result type of `boost_flags_enable`, thus the overload resolution for
+            // `boost_flags_enable` - which has to consider all enabled enums in the enum's namespace -
+            // happens only once per enum, and the options are shared by all enums with equal options)
+            template<typename Opts>
+            struct enable_options
+                : std::integral_constant<bool, has_option_enable(Opts{}.value) >
+                , std::conditional<has_option_disable_complement(Opts{}.value),
+                                                disable_complement, impl::empty<disable_complement>>::type
+                , std::conditional<has_option_logical_and(Opts{}.value),
+                                                logical_and, impl::empty<logical_and>>::type
+                , std::conditional< has_option_pre_increment(Opts{}.value),
+                                                pre_increment, impl::empty<pre_increment>>::type
+                , std::conditional< has_option_assume_domain(Opts{}.value),
+                                                assume_domain, impl::empty<assume_domain>>::type
+                , std::conditional< has_option_check_assert(Opts{}.value),
+                                                check_assert, impl::empty<check_assert>>::type
+                , std::conditional< has_option_check_mask(Opts{}.value),
+                                                check_mask, impl::empty<check_mask>>::type
+                , std::conditional< has_option_check_trap(Opts{}.value),
+                                                check_trap, impl::empty<check_trap>>::type
+            {};
 
 
             // type to calculate the enabling (using concepts/SFINAE)
@@ -233,13 +160,7 @@ namespace boost {
             template<typename E>
             struct enable_helper<E, typename std::enable_if<std::is_enum<E>::value>::type>
 #endif // BOOST_FLAGS_HAS_CONCEPTS
-                : std::integral_constant<bool, has_option_enable(decltype(boost_flags_enable(E{})){}.value) >
-                , std::conditional<has_option_disable_complement(decltype(boost_flags_enable(E{})){}.value),
-                                                disable_complement, impl::empty<disable_complement>>::type
-                , std::conditional<has_option_logical_and(decltype(boost_flags_enable(E{})){}.value),
-                                                logical_and, impl::empty<logical_and>>::type
-                , std::conditional< has_option_pre_increment(decltype(boost_flags_enable(E{})){}.value),
-                                                pre_increment, impl::empty<pre_increment>>::type
+                : enable_options<decltype(boost_flags_enable(E{}))>
             {};
 
         }
@@ -363,22 +284,22 @@ namespace boost {
             complement() = default;
 
             BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR
-                constexpr complement(underlying_type v) :
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr complement(underlying_type v) :
                 value{ v }
             {}
 
             BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR
-                constexpr complement(E v) :
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr complement(E v) :
                 // using parentheses instead of brackets to silence
                 // (wrong) gcc 4.8 warning "parameter 'v' set but not used" 
                 value(static_cast<underlying_type>(v))
             {}
 
             BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR
-                constexpr operator underlying_type() const { return get_underlying(); }
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr operator underlying_type() const { return get_underlying(); }
 
             BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                constexpr underlying_type get_underlying() const { return value; }
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr underlying_type get_underlying() const { return value; }
 
             // Using the underlying_type (instead of enumeration_type or E) ensures that for
             // unscoped enumerations with unspecified underlying type, we
@@ -403,16 +324,16 @@ namespace boost {
                 using underlying_type = typename std::underlying_type<enumeration_type>::type;
 
                 BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR
-                    constexpr bool_convertible(T v) :
+                    BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool_convertible(T v) :
                     value{ v }
                 {
                 }
 
                 BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                    constexpr T get_enum_value() const { return value; }
+                    BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr T get_enum_value() const { return value; }
 
                 BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                    constexpr explicit operator bool() const { return !!value; }
+                    BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr explicit operator bool() const { return !!value; }
 
 
                 protected:
@@ -471,6 +392,18 @@ namespace boost {
         };
 #endif // BOOST_FLAGS_HAS_CONCEPTS
 
+#if BOOST_FLAGS_HAS_CONCEPTS
+        template<typename T>
+        concept HasAssumeDomain =
+            std::is_base_of_v<assume_domain, enable<enum_type_t<T>>>;
+#else // BOOST_FLAGS_HAS_CONCEPTS
+        template<typename T>
+        struct HasAssumeDomain : std::integral_constant<bool,
+            std::is_base_of<assume_domain, enable<typename enum_type<T>::type>>::value
+        > {
+        };
+#endif // BOOST_FLAGS_HAS_CONCEPTS
+
         // test if E is a flags-enum:
         // detects double-negation
         // returns false_type for non-enabled enums (SFINAE friendly)
@@ -492,24 +425,26 @@ namespace boost {
         template<typename E>
         struct is_flags : is_enabled<E> {};
 
+        // complement<E> is flags, iff E is an (enabled) complement
         template<typename E>
-        struct is_flags<complement<E>> :
-            impl::conjunction<
-            impl::negation<is_flags<E>>,
-            is_enabled<E>                       // ensure it's enabled
-            > {};
+        struct is_flags<complement<E>> : is_complement<E> {};
 
         template<typename E>
         struct is_flags<impl::bool_convertible<E>> : is_flags<E> {};
 
 
         // test for complement (detects double-negation)
+        // only complement<E> can be a complement: the primary template needs no further instantiations,
+        // which keeps the operators' result calculation cheap for plain enums
         template<typename E>
-        struct is_complement :
-            impl::conjunction<
-            impl::negation<is_flags<E>>,
-            is_enabled<E>                       // ensure it's enabled
-            > {};
+        struct is_complement : std::false_type {};
+
+        // complement<E> is a complement, iff E is (enabled) flags
+        template<typename E>
+        struct is_complement<complement<E>> : is_flags<E> {};
+
+        template<typename E>
+        struct is_complement<impl::bool_convertible<E>> : is_complement<E> {};
 
 
 #if BOOST_FLAGS_HAS_CONCEPTS
@@ -560,28 +495,40 @@ namespace boost {
             std::is_same<enum_type_t<T1>, enum_type_t<T2>>::value
         > {};
 
+        // (conjunction and disjunction short-circuit the instantiations like the concepts above)
         template<typename T1, typename T2>
         struct IsCompatibleFlags : std::integral_constant<bool,
-            IsCompatible<T1, T2>::value&&
-            IsFlags<T1>::value&& IsFlags<T2>::value
+            impl::conjunction<
+            IsCompatible<T1, T2>,
+            IsFlags<T1>, IsFlags<T2>
+            >::value
         > {};
 
         template<typename T1, typename T2>
         struct IsCompatibleComplement : std::integral_constant<bool,
-            IsCompatible<T1, T2>::value&&
-            IsComplement<T1>::value&& IsComplement<T2>::value
+            impl::conjunction<
+            IsCompatible<T1, T2>,
+            IsComplement<T1>, IsComplement<T2>
+            >::value
         > {};
 
         template<typename T1, typename T2>
         struct IsCompatibleFlagsOrComplement : std::integral_constant<bool,
-            IsCompatible<T1, T2>::value &&
-            ((IsFlags<T1>::value&& IsFlags<T2>::value) || (IsComplement<T1>::value && IsComplement<T2>::value))
+            impl::conjunction<
+            IsCompatible<T1, T2>,
+            impl::disjunction<
+            impl::conjunction<IsFlags<T1>, IsFlags<T2>>,
+            impl::conjunction<IsComplement<T1>, IsComplement<T2>>
+            >
+            >::value
         > {};
 
 #endif // BOOST_FLAGS_HAS_CONCEPTS
 
         // for pseudo operator BOOST_FLAG_AND
-        struct pseudo_and_op_tag {};
+        struct pseudo_and_op_tag {
+            BOOST_FLAGS_PROFILE_LOCATION_MEMBER
+        };
 
         // NULL constant tag
         struct null_tag {};
@@ -591,22 +538,41 @@ namespace boost {
             template<typename T>
             struct pseudo_and_op_intermediate_t {
                 T value;
+#if BOOST_FLAGS_PROFILE
+                std::source_location location;
+#endif // BOOST_FLAGS_PROFILE
             };
 
-            template<typename T>
-            struct is_pseudo_and_op_intermediate :
-                std::false_type {};
+            // tests for pseudo_and_op_tag and pseudo_and_op_intermediate_t (ignoring cv-qualifiers and references)
+            // by specializations only, as it is checked for most operator candidates
+            template<typename E>
+            struct is_pseudo_and_op_type : std::false_type {};
+
+            template<>
+            struct is_pseudo_and_op_type<pseudo_and_op_tag> : std::true_type {};
 
             template<typename E>
-            struct is_pseudo_and_op_intermediate<pseudo_and_op_intermediate_t<E>> :
-                std::true_type {};
+            struct is_pseudo_and_op_type<pseudo_and_op_intermediate_t<E>> : std::true_type {};
 
             template<typename E>
-            struct is_pseudo_and_op_type :
-                impl::disjunction<
-                std::is_same<typename std::remove_cv<typename std::remove_reference<E>::type>::type, pseudo_and_op_tag>,
-                is_pseudo_and_op_intermediate<typename std::remove_cv<typename std::remove_reference<E>::type>::type>
-                > {};
+            struct is_pseudo_and_op_type<E const> : is_pseudo_and_op_type<E> {};
+
+            template<typename E>
+            struct is_pseudo_and_op_type<E volatile> : is_pseudo_and_op_type<E> {};
+
+            template<typename E>
+            struct is_pseudo_and_op_type<E const volatile> : is_pseudo_and_op_type<E> {};
+
+            template<typename E>
+            struct is_pseudo_and_op_type<E&> : is_pseudo_and_op_type<E> {};
+
+            template<typename E>
+            struct is_pseudo_and_op_type<E&&> : is_pseudo_and_op_type<E> {};
+
+            // is_complement as std::true_type / std::false_type: the logical operations applied to it
+            // are then instantiated only once and not for every enum
+            template<typename T>
+            using complement_constant = std::integral_constant<bool, is_complement<T>::value>;
 
             // calculate whether result Op(T1) is in the original or the complemented Boolean algebra
             // always returns the canonical form (either the enum or its negation, never a double negated enum)
@@ -624,7 +590,7 @@ namespace boost {
 #endif // BOOST_FLAGS_HAS_CONCEPTS
                     T1,
                     typename std::conditional<
-                    UnOp<is_complement<T1>>::value,
+                    UnOp<complement_constant<T1>>::value,
                     complement<E1>,
                     E1
                     >::type
@@ -643,22 +609,30 @@ namespace boost {
 
             // calculate whether result Op(T1, T2) is in the original or the complement Boolean algebra
             // always returns the canonical form (either the enum or its negation, never a double negated enum)
-            template<typename T1, typename T2, template<typename...> class BinOp>
+            //
+            // static-asserting on "if E1 or E2 is enabled then both are equal" in here would result in poor
+            // error diagnostic. The error would point here, and not to the call site. 
+            // We use the compatibility_check template instead (see below).
+            //static_assert(
+            //    (!(enable<E1>::value || enable<E2>::value) || std::is_same_v<E1, E2>)
+            //    );
+            //
+            // for different underlying enums nothing else has to be calculated (this happens for every
+            // operator candidate with mixed arguments, e.g. the first `&` of BOOST_FLAGS_AND)
+            template<typename T1, typename T2, template<typename...> class BinOp,
+                bool = std::is_same<enum_type_t<T1>, enum_type_t<T2>>::value>
             struct binary_operation_result {
-                using E1 = enum_type_t<T1>;
-                using E2 = enum_type_t<T2>;
+                using type = error_tag;
+            };
 
-                // static-asserting on "if E1 or E2 is enabled then both are equal" in here would result in poor
-                // error diagnostic. The error would point here, and not to the call site. 
-                // We use the compatibility_check template instead (see below).
-                //static_assert(
-                //    (!(enable<E1>::value || enable<E2>::value) || std::is_same_v<E1, E2>)
-                //    );
+            template<typename T1, typename T2, template<typename...> class BinOp>
+            struct binary_operation_result<T1, T2, BinOp, true> {
+                using E1 = enum_type_t<T1>;
 
                 using op_type = typename std::conditional<
-                    std::is_same<E1, E2>::value&& enable<E1>::value,        // check underlying enums are the same and enabled
+                    enable<E1>::value,        // check underlying enum is enabled
                     typename std::conditional<
-                    BinOp<is_complement<T1>, is_complement<T2>>::value,
+                    BinOp<complement_constant<T1>, complement_constant<T2>>::value,
                     complement<E1>,
                     E1
                     >::type,
@@ -675,10 +649,11 @@ namespace boost {
 
             // checking: if T1 or T2 are enabled then both are equal or one of them is_pseudo_and_op_type
 #if BOOST_FLAGS_HAS_CONCEPTS
+            // (the cheapest and most likely satisfied check comes first)
             template<typename T1, typename T2>
             concept ArgumentsCompatible =
-                !(enable<enum_type_t<T1>>::value || enable<enum_type_t<T2>>::value)
-                || std::is_same<enum_type_t<T1>, enum_type_t<T2>>::value
+                std::is_same<enum_type_t<T1>, enum_type_t<T2>>::value
+                || !(enable<enum_type_t<T1>>::value || enable<enum_type_t<T2>>::value)
                 || is_pseudo_and_op_type<T1>::value
                 || is_pseudo_and_op_type<T2>::value
                 ;
@@ -694,12 +669,15 @@ namespace boost {
                 ;
 
 #else // BOOST_FLAGS_HAS_CONCEPTS
+            // (disjunction and conjunction stop instantiating at the first decisive argument)
             template<typename T1, typename T2>
             struct ArgumentsCompatible : std::integral_constant<bool,
-                !(enable<enum_type_t<T1>>::value || enable<enum_type_t<T2>>::value)
-                || std::is_same<enum_type_t<T1>, enum_type_t<T2>>::value
-                || is_pseudo_and_op_type<T1>::value
-                || is_pseudo_and_op_type<T2>::value
+                impl::disjunction<
+                std::is_same<enum_type_t<T1>, enum_type_t<T2>>,
+                impl::negation<impl::disjunction<enable<enum_type_t<T1>>, enable<enum_type_t<T2>>>>,
+                is_pseudo_and_op_type<T1>,
+                is_pseudo_and_op_type<T2>
+                >::value
             > {};
 
             template<typename T>
@@ -709,7 +687,7 @@ namespace boost {
 
             template<typename T1, typename T2>
             struct BothImplicitIntegralConvertible : std::integral_constant<bool,
-                ImplicitIntegralConvertible<T1>::value && ImplicitIntegralConvertible<T2>::value
+                impl::conjunction<ImplicitIntegralConvertible<T1>, ImplicitIntegralConvertible<T2>>::value
             > {};
 
 #endif // BOOST_FLAGS_HAS_CONCEPTS
@@ -727,22 +705,246 @@ namespace boost {
                 typename std::enable_if<std::is_enum<T>::value, int*>::type = nullptr>
 #endif // BOOST_FLAGS_HAS_CONCEPTS
             BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                constexpr auto get_underlying_impl(T value) noexcept -> typename std::underlying_type<T>::type {
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto get_underlying_impl(T value) noexcept -> typename std::underlying_type<T>::type {
                 using underlying = typename std::underlying_type<T>::type;
                 return static_cast<underlying>(value);
             }
 
             template<typename T>
             BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                constexpr auto get_underlying_impl(complement<T> value) noexcept -> typename std::underlying_type<enum_type_t<T>>::type {
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto get_underlying_impl(complement<T> value) noexcept -> typename std::underlying_type<enum_type_t<T>>::type {
                 return value.get_underlying();
             }
 
             template<typename T>
             BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                constexpr auto get_underlying_impl(bool_convertible<T> value) noexcept -> typename std::underlying_type<enum_type_t<T>>::type {
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto get_underlying_impl(bool_convertible<T> value) noexcept -> typename std::underlying_type<enum_type_t<T>>::type {
                 return get_underlying_impl(value.get_enum_value());
             }
+
+
+            // domain of E: the value of `boost_flags_domain(E)` (found by ADL, cf. <boost/flags/domain.hpp>),
+            // otherwise all bits of the underlying type
+            template<typename E, typename = void>
+            struct domain_helper {
+                using type = typename std::make_unsigned<typename std::underlying_type<E>::type>::type;
+                static constexpr type value = static_cast<type>(~type(0));
+            };
+
+            template<typename E>
+            struct domain_helper<E, decltype(void(boost_flags_domain(E{})))> {
+                static_assert(std::is_same<decltype(boost_flags_domain(E{})), E>::value,
+                    "boost_flags_domain(E) must return E.");
+                using type = typename std::make_unsigned<typename std::underlying_type<E>::type>::type;
+                static constexpr type value = static_cast<type>(boost_flags_domain(E{}));
+            };
+
+
+            constexpr bool any_of() noexcept { return false; }
+
+            template<typename... Bs>
+            constexpr bool any_of(bool b, Bs... bs) noexcept { return b || any_of(bs...); }
+
+            template<typename U>
+            constexpr U or_all() noexcept { return 0; }
+
+            template<typename U, typename... Us>
+            constexpr U or_all(U m, Us... ms) noexcept { return static_cast<U>(m | or_all<U>(ms...)); }
+
+            template<typename U>
+            constexpr bool disjoint_masks() noexcept { return true; }
+
+            template<typename U, typename... Us>
+            constexpr bool disjoint_masks(U m, Us... ms) noexcept { return (m & or_all<U>(ms...)) == 0 && disjoint_masks<U>(ms...); }
+
+            // non-empty and contiguous: adding the lowest bit clears all bits of the mask
+            template<typename U>
+            constexpr bool is_field_mask(U m) noexcept {
+                return m != 0 && ((m + (m & (~m + 1u))) & m) == 0;
+            }
+
+            // both values have different non-zero values in the field `mask`
+            template<typename U>
+            constexpr bool field_conflict(U lhs, U rhs, U mask) noexcept {
+                return (lhs & mask) != 0 && (rhs & mask) != 0 && (lhs & mask) != (rhs & mask);
+            }
+
+            template<typename E, typename Fields>
+            struct fields_info {
+                static_assert(sizeof(Fields) == 0, "boost_flags_fields(E) must return boost::flags::bit_fields<E, ...>.");
+            };
+
+            template<typename E, E... Masks>
+            struct fields_info<E, bit_fields<E, Masks...>> {
+                using type = typename std::make_unsigned<typename std::underlying_type<E>::type>::type;
+
+                static_assert(!any_of(!is_field_mask(static_cast<type>(Masks))...),
+                    "boost::flags::bit_fields: the field masks must be non-empty and contiguous.");
+                static_assert(disjoint_masks<type>(static_cast<type>(Masks)...),
+                    "boost::flags::bit_fields: the field masks must be disjoint.");
+
+                static constexpr bool empty = sizeof...(Masks) == 0;
+
+                static constexpr bool conflict(type lhs, type rhs) noexcept {
+                    return any_of(field_conflict<type>(lhs, rhs, static_cast<type>(Masks))...);
+                }
+            };
+
+            // fields of E: the result of `boost_flags_fields(E)` (found by ADL), otherwise no fields
+            template<typename E, typename = void>
+            struct fields_helper : fields_info<E, bit_fields<E>> {};
+
+            template<typename E>
+            struct fields_helper<E, decltype(void(boost_flags_fields(E{})))>
+                : fields_info<E, decltype(boost_flags_fields(E{}))> {};
+
+            // the operands of | and ^ are checked, if both are values of an enum with fields
+            template<typename T1, typename T2>
+            struct checks_fields : std::integral_constant<bool,
+                std::is_enum<T1>::value && std::is_enum<T2>::value && !fields_helper<enum_type_t<T1>>::empty
+            > {};
+
+            template<typename U>
+            inline U report_field_conflict(U result) noexcept {
+                // not constexpr: reaching this in a constant expression is a compile error
+                return BOOST_FLAGS_ASSERT(false && "operands have different values in a field (cf. boost::flags::bit_fields)"), result;
+            }
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U check_fields_impl(U result, U, U, std::false_type) noexcept {
+                return result;
+            }
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U check_fields_impl(U result, U lhs, U rhs, std::true_type) noexcept {
+                using type = typename fields_helper<T>::type;
+                return (BOOST_FLAGS_ENABLE_CHECKS || (BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED && BOOST_FLAGS_IS_CONSTANT_EVALUATED()))
+                    && fields_helper<T>::conflict(static_cast<type>(lhs), static_cast<type>(rhs))
+                    ? report_field_conflict(result) : result;
+            }
+
+            // returns `result` (of `lhs | rhs` or `lhs ^ rhs`), checking that the operands don't conflict in a field
+            template<typename T1, typename T2, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U check_fields(U result, U lhs, U rhs) noexcept {
+                return check_fields_impl<enum_type_t<T1>>(result, lhs, rhs, checks_fields<T1, T2>{});
+            }
+
+
+            // options::assume_domain: values of E (but not of complement<E>) only contain bits of the domain
+            template<typename T>
+            struct assumes_domain : std::integral_constant<bool,
+                std::is_enum<T>::value && std::is_base_of<assume_domain, enable<enum_type_t<T>>>::value
+            > {};
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U assume_in_domain_impl(U value, std::false_type) noexcept {
+                return value;
+            }
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U assume_in_domain_impl(U value, std::true_type) noexcept {
+                // comma operator used to only have a return statement in the function (required for C++11)
+                return BOOST_FLAGS_ASSUME((static_cast<typename domain_helper<T>::type>(value) & ~domain_helper<T>::value) == 0),
+                    value;
+            }
+
+            // returns `value` (the underlying value of a T), with the assumption that it is in the domain of T
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U assume_in_domain(U value) noexcept {
+                return assume_in_domain_impl<T>(value, assumes_domain<T>{});
+            }
+
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U mask_domain_impl(U value, std::false_type) noexcept {
+                return value;
+            }
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U mask_domain_impl(U value, std::true_type) noexcept {
+                return static_cast<U>(static_cast<typename domain_helper<T>::type>(value) & domain_helper<T>::value);
+            }
+
+
+
+            // check policy of T (options::check_assert, check_mask, check_trap): the tag type or
+            // check_none (values of complement<E> are not checked)
+            struct check_none {};
+
+            template<typename T, bool = is_flags<T>::value>
+            struct check_policy {
+                using type = check_none;
+            };
+
+            template<typename T>
+            struct check_policy<T, true> {
+            private:
+                using enable_t = enable<enum_type_t<T>>;
+                static constexpr bool is_assert = std::is_base_of<check_assert, enable_t>::value;
+                static constexpr bool is_mask = std::is_base_of<check_mask, enable_t>::value;
+                static constexpr bool is_trap = std::is_base_of<check_trap, enable_t>::value;
+                static_assert(int(is_assert) + int(is_mask) + int(is_trap) <= 1,
+                    "At most one of the options check_assert, check_mask and check_trap may be specified.");
+                // check_mask changes values, it must not be dropped silently (check_assert and check_trap are
+                // debugging aids which are disabled without the detection)
+                static_assert(!is_mask || BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED,
+                    "The option check_mask requires the detection of constant evaluation (BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED).");
+                static constexpr bool enabled = BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED && (is_mask || BOOST_FLAGS_ENABLE_CHECKS);
+            public:
+                using type = typename std::conditional<!enabled, check_none,
+                    typename std::conditional<is_mask, check_mask,
+                    typename std::conditional<is_trap, check_trap,
+                    typename std::conditional<is_assert, check_assert, check_none>::type>::type>::type>::type;
+            };
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool in_domain(U value) noexcept {
+                return (static_cast<typename domain_helper<T>::type>(value) & ~domain_helper<T>::value) == 0;
+            }
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE inline U check_domain_runtime(U value, check_assert) noexcept {
+                return BOOST_FLAGS_ASSERT(in_domain<T>(value) && "value contains bits outside of the domain"), value;
+            }
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE inline U check_domain_runtime(U value, check_mask) noexcept {
+                return static_cast<U>(static_cast<typename domain_helper<T>::type>(value) & domain_helper<T>::value);
+            }
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE inline U check_domain_runtime(U value, check_trap) noexcept {
+                return in_domain<T>(value) ? value : (BOOST_FLAGS_TRAP(), value);
+            }
+
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U check_domain_impl(U value, check_none) noexcept {
+                return value;
+            }
+
+            template<typename T, typename U, typename Policy>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U check_domain_impl(U value, Policy policy) noexcept {
+                // constant expressions are not checked: the domain itself is usually computed with the
+                // operators (e.g. `boost_flags_domain` returning `E::a | E::b`), and the check in a separate
+                // function template is only instantiated when evaluated at runtime
+                return BOOST_FLAGS_IS_CONSTANT_EVALUATED() ? value : check_domain_runtime<T>(value, policy);
+            }
+
+            // returns `value` (the underlying value of a T) checked according to the check policy of T
+            template<typename T, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U check_domain(U value) noexcept {
+                return check_domain_impl<enum_type_t<T>>(value, typename check_policy<T>::type{});
+            }
+
+
+            // the result of operator~ for enumerations with disabled complement (T and R are both
+            // enumerations) has to be masked with the domain, if it is assumed or checked
+            template<typename T, typename R, typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U mask_complement(U value) noexcept {
+                return mask_domain_impl<R>(value, std::integral_constant<bool,
+                    std::is_enum<T>::value && (assumes_domain<R>::value ||
+                        !std::is_same<typename check_policy<R>::type, check_none>::value)>{});
+            }
 } // namespace impl
 
 
@@ -826,13 +1028,13 @@ namespace boost {
             typename std::enable_if<BinaryOperationEnabled<T1, T2, impl::conjunction>::value, int*>::type = nullptr>
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr auto
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
             operator&(T1 lhs, T2 rhs) noexcept -> typename impl::binary_operation_result<T1, T2, impl::conjunction>::type {
             using result_t = typename impl::binary_operation_result<T1, T2, impl::conjunction>::type;
 
             using underlying_type = decltype(impl::get_underlying_impl(lhs));
             return result_t{
-                static_cast<enum_type_t<T1>>(static_cast<underlying_type>(impl::get_underlying_impl(lhs) & impl::get_underlying_impl(rhs)))
+                static_cast<enum_type_t<T1>>(impl::check_domain<result_t>(static_cast<underlying_type>(impl::get_underlying_impl(lhs) & impl::get_underlying_impl(rhs))))
             };
         }
 
@@ -855,13 +1057,15 @@ namespace boost {
             typename std::enable_if<BinaryOperationEnabled<T1, T2, impl::disjunction>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr auto
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
             operator|(T1 lhs, T2 rhs) noexcept -> typename impl::binary_operation_result<T1, T2, impl::disjunction>::type {
             using result_t = typename impl::binary_operation_result<T1, T2, impl::disjunction>::type;
 
             using underlying_type = decltype(impl::get_underlying_impl(lhs));
             return result_t{
-                static_cast<enum_type_t<T1>>(static_cast<underlying_type>(impl::get_underlying_impl(lhs) | impl::get_underlying_impl(rhs)))
+                static_cast<enum_type_t<T1>>(impl::check_domain<result_t>(impl::check_fields<T1, T2>(
+                    static_cast<underlying_type>(impl::get_underlying_impl(lhs) | impl::get_underlying_impl(rhs)),
+                    impl::get_underlying_impl(lhs), impl::get_underlying_impl(rhs))))
             };
         }
 
@@ -884,13 +1088,15 @@ namespace boost {
             typename std::enable_if<BinaryOperationEnabled<T1, T2, impl::not_equal>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr auto
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
             operator^(T1 lhs, T2 rhs) noexcept -> typename impl::binary_operation_result<T1, T2, impl::not_equal>::type {
             using result_t = typename impl::binary_operation_result<T1, T2, impl::not_equal>::type;
 
             using underlying_type = decltype(impl::get_underlying_impl(lhs));
             return result_t{
-                static_cast<enum_type_t<T1>>(static_cast<underlying_type>(impl::get_underlying_impl(lhs) ^ impl::get_underlying_impl(rhs)))
+                static_cast<enum_type_t<T1>>(impl::check_domain<result_t>(impl::check_fields<T1, T2>(
+                    static_cast<underlying_type>(impl::get_underlying_impl(lhs) ^ impl::get_underlying_impl(rhs)),
+                    impl::get_underlying_impl(lhs), impl::get_underlying_impl(rhs))))
             };
         }
 
@@ -913,7 +1119,7 @@ namespace boost {
             typename std::enable_if<UnaryOperationEnabled<T, impl::negation>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr auto
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
             operator~(T arg) noexcept -> typename impl::unary_operation_result<T, impl::negation>::type {
             using result_t = typename impl::unary_operation_result<T, impl::negation>::type;
 
@@ -944,7 +1150,7 @@ namespace boost {
                 "For C++ standard before C++20 and disabled complement, Boost.Flags requires an unsigned underlying type.");
 
             return result_t{
-                static_cast<enum_type_t<T>>(static_cast<underlying_type>(~impl::get_underlying_impl(arg)))
+                static_cast<enum_type_t<T>>(impl::mask_complement<T, result_t>(static_cast<underlying_type>(~impl::get_underlying_impl(arg))))
             };
         }
 
@@ -970,7 +1176,7 @@ namespace boost {
         template<typename T1, typename T2,
             typename std::enable_if<BinaryAssignmentEnabled<T1, T2, impl::conjunction>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
-        constexpr T1&
+        BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr T1&
             operator&=(T1& lhs, T2 rhs) noexcept {
             // comma operator used to only have a return statement in the function (required for C++11)
             return (lhs = lhs & rhs), lhs;
@@ -984,7 +1190,7 @@ namespace boost {
         template<typename T1, typename T2,
             typename std::enable_if<BinaryAssignmentEnabled<T1, T2, impl::disjunction>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
-        constexpr T1&
+        BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr T1&
             operator|=(T1& lhs, T2 rhs) noexcept {
             // comma operator used to only have a return statement in the function (required for C++11)
             return (lhs = lhs | rhs), lhs;
@@ -998,7 +1204,7 @@ namespace boost {
         template<typename T1, typename T2,
             typename std::enable_if<BinaryAssignmentEnabled<T1, T2, impl::not_equal>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
-        constexpr T1&
+        BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr T1&
             operator^=(T1& lhs, T2 rhs) noexcept {
             // comma operator used to only have a return statement in the function (required for C++11)
             return (lhs = lhs ^ rhs), lhs;
@@ -1013,7 +1219,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             operator!(T e) noexcept {
             return !impl::get_underlying_impl(e);
         }
@@ -1027,7 +1233,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             operator==(T value, std::nullptr_t) noexcept {
             return impl::get_underlying_impl(value) == 0;
         }
@@ -1043,7 +1249,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             operator==(std::nullptr_t, T value) noexcept {
             return impl::get_underlying_impl(value) == 0;
         }
@@ -1056,7 +1262,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             operator!=(T value, std::nullptr_t) noexcept {
             return !(impl::get_underlying_impl(value) == 0);
         }
@@ -1069,7 +1275,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             operator!=(std::nullptr_t, T value) noexcept {
             return !(impl::get_underlying_impl(value) == 0);
         }
@@ -1085,7 +1291,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             operator==(T value, null_tag) noexcept {
             return impl::get_underlying_impl(value) == 0;
         }
@@ -1101,7 +1307,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             operator==(null_tag, T value) noexcept {
             return impl::get_underlying_impl(value) == 0;
         }
@@ -1114,7 +1320,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             operator!=(T value, null_tag) noexcept {
             return !(impl::get_underlying_impl(value) == 0);
         }
@@ -1127,7 +1333,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             operator!=(null_tag, T value) noexcept {
             return !(impl::get_underlying_impl(value) == 0);
         }
@@ -1145,9 +1351,9 @@ namespace boost {
             typename std::enable_if<IsEnabled<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr auto
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
             get_underlying(T value) noexcept -> decltype(impl::get_underlying_impl(value)) {
-            return impl::get_underlying_impl(value);
+            return impl::assume_in_domain<T>(impl::get_underlying_impl(value));
         }
 
 #if BOOST_FLAGS_HAS_CONCEPTS
@@ -1155,13 +1361,13 @@ namespace boost {
         template<typename T>
             requires IsEnabled<T>
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr auto
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
             from_underlying(typename std::underlying_type_t<enum_type_t<T>> value) noexcept {
             if constexpr (IsComplement<T>) {
                 return complement{ static_cast<enum_type_t<T>>(value) };
             }
             else {
-                return static_cast<enum_type_t<T>>(value);
+                return static_cast<enum_type_t<T>>(impl::assume_in_domain<T>(impl::check_domain<T>(value)));
             }
         }
 
@@ -1171,26 +1377,26 @@ namespace boost {
             template<typename T,
                 typename std::enable_if<!IsComplement<T>::value, int*>::type = nullptr >
             BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                constexpr auto
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
                 from_underlying_impl(typename std::underlying_type<enum_type_t<T>>::type value) noexcept -> enum_type_t<T> {
-                return static_cast<enum_type_t<T>>(value);
+                return static_cast<enum_type_t<T>>(assume_in_domain<T>(check_domain<T>(value)));
             }
 
             template<typename T,
                 typename std::enable_if<IsComplement<T>::value, int*>::type = nullptr >
             BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                constexpr auto
-                from_underlying_impl(typename std::underlying_type<enum_type_t<T>>::type value) noexcept -> complement<T> {
-                return complement<T>{ static_cast<enum_type_t<T>>(value) };
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
+                from_underlying_impl(typename std::underlying_type<enum_type_t<T>>::type value) noexcept -> complement<enum_type_t<T>> {
+                return complement<enum_type_t<T>>{ static_cast<enum_type_t<T>>(value) };
             }
         }
 
         template<typename T,
             typename std::enable_if<IsEnabled<T>::value, int*>::type = nullptr >
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr auto
-            from_underlying(typename std::underlying_type<enum_type_t<T>>::type value) noexcept -> decltype(impl::from_underlying_impl(value)) {
-            return impl::from_underlying_impl(value);
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
+            from_underlying(typename std::underlying_type<enum_type_t<T>>::type value) noexcept -> decltype(impl::from_underlying_impl<T>(value)) {
+            return impl::from_underlying_impl<T>(value);
         }
 
 #endif // BOOST_FLAGS_HAS_CONCEPTS
@@ -1221,7 +1427,7 @@ namespace boost {
             typename std::enable_if<IsCompatibleFlagsOrComplement<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool operator== (T1 e1, T2 e2) noexcept {
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool operator== (T1 e1, T2 e2) noexcept {
             return get_underlying(e1) == get_underlying(e2);
         }
 
@@ -1236,7 +1442,7 @@ namespace boost {
         template<typename T1, typename T2,
             typename std::enable_if<LogicalAndEnabled<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
-        constexpr bool operator&& (T1 lhs, T2 rhs) {
+        BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool operator&& (T1 lhs, T2 rhs) {
             return !!(lhs & rhs);
         }
 
@@ -1273,7 +1479,7 @@ namespace boost {
             typename std::enable_if<PreIncrementEnabled<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr auto
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto
             operator++(T arg) noexcept -> typename impl::make_bool_convertible<T>::type {
             using result_t = typename impl::make_bool_convertible<T>::type;
 
@@ -1305,16 +1511,39 @@ namespace boost {
                 typename std::enable_if<IsCompatibleFlagsOrComplement<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
             BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                constexpr auto operator()(T1 e1, T2 e2) const noexcept -> decltype(get_underlying(e1) < get_underlying(e2)) {
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr auto operator()(T1 e1, T2 e2) const noexcept -> decltype(get_underlying(e1) < get_underlying(e2)) {
                 return get_underlying(e1) < get_underlying(e2);
             }
 
             using is_transparent = int;
         };
+#if defined(__cpp_inline_variables)
+        // inline (external linkage) for exporting it from the module boost.flags
+        inline constexpr total_order_t total_order{};
+#else // defined(__cpp_inline_variables)
         static constexpr total_order_t total_order{};
+#endif // defined(__cpp_inline_variables)
 
 
-#define BOOST_FLAGS_EMPTY()
+        namespace impl {
+            // finalizer of MurmurHash3: every input bit affects every output bit, so the hashes of values
+            // differing in a few low bits are spread over the whole word (in contrast to the identity
+            // hash of std::hash for integers)
+            inline unsigned long long hash_mix(unsigned long long k) noexcept {
+                k ^= k >> 33;
+                k *= 0xff51afd7ed558ccdull;
+                k ^= k >> 33;
+                k *= 0xc4ceb9fe1a85ec53ull;
+                k ^= k >> 33;
+                return k;
+            }
+
+            template<typename T>
+            inline std::size_t hash_flags(T value) noexcept {
+                using unsigned_type = typename std::make_unsigned<typename std::underlying_type<enum_type_t<T>>::type>::type;
+                return static_cast<std::size_t>(hash_mix(static_cast<unsigned long long>(static_cast<unsigned_type>(get_underlying_impl(value)))));
+            }
+        } // namespace impl
 
 
 #if defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
@@ -1391,9 +1620,9 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
-            any(T e) noexcept {
-            return impl::get_underlying_impl(e) != 0;
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
+            any(T e BOOST_FLAGS_PROFILE_LOCATION_PARAM) noexcept {
+            return BOOST_FLAGS_PROFILE_TEST(impl::get_underlying_impl(e) != 0, boost_flags_location);
         }
 
 // none : test if no bit is set
@@ -1405,9 +1634,9 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
-            none(T e) noexcept {
-            return !e;
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
+            none(T e BOOST_FLAGS_PROFILE_LOCATION_PARAM) noexcept {
+            return BOOST_FLAGS_PROFILE_TEST(!e, boost_flags_location);
         }
 
 // subseteq : test if `subset` is contained in `superset`
@@ -1419,7 +1648,7 @@ namespace boost {
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             subseteq(T1 subset, T2 superset) noexcept {
             return (subset & superset) == subset;
         }
@@ -1433,7 +1662,7 @@ namespace boost {
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
             subset(T1 subset, T2 superset) noexcept {
             return subseteq(subset, superset) && (subset != superset);
         }
@@ -1447,9 +1676,9 @@ namespace boost {
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
-            intersect(T1 lhs, T2 rhs) noexcept {
-            return (impl::get_underlying_impl(lhs) & impl::get_underlying_impl(rhs)) != 0;
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
+            intersect(T1 lhs, T2 rhs BOOST_FLAGS_PROFILE_LOCATION_PARAM) noexcept {
+            return BOOST_FLAGS_PROFILE_TEST((impl::get_underlying_impl(lhs) & impl::get_underlying_impl(rhs)) != 0, boost_flags_location);
         }
 
 // disjoint : test if `lhs` and `rhs` are disjoint (have no common flag)
@@ -1461,9 +1690,9 @@ namespace boost {
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr bool
-            disjoint(T1 lhs, T2 rhs) noexcept {
-            return (impl::get_underlying_impl(lhs) & impl::get_underlying_impl(rhs)) == 0;
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
+            disjoint(T1 lhs, T2 rhs BOOST_FLAGS_PROFILE_LOCATION_PARAM) noexcept {
+            return BOOST_FLAGS_PROFILE_TEST((impl::get_underlying_impl(lhs) & impl::get_underlying_impl(rhs)) == 0, boost_flags_location);
         }
 
 // make_null : returns an empty instance of T
@@ -1475,7 +1704,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr enum_type_t<T>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr enum_type_t<T>
             make_null(T) noexcept {
             return static_cast<enum_type_t<T>>(0);
         }
@@ -1490,7 +1719,7 @@ namespace boost {
             typename std::enable_if<IsFlags<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr enum_type_t<T>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr enum_type_t<T>
             make_if(T e, bool set) noexcept {
             return static_cast<enum_type_t<T>>(set ? impl::get_underlying_impl(e) : 0);
         }
@@ -1504,7 +1733,7 @@ namespace boost {
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr enum_type_t<T1>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr enum_type_t<T1>
             modify(T1 value, T2 modification, bool set) noexcept {
             return set ? (value | modification) : (value & ~modification);
         }
@@ -1517,7 +1746,7 @@ namespace boost {
         template<typename T1, typename T2,
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
-        constexpr T1&
+        BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr T1&
             modify_inplace(T1& value, T2 modification, bool set) noexcept {
             // comma operator used to only have a return statement in the function (required for C++11)
             return (value = set ? (value | modification) : (value & ~modification)), value;
@@ -1532,7 +1761,7 @@ namespace boost {
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr enum_type_t<T1>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr enum_type_t<T1>
             add_if(T1 value, T2 modification, bool add) noexcept {
             return add ? (value | modification) : value;
         }
@@ -1545,7 +1774,7 @@ namespace boost {
         template<typename T1, typename T2,
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
-        constexpr T1&
+        BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr T1&
             add_if_inplace(T1& value, T2 modification, bool add) noexcept {
             // comma operator used to only have a return statement in the function (required for C++11)
             return (value = add ? (value | modification) : value), value;
@@ -1560,7 +1789,7 @@ namespace boost {
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr enum_type_t<T1>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr enum_type_t<T1>
             remove_if(T1 value, T2 modification, bool remove) noexcept {
             return remove ? value & ~modification : value;
         }
@@ -1573,13 +1802,94 @@ namespace boost {
         template<typename T1, typename T2,
             typename std::enable_if<IsCompatibleFlags<T1, T2>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
-        constexpr T1&
+        BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr T1&
             remove_if_inplace(T1& value, T2 modification, bool remove) noexcept {
             // comma operator used to only have a return statement in the function (required for C++11)
             return (value = remove ? (value & ~modification) : value), value;
         }
 
 
+        namespace impl {
+
+            // unsigned underlying type of an enabled enum, the type of field values
+            template<typename T>
+            using field_value_t = typename std::make_unsigned<typename std::underlying_type<enum_type_t<T>>::type>::type;
+
+            template<typename T>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr field_value_t<T> field_bits(T value) noexcept {
+                return static_cast<field_value_t<T>>(get_underlying_impl(value));
+            }
+
+            // multiplying / dividing by the lowest bit of a constant mask compiles to a shift
+            template<typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U lowest_bit(U mask) noexcept {
+                return static_cast<U>(mask & (~mask + 1u));
+            }
+
+            template<typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U get_field_impl(U value, U mask) noexcept {
+                // comma operator used to only have a return statement in the function (required for C++11)
+                return BOOST_FLAGS_ASSERT(is_field_mask(mask) && "the mask of a field must be non-empty and contiguous"),
+                    static_cast<U>((value & mask) / lowest_bit(mask));
+            }
+
+            template<typename U>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr U set_field_impl(U value, U mask, U field) noexcept {
+                return BOOST_FLAGS_ASSERT(is_field_mask(mask) && "the mask of a field must be non-empty and contiguous"),
+                    BOOST_FLAGS_ASSERT(field <= mask / lowest_bit(mask) && "the value does not fit into the field"),
+                    static_cast<U>((value & ~mask) | ((field * lowest_bit(mask)) & mask));
+            }
+
+            template<typename T>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr enum_type_t<T> from_field_bits(field_value_t<T> bits) noexcept {
+                return static_cast<enum_type_t<T>>(static_cast<typename std::underlying_type<enum_type_t<T>>::type>(bits));
+            }
+
+        } // namespace impl
+
+// get_field : returns the value of the field `mask` (contiguous bits, cf. bit_fields) of `value` shifted to bit 0
+#if BOOST_FLAGS_HAS_CONCEPTS
+        template<typename T>
+            requires IsFlags<T> && std::is_enum<T>::value
+#else // BOOST_FLAGS_HAS_CONCEPTS
+        template<typename T,
+            typename std::enable_if<IsFlags<T>::value && std::is_enum<T>::value, int*>::type = nullptr >
+#endif // BOOST_FLAGS_HAS_CONCEPTS
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr impl::field_value_t<T>
+            get_field(T value, T mask) noexcept {
+            return impl::get_field_impl(impl::field_bits(value), impl::field_bits(mask));
+        }
+
+// set_field : return a copy of `value` with the field `mask` replaced by `field` (which must fit into the field)
+#if BOOST_FLAGS_HAS_CONCEPTS
+        template<typename T>
+            requires IsFlags<T> && std::is_enum<T>::value
+#else // BOOST_FLAGS_HAS_CONCEPTS
+        template<typename T,
+            typename std::enable_if<IsFlags<T>::value && std::is_enum<T>::value, int*>::type = nullptr >
+#endif // BOOST_FLAGS_HAS_CONCEPTS
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr T
+            set_field(T value, T mask, impl::field_value_t<T> field) noexcept {
+            return impl::from_field_bits<T>(impl::set_field_impl(impl::field_bits(value), impl::field_bits(mask), field));
+        }
+
+// modify_field : replaces the field `mask` of `value` by `field` (which must fit into the field) in-place
+#if BOOST_FLAGS_HAS_CONCEPTS
+        template<typename T>
+            requires IsFlags<T> && std::is_enum<T>::value
+#else // BOOST_FLAGS_HAS_CONCEPTS
+        template<typename T,
+            typename std::enable_if<IsFlags<T>::value && std::is_enum<T>::value, int*>::type = nullptr >
+#endif // BOOST_FLAGS_HAS_CONCEPTS
+        BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr T&
+            modify_field(T& value, T mask, impl::field_value_t<T> field) noexcept {
+            // comma operator used to only have a return statement in the function (required for C++11)
+            return (value = impl::from_field_bits<T>(impl::set_field_impl(impl::field_bits(value), impl::field_bits(mask), field))), value;
+        }
+
+
 // implementations of operator& for pseudo-and-operator BOOST_FLAGS_AND
 #if BOOST_FLAGS_HAS_CONCEPTS
         template<typename T>
@@ -1589,9 +1899,14 @@ namespace boost {
             typename std::enable_if<IsEnabled<T>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
         BOOST_FLAGS_ATTRIBUTE_NODISCARD
-            constexpr impl::pseudo_and_op_intermediate_t<T>
+            BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr impl::pseudo_and_op_intermediate_t<T>
+#if BOOST_FLAGS_PROFILE
+            operator&(T lhs, pseudo_and_op_tag tag) noexcept {
+            return { lhs, tag.location };
+#else // BOOST_FLAGS_PROFILE
             operator&(T lhs, pseudo_and_op_tag) noexcept {
             return { lhs };
+#endif // BOOST_FLAGS_PROFILE
         }
 
         namespace impl {
@@ -1603,9 +1918,9 @@ namespace boost {
                 typename std::enable_if<LogicalOperationEnabled<T1, T2, impl::conjunction>::value, int*>::type = nullptr >
 #endif // BOOST_FLAGS_HAS_CONCEPTS
             BOOST_FLAGS_ATTRIBUTE_NODISCARD
-                constexpr bool
+                BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr bool
                 operator&(pseudo_and_op_intermediate_t<T1> lhs, T2 rhs) noexcept {
-                return (impl::get_underlying_impl(lhs.value) & impl::get_underlying_impl(rhs)) != 0;
+                return BOOST_FLAGS_PROFILE_TEST((impl::get_underlying_impl(lhs.value) & impl::get_underlying_impl(rhs)) != 0, lhs.location);
             }
 
 
@@ -1642,850 +1957,23 @@ namespace boost {
             BOOST_FLAGS_CONSTEVAL inline bool has_option_disable_complement(options v) { return (v & options::disable_complement) != 0; }
             BOOST_FLAGS_CONSTEVAL inline bool has_option_logical_and(options v) { return (v & options::logical_and) != 0; }
             BOOST_FLAGS_CONSTEVAL inline bool has_option_pre_increment(options v) { return (v & options::pre_increment) != 0; }
+            BOOST_FLAGS_CONSTEVAL inline bool has_option_assume_domain(options v) { return (v & options::assume_domain) != 0; }
+            BOOST_FLAGS_CONSTEVAL inline bool has_option_check_assert(options v) { return (v & options::check_assert) != 0; }
+            BOOST_FLAGS_CONSTEVAL inline bool has_option_check_mask(options v) { return (v & options::check_mask) != 0; }
+            BOOST_FLAGS_CONSTEVAL inline bool has_option_check_trap(options v) { return (v & options::check_trap) != 0; }
 
         }
         using impl::has_option_enable;
         using impl::has_option_disable_complement;
         using impl::has_option_logical_and;
         using impl::has_option_pre_increment;
+        using impl::has_option_assume_domain;
+        using impl::has_option_check_assert;
+        using impl::has_option_check_mask;
+        using impl::has_option_check_trap;
 
 
     }
 }
 
-
-///////////////////////////////////////////////////////////////////////////////////////
-//
-// macros
-//
-
-
-
-// NOTE: The forwarding operators deliberately do not use concepts/SFINAE, as this will generate
-// ambiguity errors if the operators are also found via `using`-declarations.
-// Specifying the enum type directly as parameter type ensures that these overloads are 
-// distinguishable from the templates in namespace boost::flags.
-
-#define BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, op, RET)                                     \
-BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(E l, E r) noexcept {               \
-    return ::boost::flags::operator op(l, r);                                                       \
-}                                                                                                   \
-
-#define BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, op, RET)                                      \
-BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(E v) noexcept {                    \
-    return ::boost::flags::operator op(v);                                                          \
-}                                                                                                   \
-
-#define BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, op)                                      \
-FRIEND constexpr E& operator op(E& l, E r) noexcept {                                               \
-    return ::boost::flags::operator op(l, r);                                                       \
-}                                                                                                   \
-
-
-// NOTE: The deleted forwarding operators must use concepts/SFINAE, as these may not be
-// instantiated and otherwise would lead to hard errors
-
-#if BOOST_FLAGS_HAS_CONCEPTS
-
-#define BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, op, RET)                                      \
-template<typename T> requires std::is_same<T, E>::value                                             \
-BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(T l, T r) noexcept {               \
-    return ::boost::flags::operator op(l, r);                                                       \
-}                                                                                                   \
-
-#define BOOST_FLAGS_DELETE_UNARY_OPERATOR(E, FRIEND, op, RET)                                       \
-template<typename T> requires std::is_same<T, E>::value                                             \
-BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(T v) noexcept {                    \
-    return ::boost::flags::operator op(v);                                                          \
-}                                                                                                   \
-
-#define BOOST_FLAGS_DELETE_ASSIGNMENT_OPERATOR(E, FRIEND, op)                                       \
-template<typename T> requires std::is_same<T, E>::value                                             \
-FRIEND constexpr E& operator op(T& l, T r) noexcept {                                               \
-    return ::boost::flags::operator op(l, r);                                                       \
-}                                                                                                   \
-
-#else // BOOST_FLAGS_HAS_CONCEPTS
-
-#define BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, op, RET)                                      \
-template<typename T, typename std::enable_if<std::is_same<T, E>::value, int*>::type = nullptr>      \
-BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(T l, T r) noexcept {               \
-    return ::boost::flags::operator op(l, r);                                                       \
-}                                                                                                   \
-
-#define BOOST_FLAGS_DELETE_UNARY_OPERATOR(E, FRIEND, op, RET)                                       \
-template<typename T, typename std::enable_if<std::is_same<T, E>::value, int*>::type = nullptr>      \
-BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(T v) noexcept {                    \
-    return ::boost::flags::operator op(v);                                                          \
-}                                                                                                   \
-
-#define BOOST_FLAGS_DELETE_ASSIGNMENT_OPERATOR(E, FRIEND, op)                                       \
-template<typename T, typename std::enable_if<std::is_same<T, E>::value, int*>::type = nullptr>      \
-FRIEND constexpr E& operator op(T& l, T r) noexcept {                                               \
-    return ::boost::flags::operator op(l, r);                                                       \
-}                                                                                                   \
-
-#endif // BOOST_FLAGS_HAS_CONCEPTS
-
-
-
-
-
-#if !(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
-
-#define BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, op, RET)                                   \
-BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND                                                              \
-constexpr RET operator op(E l, std::nullptr_t r) noexcept {                                         \
-    return ::boost::flags::operator op(l, r);                                                       \
-}                                                                                                   \
-BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND                                                              \
-constexpr RET operator op(std::nullptr_t l, E r) noexcept {                                         \
-    return ::boost::flags::operator op(l, r);                                                       \
-}                                                                                                   \
-
-
-# define BOOST_FLAGS_USING_OPERATOR_NOT_EQUAL   using ::boost::flags::operator!=;
-# define BOOST_FLAGS_FORWARD_OPERATOR_NOT_EQUAL(E, FRIEND)                                          \
-BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, !=, bool)
-
-#else // !(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
-
-#define BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, op, RET)                                   \
-BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND                                                              \
-constexpr RET operator op(E l, std::nullptr_t r) noexcept {                                         \
-    return ::boost::flags::operator op(l, r);                                                       \
-}                                                                                                   \
-
-
-# define BOOST_FLAGS_USING_OPERATOR_NOT_EQUAL
-# define BOOST_FLAGS_FORWARD_OPERATOR_NOT_EQUAL(E, FRIEND)
-
-
-#endif // !(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
-
-#if BOOST_FLAGS_HAS_PARTIAL_ORDERING
-
-# define BOOST_FLAGS_USING_OPERATOR_SPACESHIP using ::boost::flags::operator<=>;
-# define BOOST_FLAGS_FORWARD_OPERATOR_SPACESHIP(E, FRIEND)                                          \
-BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, <=>, std::partial_ordering)
-
-#else // BOOST_FLAGS_HAS_PARTIAL_ORDERING
-# define BOOST_FLAGS_USING_OPERATOR_SPACESHIP
-# define BOOST_FLAGS_FORWARD_OPERATOR_SPACESHIP(E, FRIEND)
-#endif // BOOST_FLAGS_HAS_PARTIAL_ORDERING
-
-#if defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
-
-#define BOOST_FLAGS_USING_OPERATORS()                                                               \
-using ::boost::flags::operator|;                                                                    \
-using ::boost::flags::operator&;                                                                    \
-using ::boost::flags::operator^;                                                                    \
-using ::boost::flags::operator~;                                                                    \
-using ::boost::flags::operator|=;                                                                   \
-using ::boost::flags::operator&=;                                                                   \
-using ::boost::flags::operator^=;                                                                   \
-using ::boost::flags::operator!;                                                                    \
-using ::boost::flags::operator==;                                                                   \
-BOOST_FLAGS_USING_OPERATOR_NOT_EQUAL                                                                \
-BOOST_FLAGS_USING_OPERATOR_SPACESHIP                                                                \
-using ::boost::flags::operator&&;                                                                   \
-using ::boost::flags::operator||;                                                                   \
-using ::boost::flags::operator++;                                                                   \
-using ::boost::flags::operator-;                                                                    \
-using ::boost::flags::operator*;                                                                    \
-using ::boost::flags::operator/;                                                                    \
-using ::boost::flags::operator%;                                                                    \
-using ::boost::flags::operator<<;                                                                   \
-using ::boost::flags::operator>>;                                                                   \
-
-#else // defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
-
-#define BOOST_FLAGS_USING_OPERATORS()                                                               \
-using ::boost::flags::operator|;                                                                    \
-using ::boost::flags::operator&;                                                                    \
-using ::boost::flags::operator^;                                                                    \
-using ::boost::flags::operator~;                                                                    \
-using ::boost::flags::operator|=;                                                                   \
-using ::boost::flags::operator&=;                                                                   \
-using ::boost::flags::operator^=;                                                                   \
-using ::boost::flags::operator!;                                                                    \
-using ::boost::flags::operator==;                                                                   \
-BOOST_FLAGS_USING_OPERATOR_NOT_EQUAL                                                                \
-BOOST_FLAGS_USING_OPERATOR_SPACESHIP                                                                \
-using ::boost::flags::operator&&;                                                                   \
-using ::boost::flags::operator||;                                                                   \
-using ::boost::flags::operator++;                                                                   \
-
-#endif // defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
-
-#define BOOST_FLAGS_USING_UTILITIES()                                                               \
-using ::boost::flags::any;                                                                          \
-using ::boost::flags::none;                                                                         \
-using ::boost::flags::subseteq;                                                                     \
-using ::boost::flags::subset;                                                                       \
-using ::boost::flags::intersect;                                                                    \
-using ::boost::flags::disjoint;                                                                     \
-using ::boost::flags::make_null;                                                                    \
-using ::boost::flags::make_if;                                                                      \
-using ::boost::flags::modify;                                                                       \
-using ::boost::flags::modify_inplace;                                                               \
-using ::boost::flags::add_if;                                                                       \
-using ::boost::flags::add_if_inplace;                                                               \
-using ::boost::flags::remove_if;                                                                    \
-using ::boost::flags::remove_if_inplace;                                                            \
-using ::boost::flags::get_underlying;                                                               \
-
-#define BOOST_FLAGS_USING_ALL()                                                                     \
-BOOST_FLAGS_USING_OPERATORS()                                                                       \
-BOOST_FLAGS_USING_UTILITIES()                                                                       \
-
-
-
-#if defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
-
-#define BOOST_FLAGS_FORWARD_OPERATORS_IMPL(E, C, FRIEND)                                            \
-BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, |, E)                                                \
-BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, &, E)                                                \
-BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, ^, E)                                                \
-BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, ~, C)                                                 \
-BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, |=)                                              \
-BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, &=)                                              \
-BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, ^=)                                              \
-BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, !, bool)                                              \
-BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, ==, bool)                                          \
-BOOST_FLAGS_FORWARD_OPERATOR_NOT_EQUAL(E, FRIEND)                                                   \
-BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, +, unsigned int)                                      \
-BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, -, unsigned int)                                      \
-BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, *, unsigned int)                                      \
-BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, / , unsigned int)                                     \
-BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, %, unsigned int)                                      \
-BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, << , unsigned int)                                    \
-BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, >> , unsigned int)                                    \
-
-#else // defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
-
-#define BOOST_FLAGS_FORWARD_OPERATORS_IMPL(E, C, FRIEND)                                            \
-BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, |, E)                                                \
-BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, &, E)                                                \
-BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, ^, E)                                                \
-BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, ~, C)                                                 \
-BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, |=)                                              \
-BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, &=)                                              \
-BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, ^=)                                              \
-BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, !, bool)                                              \
-BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, ==, bool)                                          \
-BOOST_FLAGS_FORWARD_OPERATOR_NOT_EQUAL(E, FRIEND)                                                   \
-
-#endif // defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
-
-
-#define BOOST_FLAGS_FORWARD_OPERATORS(E)                                                            \
-BOOST_FLAGS_FORWARD_OPERATORS_IMPL(E, ::boost::flags::complement<E>, BOOST_FLAGS_EMPTY())
-
-#define BOOST_FLAGS_FORWARD_OPERATORS_LOCAL(E)                                                      \
-BOOST_FLAGS_FORWARD_OPERATORS_IMPL(E, ::boost::flags::complement<E>, friend)
-
-
-#define BOOST_FLAGS_SPECIALIZE_STD_LESS(E)                                                          \
- /* specialize std::less for E and complement<E> */                                                 \
- /* at least gcc < version 7 is not conforming with template specialization */                      \
- /* put it explicitly into namespace std to make them all happy */                                  \
-namespace std {                                                                                     \
-    template<>                                                                                      \
-    struct less<E> {                                                                                \
-        BOOST_FLAGS_ATTRIBUTE_NODISCARD                                                             \
-            constexpr bool operator()(E const& lhs, E const& rhs) const noexcept {                  \
-            return boost::flags::total_order(lhs, rhs);                                             \
-        }                                                                                           \
-    };                                                                                              \
-    template<>                                                                                      \
-    struct less<boost::flags::complement<E>> {                                                      \
-        BOOST_FLAGS_ATTRIBUTE_NODISCARD                                                             \
-            constexpr bool operator()(                                                              \
-                boost::flags::complement<E> const& lhs,                                             \
-                boost::flags::complement<E> const& rhs                                              \
-                ) const noexcept {                                                                  \
-            return boost::flags::total_order(lhs, rhs);                                             \
-        }                                                                                           \
-    };                                                                                              \
-} /* namespace std */
-
-#if !(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
-
-#if BOOST_FLAGS_HAS_CONCEPTS
-
-#define BOOST_FLAGS_DELETE_REL_IMPL(E, FRIEND)                                                      \
-/* matches better than built-in relational operators */                                             \
-FRIEND bool operator< (E l, E r) = delete;                                                          \
-FRIEND bool operator<= (E l, E r) = delete;                                                         \
-FRIEND bool operator> (E l, E r) = delete;                                                          \
-FRIEND bool operator>= (E l, E r) = delete;                                                         \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2>                                                                  \
-    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
-    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
-FRIEND bool operator< (T1 l, T2 r) = delete;                                                        \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2>                                                                  \
-    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
-    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
-FRIEND bool operator<= (T1 l, T2 r) = delete;                                                       \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2>                                                                  \
-    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
-    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
-FRIEND bool operator> (T1 l, T2 r) = delete;                                                        \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2>                                                                  \
-    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
-    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
-FRIEND bool operator>= (T1 l, T2 r) = delete;                                                       \
-                                                                                                    \
-
-
-
-#else // BOOST_FLAGS_HAS_CONCEPTS
-
-#define BOOST_FLAGS_DELETE_REL_IMPL(E, FRIEND)                                                      \
-/* matches better than built-in relational operators */                                             \
-FRIEND bool operator< (E l, E r) = delete;                                                          \
-FRIEND bool operator<= (E l, E r) = delete;                                                         \
-FRIEND bool operator> (E l, E r) = delete;                                                          \
-FRIEND bool operator>= (E l, E r) = delete;                                                         \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2,                                                                  \
-    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
-    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
-FRIEND bool operator< (T1 l, T2 r) = delete;                                                        \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2,                                                                  \
-    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
-    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
-FRIEND bool operator<= (T1 l, T2 r) = delete;                                                       \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2,                                                                  \
-    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
-    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
-FRIEND bool operator> (T1 l, T2 r) = delete;                                                        \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2,                                                                  \
-    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
-    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
-FRIEND bool operator>= (T1 l, T2 r) = delete;                                                       \
-                                                                                                    \
-
-
-#endif // BOOST_FLAGS_HAS_CONCEPTS
-
-
-#else // !(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
-
-#if BOOST_FLAGS_HAS_CONCEPTS
-
-#define BOOST_FLAGS_DELETE_REL_IMPL(E, FRIEND)                                                      \
-/* matches better than built-in relational operators */                                             \
-FRIEND bool operator< (E l, E r) = delete;                                                          \
-FRIEND bool operator<= (E l, E r) = delete;                                                         \
-FRIEND bool operator> (E l, E r) = delete;                                                          \
-FRIEND bool operator>= (E l, E r) = delete;                                                         \
-FRIEND std::partial_ordering operator<=> (E l, E r) = delete;                                       \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2>                                                                  \
-    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
-    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
-FRIEND bool operator< (T1 l, T2 r) = delete;                                                        \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2>                                                                  \
-    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
-    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
-FRIEND bool operator<= (T1 l, T2 r) = delete;                                                       \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2>                                                                  \
-    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
-    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
-FRIEND bool operator> (T1 l, T2 r) = delete;                                                        \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2>                                                                  \
-    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
-    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
-FRIEND bool operator>= (T1 l, T2 r) = delete;                                                       \
-                                                                                                    \
-template<typename T1, typename T2>                                                                  \
-    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
-              std::is_same_v<E, boost::flags::enum_type_t<T2>> )                                    \
-FRIEND std::partial_ordering operator<=> (T1 l, T2 r) = delete;                                     \
-
-
-#else // BOOST_FLAGS_HAS_CONCEPTS
-
-#define BOOST_FLAGS_DELETE_REL_IMPL(E, FRIEND)                                                      \
-/* matches better than built-in relational operators */                                             \
-FRIEND bool operator< (E l, E r) = delete;                                                          \
-FRIEND bool operator<= (E l, E r) = delete;                                                         \
-FRIEND bool operator> (E l, E r) = delete;                                                          \
-FRIEND bool operator>= (E l, E r) = delete;                                                         \
-FRIEND std::partial_ordering operator<=> (E l, E r) = delete;                                       \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2,                                                                  \
-    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
-    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
-FRIEND bool operator< (T1 l, T2 r) = delete;                                                        \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2,                                                                  \
-    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
-    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
-FRIEND bool operator<= (T1 l, T2 r) = delete;                                                       \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2,                                                                  \
-    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
-    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
-FRIEND bool operator> (T1 l, T2 r) = delete;                                                        \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2,                                                                  \
-    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
-    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
-FRIEND bool operator>= (T1 l, T2 r) = delete;                                                       \
-                                                                                                    \
-/* matches all other E, complement<E> arguments */                                                  \
-template<typename T1, typename T2,                                                                  \
-    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
-    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
-FRIEND std::partial_ordering operator<=> (T1 l, T2 r) = delete;                                     
-
-
-#endif // BOOST_FLAGS_HAS_CONCEPTS
-
-#endif // !(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
-
-#define BOOST_FLAGS_DELETE_REL(E)                                                                   \
-BOOST_FLAGS_DELETE_REL_IMPL(E, BOOST_FLAGS_EMPTY())
-#define BOOST_FLAGS_LOCAL_DELETE_REL(E)  BOOST_FLAGS_DELETE_REL_IMPL(E, friend)
-
-
-#define BOOST_FLAGS_PSEUDO_AND_OPERATOR & boost::flags::pseudo_and_op_tag{} &
-
-#define BOOST_FLAGS_AND  BOOST_FLAGS_PSEUDO_AND_OPERATOR
-
-#define BOOST_FLAGS_NULL boost::flags::null_tag{}
-
-
-
-// enabling macro for enum E at namespace scope
-#define BOOST_FLAGS_ENABLE_EX(E, OPTS)                                                              \
-    BOOST_FLAGS_CONSTEVAL inline                                                                    \
-    boost::flags::options_constant<OPTS> boost_flags_enable(E) {                                    \
-        return {};                                                                                  \
-    }                                                                                               \
-
-#define BOOST_FLAGS_ENABLE(E)                                                                       \
-    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable)                                         \
-    BOOST_FLAGS_USING_OPERATORS()                                                                   \
-
-#define BOOST_FLAGS_ENABLE_DISABLE_COMPLEMENT(E)                                                    \
-    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
-        boost::flags::options::disable_complement)                                                  \
-    BOOST_FLAGS_USING_OPERATORS()                                                                   \
-
-#define BOOST_FLAGS_ENABLE_DISABLE_COMPLEMENT_LOGICAL_AND(E)                                        \
-    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
-        boost::flags::options::disable_complement | boost::flags::options::logical_and)             \
-    BOOST_FLAGS_USING_OPERATORS()                                                                   \
-
-#define BOOST_FLAGS_ENABLE_LOGICAL_AND(E)                                                           \
-    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
-        boost::flags::options::logical_and)                                                         \
-    BOOST_FLAGS_USING_OPERATORS()                                                                   \
-
-#define BOOST_FLAGS_ENABLE_PRE_INCREMENT(E)                                                         \
-    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
-        boost::flags::options::pre_increment)                                                       \
-    BOOST_FLAGS_USING_OPERATORS()                                                                   \
-
-#define BOOST_FLAGS_ENABLE_DISABLE_COMPLEMENT_PRE_INCREMENT(E)                                      \
-    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
-        boost::flags::options::disable_complement | boost::flags::options::pre_increment)           \
-    BOOST_FLAGS_USING_OPERATORS()                                                                   \
-
-#define BOOST_FLAGS_ENABLE_DISABLE_COMPLEMENT_LOGICAL_AND_PRE_INCREMENT(E)                          \
-    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
-        boost::flags::options::disable_complement | boost::flags::options::logical_and |            \
-        boost::flags::options::pre_increment)                                                       \
-    BOOST_FLAGS_USING_OPERATORS()                                                                   \
-
-#define BOOST_FLAGS_ENABLE_LOGICAL_AND_PRE_INCREMENT(E)                                             \
-    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
-        boost::flags::options::logical_and | boost::flags::options::pre_increment)                  \
-    BOOST_FLAGS_USING_OPERATORS()                                                                   \
-
-
-// enabling macro for enum E at class scope
-#define BOOST_FLAGS_ENABLE_LOCAL_EX(E, OPTS)                                                        \
-    friend BOOST_FLAGS_CONSTEVAL inline                                                             \
-    boost::flags::options_constant<OPTS> boost_flags_enable(E) {                                    \
-        return {};                                                                                  \
-    }                                                                                               \
-    BOOST_FLAGS_FORWARD_OPERATORS_LOCAL(E)                                                          \
-
-
-#define BOOST_FLAGS_ENABLE_LOCAL(E)                                                                 \
-    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable)                                   \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT(E)                                              \
-    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
-        boost::flags::options::disable_complement)                                                  \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_LOGICAL_AND(E)                                  \
-    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
-        boost::flags::options::disable_complement | boost::flags::options::logical_and)             \
-    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_LOGICAL_AND(E)                                                     \
-    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
-        boost::flags::options::logical_and)                                                         \
-    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_PRE_INCREMENT(E)                                                   \
-    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
-        boost::flags::options::pre_increment)                                                       \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_PRE_INCREMENT(E)                                \
-    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
-        boost::flags::options::disable_complement | boost::flags::options::pre_increment)           \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_LOGICAL_AND_PRE_INCREMENT(E)                    \
-    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
-        boost::flags::options::disable_complement | boost::flags::options::logical_and |            \
-        boost::flags::options::pre_increment)                                                       \
-    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_LOGICAL_AND_PRE_INCREMENT(E)                                       \
-    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
-        boost::flags::options::logical_and | boost::flags::options::pre_increment)                  \
-    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
-
-
-
-
-#define BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, OPTS)                                          \
-    friend BOOST_FLAGS_CONSTEVAL inline                                                             \
-    boost::flags::options_constant<OPTS> boost_flags_enable(E) {                                    \
-        return {};                                                                                  \
-    }                                                                                               \
-
-
-#define BOOST_FLAGS_ENABLE_LOCAL_NO_FORWARDING(E)                                                   \
-    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable)                     \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_NO_FORWARDING(E)                                \
-    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
-        boost::flags::options::disable_complement)                                                  \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_LOGICAL_AND_NO_FORWARDING(E)                    \
-    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
-        boost::flags::options::disable_complement | boost::flags::options::logical_and)             \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_LOGICAL_AND_NO_FORWARDING(E)                                       \
-    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
-        boost::flags::options::logical_and)                                                         \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_PRE_INCREMENT_NO_FORWARDING(E)                                     \
-    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
-        boost::flags::options::pre_increment)                                                       \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_PRE_INCREMENT_NO_FORWARDING(E)                  \
-    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
-        boost::flags::options::disable_complement | boost::flags::options::pre_increment)           \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_LOGICAL_AND_PRE_INCREMENT_NO_FORWARDING(E)      \
-    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
-        boost::flags::options::disable_complement | boost::flags::options::logical_and |            \
-        boost::flags::options::pre_increment)                                                       \
-
-#define BOOST_FLAGS_ENABLE_LOCAL_LOGICAL_AND_PRE_INCREMENT_NO_FORWARDING(E)                         \
-    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
-        boost::flags::options::logical_and | boost::flags::options::pre_increment)                  \
-
-
-/////////////////////////////////////////////////////////////////////////////////////////////////////
-//
-// VARIADIC MACRO:  BOOST_FLAGS(E, ...)
-//
-// This macro allows to specify all options within a single macro invocation. Its syntax is
-// 
-// BOOST_FLAGS(E, OPTIONS)
-// 
-// where OPTIONS is an optional comma separated list (if OPTIONS is empty the comma after E may be omitted)
-// containing at most one of each of the following options:
-// - BOOST_FLAGS_LOGICAL_AND            : enable operator&& for enum E
-// - BOOST_FLAGS_PRE_INCREMENT               : enable unary operator++ for enum E
-// - BOOST_FLAGS_DISABLE_COMPLEMENT     : disable 'complement' template for enum E
-// - BOOST_FLAGS_NO_FORWARDING          : do not forward operators when using BOOST_FLAGS_LOCAL (has no effect for BOOST_FLAGS)
-//                                        This is required when using operators from namespace boost::flags inside classes 
-//                                        (through usage of BOOST_FLAGS(...) or BOOST_FLAGS_USING_OPERATORS(...) in classes
-//                                        namespace before its definition). See documentation for further details.
-//  
-// furthermore at most one of the following relational-operator options may be specified:
-// - BOOST_FLAGS_DEFAULT_REL            : use operators <, <=, >, >= and <=> as specified by the C++ standard
-// - BOOST_FLAGS_DELETE_REL             : delete operators <, <=, >, >= and <=> if at least one argument is of type E (or `complement`s of E)
-//
-// If no relational-operator option is specified, the macro defaults to using BOOST_FLAGS_DEFAULT_REL
-// 
-// When you encounter errors using BOOST_FLAGS(E, ...) this can have multiple reasons (list is NOT exhaustive)
-//
-// - the invoked preprocessor is not standard conforming to at least C++11
-// - misspelling one of the options
-// - forgetting a comma or specifying a comma too much
-// - specifying the same options more than once
-// - specifying more than one relational-operator option
-//
-
-#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_LOGICAL_AND(NAME, ...)                                    \
-| boost::flags::options::logical_and BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_PRE_INCREMENT(NAME, ...)                                  \
-| boost::flags::options::pre_increment BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                             \
-| boost::flags::options::disable_complement BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_NO_FORWARDING(NAME, ...)                                  \
-BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                                    \
-BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_DELETE_REL(NAME, ...)                                     \
-BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_OP_(...) 
-#define BOOST_FLAGS_EXPAND_OPS(NAME, ...) BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
-
-
-// needed for BOOST_FLAGS_LOCAL
-#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_LOGICAL_AND(NAME, ...) 1
-#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_PRE_INCREMENT(NAME, ...)                         \
-BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                    \
-BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_NO_FORWARDING(NAME, ...)                         \
-BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                           \
-BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_DELETE_REL(NAME, ...)                            \
-BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_(...) 0
-#define BOOST_FLAGS_HAS_LOGICAL_AND_OP(NAME, ...)                                                   \
-BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
-
-// needed for BOOST_FLAGS_LOCAL
-#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_PRE_INCREMENT(NAME, ...) 1
-#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_LOGICAL_AND(NAME, ...)                         \
-BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                  \
-BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_NO_FORWARDING(NAME, ...)                       \
-BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                         \
-BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_DELETE_REL(NAME, ...)                          \
-BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_(...) 0
-#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP(NAME, ...)                                                 \
-BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
-
-// needed for BOOST_FLAGS_LOCAL
-#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_NO_FORWARDING(NAME, ...) 1 
-#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_LOGICAL_AND(NAME, ...)                             \
-BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__)
-
-#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_PRE_INCREMENT(NAME, ...)                           \
-BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__)
-
-#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                      \
-BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                             \
-BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_DELETE_REL(NAME, ...)                              \
-BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_IS_NO_FORWARDING_(...) 0
-#define BOOST_FLAGS_IS_NO_FORWARDING(NAME, ...)                                                     \
-BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
-
-
-#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_LOGICAL_AND(NAME, ...)                                   \
-BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_PRE_INCREMENT(NAME, ...)                                 \
-BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                            \
-BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_NO_FORWARDING(NAME, ...)                                 \
-BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                                   \
-BOOST_FLAGS_GENERATE_DEFAULT_REL BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_DELETE_REL(NAME, ...)                                    \
-BOOST_FLAGS_GENERATE_DELETE_REL BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
-
-#define BOOST_FLAGS_EXPAND_REL_(...) 
-#define BOOST_FLAGS_EXPAND_RELS(NAME, ...) BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
-
-
-
-#define BOOST_FLAGS_GENERATE_OPS(E, OPS)                                                            \
-    BOOST_FLAGS_CONSTEVAL inline                                                                    \
-    boost::flags::options_constant<boost::flags::options::enable OPS>                               \
-    boost_flags_enable(E) {                                                                         \
-        return {};                                                                                  \
-    }                                                                                               \
-
-
-// this is the default case, when no relation-option is specified
-#define BOOST_FLAGS_GENERATE_REL_(E)                                                                \
-    BOOST_FLAGS_GENERATE_REL_BOOST_FLAGS_GENERATE_DEFAULT_REL(E)
-
-#define BOOST_FLAGS_GENERATE_REL_BOOST_FLAGS_GENERATE_DEFAULT_REL(E)                                \
-
-#define BOOST_FLAGS_GENERATE_REL_BOOST_FLAGS_GENERATE_DELETE_REL(E)                                 \
-    BOOST_FLAGS_DELETE_REL(E)
-
-
-// for better diagnostics, when more than one relational operation options is specified
-#define BOOST_FLAGS_GENERATE_DEFAULT_REL(E) ;                                                       \
-static_assert(false, "multiple relational operation options specified");
-
-#define BOOST_FLAGS_GENERATE_DELETE_REL(E) ;                                                        \
-static_assert(false, "multiple relational operation options specified");
-
-
-
-// forward once to enforce expansion
-#define BOOST_FLAGS_GENERATE_REL2(E, REL) BOOST_FLAGS_GENERATE_REL_##REL(E)
-
-#define BOOST_FLAGS_GENERATE_REL(E, REL) BOOST_FLAGS_GENERATE_REL2(E, REL)
-
-
-// please see comment above about usage and possible errors with the variadic macro BOOST_FLAGS(E, ...)
-
-#define BOOST_FLAGS(E, ...)                                                                         \
-    BOOST_FLAGS_GENERATE_OPS(E, BOOST_FLAGS_EXPAND_OPS(__VA_ARGS__))                                \
-    BOOST_FLAGS_GENERATE_REL(E, BOOST_FLAGS_EXPAND_RELS(__VA_ARGS__))                               \
-    BOOST_FLAGS_USING_OPERATORS()                                                                   \
-
-
-// additional macros for BOOST_FLAGS_LOCAL
-
-#define BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_0(E)
-
-#define BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_1(E)                                         \
-    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
-
-
-#define BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_(E, VALUE)                                   \
-    BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_##VALUE(E)
-
-#define BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD(E, VALUE)                                    \
-    BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_(E, VALUE)
-
-
-#define BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_0(E)
-
-#define BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_1(E)                                       \
-    BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, friend, +, ::boost::flags::impl::bool_convertible<E>)
-
-
-#define BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_(E, VALUE)                                 \
-    BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_##VALUE(E)
-
-#define BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD(E, VALUE)                                  \
-    BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_(E, VALUE)
-
-
-
-#define BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_NOT_0(E, LOGICAL_AND, PRE_INCREMENT)                    \
-    BOOST_FLAGS_FORWARD_OPERATORS_LOCAL(E)                                                          \
-    BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD(E, LOGICAL_AND)                                  \
-    BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD(E, PRE_INCREMENT)
-
-#define BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_NOT_1(E, LOGICAL_AND, PRE_INCREMENT)
-
-#define BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_(E, NOT_VALUE, LOGICAL_AND, PRE_INCREMENT)              \
-    BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_NOT_##NOT_VALUE(E, LOGICAL_AND, PRE_INCREMENT)
-
-#define BOOST_FLAGS_LOCAL_GENERATE_FORWARDS(E, NOT_VALUE, LOGICAL_AND, PRE_INCREMENT)               \
-    BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_(E, NOT_VALUE, LOGICAL_AND, PRE_INCREMENT)
-
-
-
-#define BOOST_FLAGS_LOCAL_GENERATE_OPS(E, OPS)                                                      \
-    friend BOOST_FLAGS_CONSTEVAL inline                                                             \
-    boost::flags::options_constant<boost::flags::options::enable OPS>                               \
-    boost_flags_enable(E) {                                                                         \
-        return {};                                                                                  \
-    }
-
-
-// this is the default case, when no relation-option is specified
-#define BOOST_FLAGS_LOCAL_GENERATE_REL_(E)                                                          \
-    BOOST_FLAGS_LOCAL_GENERATE_REL_BOOST_FLAGS_GENERATE_DEFAULT_REL(E)
-
-#define BOOST_FLAGS_LOCAL_GENERATE_REL_BOOST_FLAGS_GENERATE_DEFAULT_REL(E)                          \
-
-#define BOOST_FLAGS_LOCAL_GENERATE_REL_BOOST_FLAGS_GENERATE_DELETE_REL(E)                           \
-    BOOST_FLAGS_LOCAL_DELETE_REL(E)
-
-
-// for better diagnostics, when more than one relational operation options is specified
-#define BOOST_FLAGS_LOCAL_GENERATE_DEFAULT_REL(E) ;                                                 \
-static_assert(false, "multiple relational operation options specified");
-
-#define BOOST_FLAGS_LOCAL_GENERATE_DELETE_REL(E) ;                                                  \
-static_assert(false, "multiple relational operation options specified");
-
-
-// forward once to enforce expansion
-#define BOOST_FLAGS_LOCAL_GENERATE_REL2(E, REL) BOOST_FLAGS_LOCAL_GENERATE_REL_##REL(E)
-
-#define BOOST_FLAGS_LOCAL_GENERATE_REL(E, REL)  BOOST_FLAGS_LOCAL_GENERATE_REL2(E, REL)
-
-
-#define BOOST_FLAGS_LOCAL(E, ...)                                                                   \
-    BOOST_FLAGS_LOCAL_GENERATE_OPS(E, BOOST_FLAGS_EXPAND_OPS(__VA_ARGS__))                          \
-    BOOST_FLAGS_LOCAL_GENERATE_FORWARDS(E, BOOST_FLAGS_IS_NO_FORWARDING(__VA_ARGS__),               \
-        BOOST_FLAGS_HAS_LOGICAL_AND_OP(__VA_ARGS__),                                                \
-        BOOST_FLAGS_HAS_PRE_INCREMENT_OP(__VA_ARGS__))                                              \
-    BOOST_FLAGS_LOCAL_GENERATE_REL(E, BOOST_FLAGS_EXPAND_RELS(__VA_ARGS__))                         \
-
 #endif  // BOOST_FLAGS_HPP_INCLUDED
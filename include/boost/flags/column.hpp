@@ -0,0 +1,340 @@
+#ifndef BOOST_FLAGS_COLUMN_HPP_INCLUDED
+#define BOOST_FLAGS_COLUMN_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// column files of flags, memory-mapped for reading without deserialization
+//
+// file layout: 64 bytes header (little-endian, cf. boost/flags/detail/binary_io.hpp), followed by the values
+// in the byte order of the writing machine
+//   0: 'BFCL', u32 version, u8 byte order (1: little-endian, 2: big-endian), u8 sizeof(E), u16 0, u32 0,
+//  16: u64 hash of the enum type, u64 domain mask, u64 #values, zero padding up to 64 bytes
+//
+// the enum type is identified by its qualified name, which may be changed by the ADL hook
+//   constexpr char const* boost_flags_column_name(E) { return "name"; }
+
+#include <boost/flags/domain.hpp>
+#include <boost/flags/detail/binary_io.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__cpp_lib_span)
+# include <span>
+#endif // defined(__cpp_lib_span)
+
+#if defined(_WIN32)
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif // NOMINMAX
+# include <windows.h>
+#else // defined(_WIN32)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif // defined(_WIN32)
+
+namespace boost {
+    namespace flags {
+        namespace impl {
+            namespace column {
+
+                inline constexpr char magic[4] = { 'B', 'F', 'C', 'L' };
+                inline constexpr std::uint32_t version = 1;
+                inline constexpr std::size_t header_size = 64;
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                inline constexpr std::uint8_t native_byte_order = 2;
+#else
+                inline constexpr std::uint8_t native_byte_order = 1;
+#endif
+
+                // the qualified name of E from the signature of this function
+                template<typename E>
+                constexpr std::string_view signature_type_name() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+                    std::string_view const s = __FUNCSIG__;
+                    std::size_t const first = s.find("signature_type_name<") + 20;
+                    std::string_view name = s.substr(first, s.rfind(">(void)") - first);
+                    return name.substr(0, 5) == "enum " ? name.substr(5) : name;
+#else
+                    std::string_view const s = __PRETTY_FUNCTION__;
+                    std::size_t const first = s.find("E = ") + 4;
+                    std::size_t const last = s.find_first_of(";]", first);
+                    return s.substr(first, last - first);
+#endif
+                }
+
+                template<typename E, typename = void>
+                struct name_helper {
+                    static constexpr std::string_view value = signature_type_name<E>();
+                };
+
+                template<typename E>
+                struct name_helper<E, decltype(void(boost_flags_column_name(E{})))> {
+                    static constexpr std::string_view value = boost_flags_column_name(E{});
+                };
+
+                // FNV-1a
+                constexpr std::uint64_t hash(std::string_view s) noexcept {
+                    std::uint64_t h = 14695981039346656037ull;
+                    for (char c : s) {
+                        h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+                    }
+                    return h;
+                }
+
+                template<typename E>
+                inline constexpr std::uint64_t type_hash = hash(name_helper<E>::value);
+
+                inline std::uint64_t load_u64(unsigned char const* p) noexcept {
+                    std::uint64_t v = 0;
+                    for (std::size_t i = 0; i < 8; ++i) {
+                        v |= std::uint64_t(p[i]) << (8 * i);
+                    }
+                    return v;
+                }
+
+                inline std::uint32_t load_u32(unsigned char const* p) noexcept {
+                    return static_cast<std::uint32_t>(load_u64(p) & 0xffffffffu);
+                }
+
+                // a read-only mapping of a whole file
+                class file_mapping {
+                public:
+                    file_mapping() noexcept = default;
+
+                    // throws std::runtime_error if the file cannot be mapped
+                    file_mapping(char const* path, char const* what) {
+#if defined(_WIN32)
+                        HANDLE const file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                        if (file == INVALID_HANDLE_VALUE) {
+                            throw std::runtime_error(std::string(what) + ": cannot open " + path);
+                        }
+                        LARGE_INTEGER size;
+                        if (!::GetFileSizeEx(file, &size)) {
+                            ::CloseHandle(file);
+                            throw std::runtime_error(std::string(what) + ": cannot open " + path);
+                        }
+                        size_ = static_cast<std::size_t>(size.QuadPart);
+                        if (size_ != 0) {
+                            HANDLE const mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                            if (mapping != nullptr) {
+                                data_ = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                                ::CloseHandle(mapping);
+                            }
+                        }
+                        ::CloseHandle(file);
+#else // defined(_WIN32)
+                        int const fd = ::open(path, O_RDONLY);
+                        if (fd < 0) {
+                            throw std::runtime_error(std::string(what) + ": cannot open " + path);
+                        }
+                        struct stat st;
+                        if (::fstat(fd, &st) != 0) {
+                            ::close(fd);
+                            throw std::runtime_error(std::string(what) + ": cannot open " + path);
+                        }
+                        size_ = static_cast<std::size_t>(st.st_size);
+                        if (size_ != 0) {
+                            void* const p = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+                            data_ = p == MAP_FAILED ? nullptr : p;
+                        }
+                        ::close(fd);
+#endif // defined(_WIN32)
+                        if (size_ != 0 && data_ == nullptr) {
+                            throw std::runtime_error(std::string(what) + ": cannot map " + path);
+                        }
+                    }
+
+                    file_mapping(file_mapping&& other) noexcept
+                        : data_(std::exchange(other.data_, nullptr))
+                        , size_(std::exchange(other.size_, 0))
+                    {}
+
+                    file_mapping& operator=(file_mapping&& other) noexcept {
+                        file_mapping(std::move(other)).swap(*this);
+                        return *this;
+                    }
+
+                    ~file_mapping() {
+                        if (data_ != nullptr) {
+#if defined(_WIN32)
+                            ::UnmapViewOfFile(data_);
+#else // defined(_WIN32)
+                            ::munmap(data_, size_);
+#endif // defined(_WIN32)
+                        }
+                    }
+
+                    void swap(file_mapping& other) noexcept {
+                        std::swap(data_, other.data_);
+                        std::swap(size_, other.size_);
+                    }
+
+                    unsigned char const* data() const noexcept { return static_cast<unsigned char const*>(data_); }
+                    std::size_t size() const noexcept { return size_; }
+
+                private:
+                    void* data_ = nullptr;
+                    std::size_t size_ = 0;
+                };
+
+            } // namespace column
+        } // namespace impl
+
+
+// write_column : writes the values as column file
+        template<typename E>
+        void write_column(std::ostream& out, E const* values, std::size_t n) {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::write_column requires an enabled enum type.");
+            impl::write_header(out, impl::column::magic, impl::column::version);
+            char const info[8] = { static_cast<char>(impl::column::native_byte_order), static_cast<char>(sizeof(E)) };
+            out.write(info, 8);
+            impl::write_u64(out, impl::column::type_hash<E>);
+            impl::write_u64(out, static_cast<std::uint64_t>(domain_mask_v<E>));
+            impl::write_u64(out, n);
+            char const padding[impl::column::header_size - 40] = {};
+            out.write(padding, sizeof(padding));
+            out.write(reinterpret_cast<char const*>(values), static_cast<std::streamsize>(n * sizeof(E)));
+        }
+
+        template<typename Range>
+        auto write_column(std::ostream& out, Range const& values) -> decltype(void(impl::range_data(values))) {
+            write_column(out, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Range>
+        auto write_column(char const* path, Range const& values) -> decltype(void(impl::range_data(values)), bool()) {
+            std::ofstream out(path, std::ios::binary);
+            write_column(out, values);
+            out.close();
+            return static_cast<bool>(out);
+        }
+
+
+        // read-only view of a memory-mapped column file
+        template<typename E>
+        class mapped_flags_column {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::mapped_flags_column requires an enabled enum type.");
+
+            static constexpr char const* what = "boost::flags::mapped_flags_column";
+
+        public:
+            using value_type = E;
+            using size_type = std::size_t;
+            using const_reference = E const&;
+            using const_pointer = E const*;
+            using const_iterator = E const*;
+            using iterator = const_iterator;
+
+            mapped_flags_column() noexcept = default;
+
+            // throws std::runtime_error if the file cannot be mapped, is malformed, or was written
+            // for a different enum type, domain, size or byte order
+            explicit mapped_flags_column(char const* path)
+                : mapping_(path, what)
+            {
+                unsigned char const* const header = mapping_.data();
+                if (mapping_.size() < impl::column::header_size) {
+                    throw std::runtime_error(std::string(what) + ": unexpected end of input");
+                }
+                if (std::memcmp(header, impl::column::magic, 4) != 0) {
+                    throw std::runtime_error(std::string(what) + ": unrecognized format");
+                }
+                if (impl::column::load_u32(header + 4) != impl::column::version) {
+                    throw std::runtime_error(std::string(what) + ": unsupported version");
+                }
+                if (header[8] != impl::column::native_byte_order) {
+                    throw std::runtime_error(std::string(what) + ": byte order mismatch");
+                }
+                if (header[9] != sizeof(E)) {
+                    throw std::runtime_error(std::string(what) + ": value size mismatch");
+                }
+                if (impl::column::load_u64(header + 16) != impl::column::type_hash<E>) {
+                    throw std::runtime_error(std::string(what) + ": enum type mismatch");
+                }
+                if (impl::column::load_u64(header + 24) != static_cast<std::uint64_t>(domain_mask_v<E>)) {
+                    throw std::runtime_error(std::string(what) + ": domain mismatch");
+                }
+                std::uint64_t const n = impl::column::load_u64(header + 32);
+                if (n != (mapping_.size() - impl::column::header_size) / sizeof(E) ||
+                    (mapping_.size() - impl::column::header_size) % sizeof(E) != 0) {
+                    throw std::runtime_error(std::string(what) + ": invalid size");
+                }
+                // the mapping is page-aligned, the values start at the aligned header size
+                data_ = reinterpret_cast<E const*>(header + impl::column::header_size);
+                size_ = static_cast<std::size_t>(n);
+            }
+
+            explicit mapped_flags_column(std::string const& path)
+                : mapped_flags_column(path.c_str())
+            {}
+
+            mapped_flags_column(mapped_flags_column&& other) noexcept
+                : mapping_(std::move(other.mapping_))
+                , data_(std::exchange(other.data_, nullptr))
+                , size_(std::exchange(other.size_, 0))
+            {}
+
+            mapped_flags_column& operator=(mapped_flags_column&& other) noexcept {
+                mapped_flags_column(std::move(other)).swap(*this);
+                return *this;
+            }
+
+            void swap(mapped_flags_column& other) noexcept {
+                mapping_.swap(other.mapping_);
+                std::swap(data_, other.data_);
+                std::swap(size_, other.size_);
+            }
+
+            friend void swap(mapped_flags_column& lhs, mapped_flags_column& rhs) noexcept {
+                lhs.swap(rhs);
+            }
+
+            const_pointer data() const noexcept { return data_; }
+            size_type size() const noexcept { return size_; }
+            bool empty() const noexcept { return size_ == 0; }
+
+            const_iterator begin() const noexcept { return data_; }
+            const_iterator end() const noexcept { return data_ + size_; }
+
+            const_reference operator[](size_type i) const noexcept {
+                BOOST_FLAGS_ASSERT(i < size_);
+                return data_[i];
+            }
+
+            const_reference at(size_type i) const {
+                if (i >= size_) {
+                    throw std::out_of_range("boost::flags::mapped_flags_column::at: index out of range");
+                }
+                return data_[i];
+            }
+
+#if defined(__cpp_lib_span)
+            std::span<E const> span() const noexcept { return { data_, size_ }; }
+#endif // defined(__cpp_lib_span)
+
+        private:
+            impl::column::file_mapping mapping_;
+            E const* data_ = nullptr;
+            std::size_t size_ = 0;
+        };
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_COLUMN_HPP_INCLUDED
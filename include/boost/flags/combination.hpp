@@ -0,0 +1,319 @@
+#ifndef BOOST_FLAGS_COMBINATION_HPP_INCLUDED
+#define BOOST_FLAGS_COMBINATION_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// frequencies of whole flag combinations (values) in a stream
+//
+// small domains (cf. domain.hpp) are counted exactly in a direct array indexed by the compacted value,
+// wide domains use a count-min sketch together with a fixed set of heavy-hitter candidates
+
+#include <boost/flags/domain.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+
+        // a combination and its estimated number of occurrences
+        // the exact count is at most count, it lies in [count - error, count] with probability 1 - e^-depth
+        // (error is a probabilistic bound of the count-min sketch, it is 0 for exactly counted domains)
+        template<typename E>
+        struct combination_count {
+            E value;
+            std::uint64_t count;
+            std::uint64_t error;
+        };
+
+        // DirectBits: domains with at most DirectBits bits are counted exactly (2^DirectBits counters)
+        // Capacity: number of heavy-hitter candidates, i.e. maximal k for top_k of wide domains
+        // Width, Depth: dimensions of the count-min sketch (Width must be a power of 2)
+        template<std::size_t DirectBits = 12, std::size_t Capacity = 64, std::size_t Width = 2048, std::size_t Depth = 4>
+        struct combination_counter_options {
+            static constexpr std::size_t direct_bits = DirectBits;
+            static constexpr std::size_t capacity = Capacity;
+            static constexpr std::size_t width = Width;
+            static constexpr std::size_t depth = Depth;
+
+            static_assert(Width != 0 && (Width & (Width - 1)) == 0, "Width must be a power of 2.");
+            static_assert(Depth != 0 && Depth <= 8, "Depth must be in [1, 8].");
+            static_assert(Capacity != 0, "Capacity must not be 0.");
+        };
+
+        namespace impl {
+
+            template<typename E>
+            using combination_list = std::vector<combination_count<enum_type_t<E>>>;
+
+            template<typename E>
+            inline void sort_combinations(combination_list<E>& list, std::size_t k) {
+                auto greater = [](auto const& a, auto const& b) {
+                    return a.count != b.count ? a.count > b.count : to_unsigned(a.value) < to_unsigned(b.value);
+                };
+                if (k < list.size()) {
+                    std::partial_sort(list.begin(), list.begin() + static_cast<std::ptrdiff_t>(k), list.end(), greater);
+                    list.resize(k);
+                } else {
+                    std::sort(list.begin(), list.end(), greater);
+                }
+            }
+
+
+            // exact counters for all 2^domain_bits combinations
+            template<typename E, typename Options>
+            class direct_combination_storage {
+                static constexpr std::size_t size = std::size_t(1) << domain_bits_v<E>;
+
+            public:
+                static constexpr bool is_exact = true;
+
+                void add(enum_type_t<E> value, std::uint64_t count) noexcept {
+                    counts_[compact_domain(value)] += count;
+                }
+
+                void merge(direct_combination_storage const& other) noexcept {
+                    for (std::size_t i = 0; i < size; ++i) {
+                        counts_[i] += other.counts_[i];
+                    }
+                }
+
+                combination_count<enum_type_t<E>> estimate(enum_type_t<E> value, std::uint64_t) const noexcept {
+                    return { value, counts_[compact_domain(value)], 0 };
+                }
+
+                combination_list<E> top_k(std::size_t k, std::uint64_t) const {
+                    combination_list<E> result;
+                    for (std::size_t i = 0; i < size; ++i) {
+                        if (counts_[i] != 0) {
+                            result.push_back({ expand_domain<E>(i), counts_[i], 0 });
+                        }
+                    }
+                    sort_combinations<E>(result, k);
+                    return result;
+                }
+
+            private:
+                std::array<std::uint64_t, size> counts_{};
+            };
+
+
+            // count-min sketch and the `Capacity` candidates with the highest estimates
+            template<typename E, typename Options>
+            class sketch_combination_storage {
+                using U = unsigned_underlying_t<E>;
+
+                static constexpr std::size_t width = Options::width;
+                static constexpr std::size_t depth = Options::depth;
+                static constexpr std::size_t capacity = Options::capacity;
+
+                static std::size_t hash(U value, std::size_t row) noexcept {
+                    // multiply-shift hashing with fixed odd multipliers (identical for all instances, thus mergeable)
+                    constexpr std::uint64_t multipliers[8] = {
+                        0x9e3779b97f4a7c15ull, 0xc2b2ae3d27d4eb4full, 0x165667b19e3779f9ull, 0xd6e8feb86659fd93ull,
+                        0xff51afd7ed558ccdull, 0xc4ceb9fe1a85ec53ull, 0x94d049bb133111ebull, 0xbf58476d1ce4e5b9ull,
+                    };
+                    std::uint64_t const h = (static_cast<std::uint64_t>(value) + row) * multipliers[row];
+                    return static_cast<std::size_t>((h ^ (h >> 29)) * 0x2545f4914f6cdd1dull >> 32) & (width - 1);
+                }
+
+                std::uint64_t sketch_estimate(U value) const noexcept {
+                    std::uint64_t result = sketch_[0][hash(value, 0)];
+                    for (std::size_t row = 1; row < depth; ++row) {
+                        result = (std::min)(result, sketch_[row][hash(value, row)]);
+                    }
+                    return result;
+                }
+
+                // replaces the candidate with the smallest estimate by `value` if its estimate is larger
+                void offer(U value, std::uint64_t estimate) noexcept {
+                    // the estimates only grow, so a candidate's estimate is never below min_estimate_
+                    if (candidates_size_ == capacity && estimate <= min_estimate_) {
+                        return;
+                    }
+                    for (std::size_t i = 0; i < candidates_size_; ++i) {
+                        if (candidates_[i].value == value) {
+                            candidates_[i].estimate = estimate;
+                            update_min();
+                            return;
+                        }
+                    }
+                    if (candidates_size_ < capacity) {
+                        candidates_[candidates_size_++] = { value, estimate };
+                    } else {
+                        candidates_[min_index_] = { value, estimate };
+                    }
+                    update_min();
+                }
+
+                void update_min() noexcept {
+                    if (candidates_size_ < capacity) {
+                        min_estimate_ = 0;
+                        return;
+                    }
+                    min_index_ = 0;
+                    for (std::size_t i = 1; i < candidates_size_; ++i) {
+                        if (candidates_[i].estimate < candidates_[min_index_].estimate) {
+                            min_index_ = i;
+                        }
+                    }
+                    min_estimate_ = candidates_[min_index_].estimate;
+                }
+
+            public:
+                static constexpr bool is_exact = false;
+
+                // additive error bound of the count-min sketch: e / width * total (holds with probability 1 - e^-depth)
+                static std::uint64_t error_bound(std::uint64_t total) noexcept {
+                    return static_cast<std::uint64_t>(std::ceil(2.718281828459045 * static_cast<double>(total) / static_cast<double>(width)));
+                }
+
+                void add(enum_type_t<E> value, std::uint64_t count) noexcept {
+                    U const u = to_unsigned(value);
+                    std::uint64_t estimate = ~std::uint64_t(0);
+                    for (std::size_t row = 0; row < depth; ++row) {
+                        std::uint64_t& cell = sketch_[row][hash(u, row)];
+                        cell += count;
+                        estimate = (std::min)(estimate, cell);
+                    }
+                    offer(u, estimate);
+                }
+
+                void merge(sketch_combination_storage const& other) noexcept {
+                    for (std::size_t row = 0; row < depth; ++row) {
+                        for (std::size_t i = 0; i < width; ++i) {
+                            sketch_[row][i] += other.sketch_[row][i];
+                        }
+                    }
+                    // re-estimate the candidates of both sides with the merged sketch
+                    for (std::size_t i = 0; i < candidates_size_; ++i) {
+                        candidates_[i].estimate = sketch_estimate(candidates_[i].value);
+                    }
+                    update_min();
+                    for (std::size_t i = 0; i < other.candidates_size_; ++i) {
+                        offer(other.candidates_[i].value, sketch_estimate(other.candidates_[i].value));
+                    }
+                }
+
+                combination_count<enum_type_t<E>> estimate(enum_type_t<E> value, std::uint64_t total) const noexcept {
+                    std::uint64_t const count = sketch_estimate(to_unsigned(value));
+                    return { value, count, (std::min)(count, error_bound(total)) };
+                }
+
+                combination_list<E> top_k(std::size_t k, std::uint64_t total) const {
+                    combination_list<E> result;
+                    result.reserve(candidates_size_);
+                    std::uint64_t const error = error_bound(total);
+                    for (std::size_t i = 0; i < candidates_size_; ++i) {
+                        std::uint64_t const count = candidates_[i].estimate;
+                        result.push_back({ from_unsigned<E>(candidates_[i].value), count, (std::min)(count, error) });
+                    }
+                    sort_combinations<E>(result, k);
+                    return result;
+                }
+
+            private:
+                struct candidate {
+                    U value;
+                    std::uint64_t estimate;
+                };
+
+                std::array<std::array<std::uint64_t, width>, depth> sketch_{};
+                std::array<candidate, capacity> candidates_{};
+                std::size_t candidates_size_ = 0;
+                std::size_t min_index_ = 0;
+                std::uint64_t min_estimate_ = 0;
+            };
+
+        } // namespace impl
+
+
+        // counts the occurrences of flag combinations in constant memory
+        template<typename E, typename Options = combination_counter_options<>>
+        class combination_counter {
+            static_assert(is_flags<E>::value, "boost::flags::combination_counter requires an enabled enum type.");
+
+            using storage_type = typename std::conditional<(domain_bits_v<E> <= Options::direct_bits),
+                impl::direct_combination_storage<enum_type_t<E>, Options>,
+                impl::sketch_combination_storage<enum_type_t<E>, Options>>::type;
+
+        public:
+            using value_type = enum_type_t<E>;
+
+            // true iff the domain is counted exactly
+            static constexpr bool is_exact = storage_type::is_exact;
+
+            void add(value_type value, std::uint64_t count = 1) noexcept {
+                storage_.add(value, count);
+                size_ += count;
+            }
+
+            // runs of equal values are counted at once
+            void add(value_type const* values, std::size_t n) noexcept {
+                std::size_t i = 0;
+                while (i < n) {
+                    value_type const v = values[i];
+                    std::size_t j = i + 1;
+                    while (j < n && impl::to_unsigned(values[j]) == impl::to_unsigned(v)) {
+                        ++j;
+                    }
+                    add(v, j - i);
+                    i = j;
+                }
+            }
+
+            template<typename Range>
+            auto add(Range const& values) noexcept -> decltype(impl::range_data(values), void()) {
+                add(impl::range_data(values), impl::range_size(values));
+            }
+
+            // adds the counts of `other` (e.g. a per-thread partial)
+            void merge(combination_counter const& other) noexcept {
+                storage_.merge(other.storage_);
+                size_ += other.size_;
+            }
+
+            combination_counter& operator+=(combination_counter const& other) noexcept {
+                merge(other);
+                return *this;
+            }
+
+            // number of absorbed values
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            std::uint64_t size() const noexcept {
+                return size_;
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            combination_count<value_type> estimate(value_type value) const noexcept {
+                return storage_.estimate(value, size_);
+            }
+
+            // the (at most) k most frequent combinations, ordered by descending count
+            // for wide domains k is limited by Options::capacity
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            std::vector<combination_count<value_type>> top_k(std::size_t k) const {
+                return storage_.top_k(k, size_);
+            }
+
+            void clear() noexcept {
+                storage_ = storage_type{};
+                size_ = 0;
+            }
+
+        private:
+            storage_type storage_{};
+            std::uint64_t size_ = 0;
+        };
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_COMBINATION_HPP_INCLUDED
@@ -0,0 +1,131 @@
+#ifndef BOOST_FLAGS_DETAIL_BINARY_IO_HPP_INCLUDED
+#define BOOST_FLAGS_DETAIL_BINARY_IO_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// little-endian encoding of the binary reports (cf. boost/flags/profile.hpp, boost/flags/trace.hpp)
+//
+// strings are written as table: u32 #strings, #strings * (u16 size, chars)
+// and referenced by their u32 index
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+        namespace impl {
+
+            inline void write_u16(std::ostream& out, std::uint16_t v) {
+                char const bytes[2] = { char(v & 0xff), char(v >> 8) };
+                out.write(bytes, 2);
+            }
+
+            inline void write_u32(std::ostream& out, std::uint32_t v) {
+                write_u16(out, std::uint16_t(v & 0xffff));
+                write_u16(out, std::uint16_t(v >> 16));
+            }
+
+            inline void write_u64(std::ostream& out, std::uint64_t v) {
+                write_u32(out, std::uint32_t(v & 0xffffffff));
+                write_u32(out, std::uint32_t(v >> 32));
+            }
+
+            // `what` names the reading function in the message of the std::runtime_error
+            template<typename U>
+            U read_uint(std::istream& in, char const* what) {
+                unsigned char bytes[sizeof(U)];
+                if (!in.read(reinterpret_cast<char*>(bytes), sizeof(U))) {
+                    throw std::runtime_error(std::string(what) + ": unexpected end of input");
+                }
+                U v = 0;
+                for (std::size_t i = 0; i < sizeof(U); ++i) {
+                    v |= U(bytes[i]) << (8 * i);
+                }
+                return v;
+            }
+
+            // checks the 4 character magic and the version of a report
+            inline void read_header(std::istream& in, char const (&magic)[4], std::uint32_t version, char const* what) {
+                char m[4];
+                if (!in.read(m, 4) || m[0] != magic[0] || m[1] != magic[1] || m[2] != magic[2] || m[3] != magic[3]) {
+                    throw std::runtime_error(std::string(what) + ": unrecognized format");
+                }
+                if (read_uint<std::uint32_t>(in, what) != version) {
+                    throw std::runtime_error(std::string(what) + ": unsupported version");
+                }
+            }
+
+            inline void write_header(std::ostream& out, char const (&magic)[4], std::uint32_t version) {
+                out.write(magic, 4);
+                write_u32(out, version);
+            }
+
+
+            // collects distinct strings (truncated to 64k characters) while encoding a report
+            class string_table {
+            public:
+                std::uint32_t index(std::string const& s) {
+                    auto result = indices_.emplace(s, static_cast<std::uint32_t>(strings_.size()));
+                    if (result.second) {
+                        strings_.push_back(s.substr(0, 0xffff));
+                    }
+                    return result.first->second;
+                }
+
+                void write(std::ostream& out) const {
+                    write_u32(out, static_cast<std::uint32_t>(strings_.size()));
+                    for (std::string const& s : strings_) {
+                        write_u16(out, static_cast<std::uint16_t>(s.size()));
+                        out.write(s.data(), static_cast<std::streamsize>(s.size()));
+                    }
+                }
+
+            private:
+                std::vector<std::string> strings_;
+                std::map<std::string, std::uint32_t> indices_;
+            };
+
+            // the capacity to reserve for a count read from the input, the containers grow while reading
+            // (a malformed count ends with an unexpected end of input instead of a huge allocation)
+            inline std::size_t initial_capacity(std::uint64_t count) {
+                return count < 4096 ? static_cast<std::size_t>(count) : 4096;
+            }
+
+            inline std::vector<std::string> read_string_table(std::istream& in, char const* what) {
+                std::uint32_t const n = read_uint<std::uint32_t>(in, what);
+                std::vector<std::string> strings;
+                strings.reserve(initial_capacity(n));
+                for (std::uint32_t i = 0; i < n; ++i) {
+                    std::string s(read_uint<std::uint16_t>(in, what), '\0');
+                    if (!in.read(&s[0], static_cast<std::streamsize>(s.size()))) {
+                        throw std::runtime_error(std::string(what) + ": unexpected end of input");
+                    }
+                    strings.push_back(std::move(s));
+                }
+                return strings;
+            }
+
+            inline std::string const& string_at(std::vector<std::string> const& strings, std::uint32_t i, char const* what) {
+                if (i >= strings.size()) {
+                    throw std::runtime_error(std::string(what) + ": invalid string index");
+                }
+                return strings[i];
+            }
+
+        } // namespace impl
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_DETAIL_BINARY_IO_HPP_INCLUDED
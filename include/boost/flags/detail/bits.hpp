@@ -0,0 +1,195 @@
+#ifndef BOOST_FLAGS_DETAIL_BITS_HPP_INCLUDED
+#define BOOST_FLAGS_DETAIL_BITS_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// common helpers for the bulk algorithms and containers in boost/flags/*.hpp
+// (the core header boost/flags.hpp supports C++11, the extension headers require C++17)
+
+#include <boost/flags.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#if !(__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+# error "The Boost.Flags extension headers require at least C++17."
+#endif
+
+#if defined(__has_include)
+# if __has_include(<bit>) && (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
+#  include <bit>
+# endif
+#endif
+
+
+// SIMD support: deduced from the target architecture, can be switched off by defining BOOST_FLAGS_DISABLE_SIMD
+#if !defined(BOOST_FLAGS_HAS_AVX2)
+# if defined(__AVX2__) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#  define BOOST_FLAGS_HAS_AVX2 1
+# else // defined(__AVX2__) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#  define BOOST_FLAGS_HAS_AVX2 0
+# endif // defined(__AVX2__) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#endif // !defined(BOOST_FLAGS_HAS_AVX2)
+
+#if !defined(BOOST_FLAGS_HAS_AVX512)
+# if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#  define BOOST_FLAGS_HAS_AVX512 1
+# else // defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#  define BOOST_FLAGS_HAS_AVX512 0
+# endif // defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#endif // !defined(BOOST_FLAGS_HAS_AVX512)
+
+#if !defined(BOOST_FLAGS_HAS_BMI2)
+# if defined(__BMI2__) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#  define BOOST_FLAGS_HAS_BMI2 1
+# else // defined(__BMI2__) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#  define BOOST_FLAGS_HAS_BMI2 0
+# endif // defined(__BMI2__) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#endif // !defined(BOOST_FLAGS_HAS_BMI2)
+
+#if !defined(BOOST_FLAGS_HAS_SSE2)
+# if (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#  define BOOST_FLAGS_HAS_SSE2 1
+# else // (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#  define BOOST_FLAGS_HAS_SSE2 0
+# endif // (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)) && !defined(BOOST_FLAGS_DISABLE_SIMD)
+#endif // !defined(BOOST_FLAGS_HAS_SSE2)
+
+#if BOOST_FLAGS_HAS_AVX2 || BOOST_FLAGS_HAS_AVX512 || BOOST_FLAGS_HAS_BMI2
+# include <immintrin.h>
+#elif BOOST_FLAGS_HAS_SSE2
+# include <emmintrin.h>
+#endif // BOOST_FLAGS_HAS_AVX2 || BOOST_FLAGS_HAS_AVX512 || BOOST_FLAGS_HAS_BMI2
+
+
+// prefetching of data that will be read soon
+#if !defined(BOOST_FLAGS_PREFETCH)
+# if defined(__GNUC__) || defined(__clang__)
+#  define BOOST_FLAGS_PREFETCH(p) __builtin_prefetch(static_cast<void const*>(p))
+# elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <xmmintrin.h>
+#  define BOOST_FLAGS_PREFETCH(p) _mm_prefetch(reinterpret_cast<char const*>(p), _MM_HINT_T0)
+# else
+#  define BOOST_FLAGS_PREFETCH(p) ((void)(p))
+# endif
+#endif // !defined(BOOST_FLAGS_PREFETCH)
+
+
+namespace boost {
+    namespace flags {
+        namespace impl {
+
+            // unsigned version of the underlying type of an enabled enum (or its complement)
+            template<typename E>
+            using unsigned_underlying_t = typename std::make_unsigned<
+                typename std::underlying_type<enum_type_t<E>>::type>::type;
+
+            template<typename E>
+            constexpr unsigned_underlying_t<E> to_unsigned(E value) noexcept {
+                return static_cast<unsigned_underlying_t<E>>(get_underlying_impl(value));
+            }
+
+            template<typename E>
+            constexpr enum_type_t<E> from_unsigned(unsigned_underlying_t<E> value) noexcept {
+                using underlying = typename std::underlying_type<enum_type_t<E>>::type;
+                return static_cast<enum_type_t<E>>(static_cast<underlying>(value));
+            }
+
+
+            inline int popcount(std::uint64_t v) noexcept {
+#if defined(__cpp_lib_bitops)
+                return std::popcount(v);
+#elif defined(__GNUC__) || defined(__clang__)
+                return __builtin_popcountll(v);
+#else
+                v = v - ((v >> 1) & 0x5555555555555555ull);
+                v = (v & 0x3333333333333333ull) + ((v >> 2) & 0x3333333333333333ull);
+                v = (v + (v >> 4)) & 0x0f0f0f0f0f0f0f0full;
+                return static_cast<int>((v * 0x0101010101010101ull) >> 56);
+#endif
+            }
+
+            constexpr int constexpr_popcount(std::uint64_t v) noexcept {
+                int n = 0;
+                for (; v; v &= v - 1) {
+                    ++n;
+                }
+                return n;
+            }
+
+            // requires v != 0
+            inline int countr_zero(std::uint64_t v) noexcept {
+#if defined(__cpp_lib_bitops)
+                return std::countr_zero(v);
+#elif defined(__GNUC__) || defined(__clang__)
+                return __builtin_ctzll(v);
+#else
+                int n = 0;
+                while (!(v & 1)) { v >>= 1; ++n; }
+                return n;
+#endif
+            }
+
+
+            // gathers the bits of `v` selected by `mask` into the low bits of the result (pext)
+            inline std::uint64_t extract_bits(std::uint64_t v, std::uint64_t mask) noexcept {
+#if BOOST_FLAGS_HAS_BMI2 && (defined(__x86_64__) || defined(_M_X64))
+                return _pext_u64(v, mask);
+#else
+                std::uint64_t result = 0;
+                for (std::uint64_t bit = 1; mask; bit <<= 1) {
+                    if (v & mask & (~mask + 1)) {
+                        result |= bit;
+                    }
+                    mask &= mask - 1;
+                }
+                return result;
+#endif
+            }
+
+            // scatters the low bits of `v` to the positions selected by `mask` (pdep)
+            inline std::uint64_t deposit_bits(std::uint64_t v, std::uint64_t mask) noexcept {
+#if BOOST_FLAGS_HAS_BMI2 && (defined(__x86_64__) || defined(_M_X64))
+                return _pdep_u64(v, mask);
+#else
+                std::uint64_t result = 0;
+                for (std::uint64_t bit = 1; mask; bit <<= 1) {
+                    if (v & bit) {
+                        result |= mask & (~mask + 1);
+                    }
+                    mask &= mask - 1;
+                }
+                return result;
+#endif
+            }
+
+
+            // access to the elements of contiguous ranges (std::vector, std::array, std::span, ...)
+            template<typename Range>
+            auto range_data(Range& r) noexcept -> decltype(std::data(r)) {
+                return std::data(r);
+            }
+
+            template<typename Range>
+            std::size_t range_size(Range const& r) noexcept {
+                return static_cast<std::size_t>(std::size(r));
+            }
+
+            // the element type, only valid for contiguous ranges (constrains the range overloads of the algorithms)
+            template<typename Range>
+            using range_value_t = typename std::remove_cv<typename std::remove_pointer<
+                decltype(std::data(std::declval<Range const&>()))>::type>::type;
+
+        } // namespace impl
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_DETAIL_BITS_HPP_INCLUDED
@@ -0,0 +1,79 @@
+#ifndef BOOST_FLAGS_DETAIL_FLAT_SEARCH_HPP_INCLUDED
+#define BOOST_FLAGS_DETAIL_FLAT_SEARCH_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// searching and bulk merging of sorted contiguous storage, ordered as total_order
+
+#include <boost/flags/sort.hpp>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+        namespace impl {
+
+            // ordering key of total_order
+            template<typename E>
+            constexpr auto order_key(E value) noexcept {
+                return get_underlying_impl(value);
+            }
+
+            // branchless binary search: the loop has a fixed number of iterations for a given size and
+            // the comparison result only selects the next base (compiled to a conditional move),
+            // so there are no mispredicted branches
+            template<typename T, typename KeyOf, typename E>
+            inline T const* branchless_lower_bound(T const* first, std::size_t n, E key, KeyOf key_of) noexcept {
+                if (n == 0) {
+                    return first;
+                }
+                auto const k = order_key(key);
+                T const* base = first;
+                while (n > 1) {
+                    std::size_t const half = n / 2;
+                    // both possible next probes
+                    BOOST_FLAGS_PREFETCH(base + half / 2);
+                    BOOST_FLAGS_PREFETCH(base + half + half / 2);
+                    base = (order_key(key_of(base[half])) < k) ? base + half : base;
+                    n -= half;
+                }
+                return base + (order_key(key_of(*base)) < k);
+            }
+
+            // inserts the elements of [first, last) into the sorted and unique vector `data`:
+            // the new elements are appended, stably sorted and merged, of equal keys the first
+            // (i.e. the already contained one) is kept
+            template<typename T, typename KeyOf, typename InputIt>
+            void bulk_merge_insert(std::vector<T>& data, InputIt first, InputIt last, KeyOf key_of) {
+                using E = enum_type_t<typename std::decay<decltype(key_of(std::declval<T const&>()))>::type>;
+                auto const old_size = static_cast<std::ptrdiff_t>(data.size());
+                data.insert(data.end(), first, last);
+                auto const middle = data.begin() + old_size;
+                if (middle == data.end()) {
+                    return;
+                }
+                auto const less = [&key_of](T const& a, T const& b) { return order_key(key_of(a)) < order_key(key_of(b)); };
+                // the radix sort ignores bits outside the domain, it agrees with order_key only for full domains
+                if constexpr (domain_helper<E>::value == static_cast<unsigned_underlying_t<E>>(~unsigned_underlying_t<E>(0))) {
+                    radix_sort_by_flags(middle, data.end(), key_of);
+                } else {
+                    std::stable_sort(middle, data.end(), less);
+                }
+                std::inplace_merge(data.begin(), middle, data.end(), less);
+                auto const equal = [&key_of](T const& a, T const& b) { return order_key(key_of(a)) == order_key(key_of(b)); };
+                data.erase(std::unique(data.begin(), data.end(), equal), data.end());
+            }
+
+        } // namespace impl
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_DETAIL_FLAT_SEARCH_HPP_INCLUDED
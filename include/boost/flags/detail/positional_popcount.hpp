@@ -0,0 +1,213 @@
+#ifndef BOOST_FLAGS_DETAIL_POSITIONAL_POPCOUNT_HPP_INCLUDED
+#define BOOST_FLAGS_DETAIL_POSITIONAL_POPCOUNT_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// positional popcount: for every bit position count the number of values having that bit set
+//
+// The values are loaded as "wide words" W (std::uint64_t or a SIMD register) each containing
+// sizeof(W) / sizeof(E) lanes. Since all bit positions are independent, a Harley-Seal carry-save
+// adder tree reduces 16 wide words to one word of weight 16 whose set bits are then added to the
+// counters. Thus the per-bit work is done once per 16 wide words instead of once per value.
+
+#include <boost/flags/detail/bits.hpp>
+
+#include <array>
+#include <cstring>
+
+namespace boost {
+    namespace flags {
+        namespace impl {
+
+            template<typename W>
+            inline void carry_save_add(W& high, W& low, W a, W b, W c) noexcept {
+                W const u = a ^ b;
+                high = (a & b) | (u & c);
+                low = u ^ c;
+            }
+
+            // adds `weight` to counters[b % Bits] for every set bit b of `v`
+            template<std::size_t Bits>
+            inline void add_positional(std::array<std::uint64_t, Bits>& counters, std::uint64_t v, std::uint64_t weight) noexcept {
+                while (v) {
+                    counters[static_cast<std::size_t>(countr_zero(v)) % Bits] += weight;
+                    v &= v - 1;
+                }
+            }
+
+            // naive version: one iteration per set bit
+            template<typename E>
+            inline void positional_popcount_scalar(std::array<std::uint64_t, sizeof(E) * 8>& counters, E const* values, std::size_t n) noexcept {
+                for (std::size_t i = 0; i < n; ++i) {
+                    add_positional(counters, static_cast<std::uint64_t>(to_unsigned(values[i])), 1);
+                }
+            }
+
+
+            // state of the carry-save adder tree between calls (allows streaming)
+            template<typename W>
+            struct csa_state {
+                W ones{};
+                W twos{};
+                W fours{};
+                W eights{};
+            };
+
+            // one Harley-Seal step: folds 16 wide words into `state` and returns the carry of weight 16
+            template<typename W>
+            inline W harley_seal_step(csa_state<W>& s, W const* w) noexcept {
+                W twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens;
+                carry_save_add(twos_a, s.ones, s.ones, w[0], w[1]);
+                carry_save_add(twos_b, s.ones, s.ones, w[2], w[3]);
+                carry_save_add(fours_a, s.twos, s.twos, twos_a, twos_b);
+                carry_save_add(twos_a, s.ones, s.ones, w[4], w[5]);
+                carry_save_add(twos_b, s.ones, s.ones, w[6], w[7]);
+                carry_save_add(fours_b, s.twos, s.twos, twos_a, twos_b);
+                carry_save_add(eights_a, s.fours, s.fours, fours_a, fours_b);
+                carry_save_add(twos_a, s.ones, s.ones, w[8], w[9]);
+                carry_save_add(twos_b, s.ones, s.ones, w[10], w[11]);
+                carry_save_add(fours_a, s.twos, s.twos, twos_a, twos_b);
+                carry_save_add(twos_a, s.ones, s.ones, w[12], w[13]);
+                carry_save_add(twos_b, s.ones, s.ones, w[14], w[15]);
+                carry_save_add(fours_b, s.twos, s.twos, twos_a, twos_b);
+                carry_save_add(eights_b, s.fours, s.fours, fours_a, fours_b);
+                carry_save_add(sixteens, s.eights, s.eights, eights_a, eights_b);
+                return sixteens;
+            }
+
+
+            // portable wide word: 64-bit SWAR
+            struct swar_word {
+                using type = std::uint64_t;
+
+                static type load(void const* p) noexcept {
+                    type v;
+                    std::memcpy(&v, p, sizeof(v));
+                    return v;
+                }
+
+                template<std::size_t Bits>
+                static void add(std::array<std::uint64_t, Bits>& counters, type v, std::uint64_t weight) noexcept {
+                    add_positional(counters, v, weight);
+                }
+            };
+
+#if BOOST_FLAGS_HAS_AVX2
+            struct avx2_word {
+                struct type {
+                    __m256i v;
+
+                    type() noexcept : v(_mm256_setzero_si256()) {}
+                    explicit type(__m256i x) noexcept : v(x) {}
+
+                    friend type operator&(type a, type b) noexcept { return type(_mm256_and_si256(a.v, b.v)); }
+                    friend type operator|(type a, type b) noexcept { return type(_mm256_or_si256(a.v, b.v)); }
+                    friend type operator^(type a, type b) noexcept { return type(_mm256_xor_si256(a.v, b.v)); }
+                };
+
+                static type load(void const* p) noexcept {
+                    return type(_mm256_loadu_si256(static_cast<__m256i const*>(p)));
+                }
+
+                template<std::size_t Bits>
+                static void add(std::array<std::uint64_t, Bits>& counters, type v, std::uint64_t weight) noexcept {
+                    if (_mm256_testz_si256(v.v, v.v)) {
+                        return;
+                    }
+                    alignas(32) std::uint64_t words[4];
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(words), v.v);
+                    for (std::uint64_t w : words) {
+                        add_positional(counters, w, weight);
+                    }
+                }
+            };
+#endif // BOOST_FLAGS_HAS_AVX2
+
+#if BOOST_FLAGS_HAS_AVX512
+            struct avx512_word {
+                struct type {
+                    __m512i v;
+
+                    type() noexcept : v(_mm512_setzero_si512()) {}
+                    explicit type(__m512i x) noexcept : v(x) {}
+
+                    // ternary logic would fuse the adder, but the compilers already do that for us
+                    friend type operator&(type a, type b) noexcept { return type(_mm512_and_si512(a.v, b.v)); }
+                    friend type operator|(type a, type b) noexcept { return type(_mm512_or_si512(a.v, b.v)); }
+                    friend type operator^(type a, type b) noexcept { return type(_mm512_xor_si512(a.v, b.v)); }
+                };
+
+                static type load(void const* p) noexcept {
+                    return type(_mm512_loadu_si512(p));
+                }
+
+                template<std::size_t Bits>
+                static void add(std::array<std::uint64_t, Bits>& counters, type v, std::uint64_t weight) noexcept {
+                    if (_mm512_test_epi64_mask(v.v, v.v) == 0) {
+                        return;
+                    }
+                    alignas(64) std::uint64_t words[8];
+                    _mm512_store_si512(words, v.v);
+                    for (std::uint64_t w : words) {
+                        add_positional(counters, w, weight);
+                    }
+                }
+            };
+#endif // BOOST_FLAGS_HAS_AVX512
+
+#if BOOST_FLAGS_HAS_AVX512
+            using simd_word = avx512_word;
+#elif BOOST_FLAGS_HAS_AVX2
+            using simd_word = avx2_word;
+#else
+            using simd_word = swar_word;
+#endif
+
+
+            // processes all complete blocks of 16 wide words and returns the number of consumed values
+            // the remaining carry-save state has to be flushed with `flush_csa`
+            template<typename Word, typename E>
+            inline std::size_t positional_popcount_blocks(std::array<std::uint64_t, sizeof(E) * 8>& counters,
+                csa_state<typename Word::type>& state, E const* values, std::size_t n) noexcept {
+                using W = typename Word::type;
+                constexpr std::size_t lanes = sizeof(W) / sizeof(E);
+                constexpr std::size_t block = 16 * lanes;
+
+                std::size_t i = 0;
+                for (; i + block <= n; i += block) {
+                    W w[16];
+                    for (std::size_t k = 0; k < 16; ++k) {
+                        w[k] = Word::load(values + i + k * lanes);
+                    }
+                    Word::add(counters, harley_seal_step(state, w), 16);
+                }
+                return i;
+            }
+
+            template<typename Word, std::size_t Bits>
+            inline void flush_csa(std::array<std::uint64_t, Bits>& counters, csa_state<typename Word::type>& state) noexcept {
+                Word::add(counters, state.eights, 8);
+                Word::add(counters, state.fours, 4);
+                Word::add(counters, state.twos, 2);
+                Word::add(counters, state.ones, 1);
+                state = {};
+            }
+
+            template<typename Word, typename E>
+            inline void positional_popcount(std::array<std::uint64_t, sizeof(E) * 8>& counters, E const* values, std::size_t n) noexcept {
+                csa_state<typename Word::type> state;
+                std::size_t const done = positional_popcount_blocks<Word>(counters, state, values, n);
+                flush_csa<Word>(counters, state);
+                positional_popcount_scalar(counters, values + done, n - done);
+            }
+
+        } // namespace impl
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_DETAIL_POSITIONAL_POPCOUNT_HPP_INCLUDED
@@ -0,0 +1,206 @@
+#ifndef BOOST_FLAGS_DIFF_HPP_INCLUDED
+#define BOOST_FLAGS_DIFF_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// change lists between two snapshots of an array of flags (e.g. for replication or invalidation)
+//
+// diff lists the indices of the changed values together with the added and removed bits,
+// apply_diff (resp. revert_diff) transforms the old snapshot into the new one (resp. vice versa)
+
+#include <boost/flags/execution.hpp>
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+
+        template<typename E>
+        struct flag_change {
+            std::size_t index;
+            E added;
+            E removed;
+
+            friend constexpr bool operator==(flag_change const& lhs, flag_change const& rhs) noexcept {
+                return lhs.index == rhs.index &&
+                    impl::to_unsigned(lhs.added) == impl::to_unsigned(rhs.added) &&
+                    impl::to_unsigned(lhs.removed) == impl::to_unsigned(rhs.removed);
+            }
+
+            friend constexpr bool operator!=(flag_change const& lhs, flag_change const& rhs) noexcept {
+                return !(lhs == rhs);
+            }
+        };
+
+        // the changes in ascending order of their indices
+        template<typename E>
+        using flag_diff = std::vector<flag_change<E>>;
+
+
+        namespace impl {
+
+            template<typename E>
+            inline void diff_element(E const* old_values, E const* new_values, std::size_t i, std::size_t offset, flag_diff<E>& changes) {
+                using U = unsigned_underlying_t<E>;
+                U const o = to_unsigned(old_values[i]);
+                U const n = to_unsigned(new_values[i]);
+                U const x = static_cast<U>(o ^ n);
+                if (x != 0) {
+                    changes.push_back({ offset + i, from_unsigned<E>(static_cast<U>(n & x)), from_unsigned<E>(static_cast<U>(o & x)) });
+                }
+            }
+
+            template<typename E>
+            inline void diff_scalar(E const* old_values, E const* new_values, std::size_t n, std::size_t offset, flag_diff<E>& changes) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    diff_element(old_values, new_values, i, offset, changes);
+                }
+            }
+
+            // unchanged blocks are skipped with a single test, in changed blocks only the changed lanes are visited
+            template<typename E>
+            inline void diff_simd(E const* old_values, E const* new_values, std::size_t n, std::size_t offset, flag_diff<E>& changes) {
+                std::size_t i = 0;
+
+#if BOOST_FLAGS_HAS_AVX2
+                constexpr std::size_t lanes = 32 / sizeof(E);
+                constexpr std::uint32_t lane_bytes = static_cast<std::uint32_t>((std::uint64_t(1) << sizeof(E)) - 1);
+                for (; i + lanes <= n; i += lanes) {
+                    __m256i const a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(old_values + i));
+                    __m256i const b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(new_values + i));
+                    // one bit per changed byte
+                    std::uint32_t changed = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+                    while (changed != 0) {
+                        std::size_t const lane = static_cast<std::size_t>(countr_zero(changed)) / sizeof(E);
+                        diff_element(old_values, new_values, i + lane, offset, changes);
+                        changed &= ~(lane_bytes << (lane * sizeof(E)));
+                    }
+                }
+#else // BOOST_FLAGS_HAS_AVX2
+                // 64-bit SWAR
+                constexpr std::size_t lanes = 8 / sizeof(E);
+                for (; i + lanes <= n; i += lanes) {
+                    std::uint64_t a, b;
+                    std::memcpy(&a, old_values + i, sizeof(a));
+                    std::memcpy(&b, new_values + i, sizeof(b));
+                    if (a != b) {
+                        diff_scalar(old_values + i, new_values + i, lanes, offset + i, changes);
+                    }
+                }
+#endif // BOOST_FLAGS_HAS_AVX2
+
+                diff_scalar(old_values + i, new_values + i, n - i, offset + i, changes);
+            }
+
+            template<typename E>
+            inline void diff_dispatch(execution::scalar_t, E const* old_values, E const* new_values, std::size_t n, flag_diff<E>& changes) {
+                diff_scalar(old_values, new_values, n, 0, changes);
+            }
+
+            template<typename E>
+            inline void diff_dispatch(execution::simd_t, E const* old_values, E const* new_values, std::size_t n, flag_diff<E>& changes) {
+                diff_simd(old_values, new_values, n, 0, changes);
+            }
+
+            template<typename Executor, typename E>
+            inline void diff_dispatch(execution::parallel_t<Executor> const& policy, E const* old_values, E const* new_values, std::size_t n, flag_diff<E>& changes) {
+                // the partial lists of consecutive chunks are concatenated
+                std::vector<flag_diff<E>> partials(parallel_tasks(policy, n));
+                parallel_chunks(policy, n, [&](std::size_t task, std::size_t first, std::size_t last) {
+                    diff_simd(old_values + first, new_values + first, last - first, first, partials[task]);
+                });
+                std::size_t size = 0;
+                for (auto const& p : partials) {
+                    size += p.size();
+                }
+                changes.reserve(size);
+                for (auto const& p : partials) {
+                    changes.insert(changes.end(), p.begin(), p.end());
+                }
+            }
+
+        } // namespace impl
+
+
+// diff : the changes from old_values to new_values
+        template<typename Policy, typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            flag_diff<E> diff(Policy const& policy, E const* old_values, E const* new_values, std::size_t n) {
+            static_assert(is_flags<E>::value, "boost::flags::diff requires an enabled enum type.");
+            flag_diff<E> changes;
+            impl::diff_dispatch(policy, old_values, new_values, n, changes);
+            return changes;
+        }
+
+// apply_diff : replays the changes, i.e. transforms the old values into the new values
+        template<typename E>
+        void apply_diff(E* values, std::size_t n, flag_diff<E> const& changes) {
+            using U = impl::unsigned_underlying_t<E>;
+            for (auto const& c : changes) {
+                BOOST_FLAGS_ASSERT(c.index < n);
+                U const v = impl::to_unsigned(values[c.index]);
+                values[c.index] = impl::from_unsigned<E>(static_cast<U>((v & ~impl::to_unsigned(c.removed)) | impl::to_unsigned(c.added)));
+            }
+            (void)n;
+        }
+
+// revert_diff : undoes the changes, i.e. transforms the new values into the old values
+        template<typename E>
+        void revert_diff(E* values, std::size_t n, flag_diff<E> const& changes) {
+            using U = impl::unsigned_underlying_t<E>;
+            for (auto const& c : changes) {
+                BOOST_FLAGS_ASSERT(c.index < n);
+                U const v = impl::to_unsigned(values[c.index]);
+                values[c.index] = impl::from_unsigned<E>(static_cast<U>((v & ~impl::to_unsigned(c.added)) | impl::to_unsigned(c.removed)));
+            }
+            (void)n;
+        }
+
+
+        namespace impl {
+
+            // both ranges have to contain the same enum type
+            template<typename Range1, typename Range2>
+            using range_diff_t = typename std::enable_if<std::is_same<range_value_t<Range1>, range_value_t<Range2>>::value,
+                flag_diff<range_value_t<Range1>>>::type;
+
+        } // namespace impl
+
+
+        // overloads for contiguous ranges and without policy (uses execution::simd)
+
+        template<typename Policy, typename Range1, typename Range2>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto diff(Policy const& policy, Range1 const& old_values, Range2 const& new_values) -> impl::range_diff_t<Range1, Range2> {
+            BOOST_FLAGS_ASSERT(impl::range_size(old_values) == impl::range_size(new_values));
+            return diff(policy, impl::range_data(old_values), impl::range_data(new_values), impl::range_size(old_values));
+        }
+
+        template<typename Range1, typename Range2>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto diff(Range1 const& old_values, Range2 const& new_values) -> impl::range_diff_t<Range1, Range2> {
+            BOOST_FLAGS_ASSERT(impl::range_size(old_values) == impl::range_size(new_values));
+            return diff(execution::simd, impl::range_data(old_values), impl::range_data(new_values), impl::range_size(old_values));
+        }
+
+        template<typename Range, typename E>
+        void apply_diff(Range&& values, flag_diff<E> const& changes) {
+            apply_diff(impl::range_data(values), impl::range_size(values), changes);
+        }
+
+        template<typename Range, typename E>
+        void revert_diff(Range&& values, flag_diff<E> const& changes) {
+            revert_diff(impl::range_data(values), impl::range_size(values), changes);
+        }
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_DIFF_HPP_INCLUDED
@@ -0,0 +1,64 @@
+#ifndef BOOST_FLAGS_DOMAIN_HPP_INCLUDED
+#define BOOST_FLAGS_DOMAIN_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// domain of an enabled enum: the set of bits that can occur in its values
+//
+// by default all bits of the underlying type, it can be narrowed by declaring
+//
+//      constexpr E boost_flags_domain(E) { return E::a | E::b | ...; }
+//
+// in the namespace of E (found by ADL, like boost_flags_enable)
+
+#include <boost/flags/detail/bits.hpp>
+
+namespace boost {
+    namespace flags {
+
+        // (impl::domain_helper is defined in <boost/flags.hpp>, as it is also used by options::assume_domain)
+
+        // mask of all bits that can occur in values of E
+        template<typename E>
+        inline constexpr enum_type_t<E> domain_mask_v = impl::from_unsigned<E>(impl::domain_helper<enum_type_t<E>>::value);
+
+        // number of bits in the domain of E
+        template<typename E>
+        inline constexpr std::size_t domain_bits_v = static_cast<std::size_t>(
+            impl::constexpr_popcount(impl::domain_helper<enum_type_t<E>>::value));
+
+        namespace impl {
+
+            // maps the domain bits of `value` to consecutive bits [0, domain_bits_v<E>)
+            template<typename E>
+            inline std::uint64_t compact_domain(E value) noexcept {
+                constexpr std::uint64_t mask = domain_helper<enum_type_t<E>>::value;
+                if constexpr ((mask & (mask + 1)) == 0) {
+                    // contiguous low bits
+                    return static_cast<std::uint64_t>(to_unsigned(value)) & mask;
+                } else {
+                    return extract_bits(static_cast<std::uint64_t>(to_unsigned(value)), mask);
+                }
+            }
+
+            // inverse of compact_domain
+            template<typename E>
+            inline enum_type_t<E> expand_domain(std::uint64_t index) noexcept {
+                constexpr std::uint64_t mask = domain_helper<enum_type_t<E>>::value;
+                if constexpr ((mask & (mask + 1)) == 0) {
+                    return from_unsigned<E>(static_cast<unsigned_underlying_t<E>>(index));
+                } else {
+                    return from_unsigned<E>(static_cast<unsigned_underlying_t<E>>(deposit_bits(index, mask)));
+                }
+            }
+
+        } // namespace impl
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_DOMAIN_HPP_INCLUDED
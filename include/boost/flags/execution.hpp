@@ -0,0 +1,198 @@
+#ifndef BOOST_FLAGS_EXECUTION_HPP_INCLUDED
+#define BOOST_FLAGS_EXECUTION_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// execution policies for the bulk algorithms
+
+#include <boost/flags/detail/bits.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+        namespace execution {
+
+            // plain element-wise loops
+            struct scalar_t {};
+            inline constexpr scalar_t scalar{};
+
+            // SIMD kernels (resp. portable SWAR code if no SIMD instruction set is available)
+            struct simd_t {};
+            inline constexpr simd_t simd{};
+
+            // executor starting a std::thread per task (the algorithm joins all of them)
+            struct thread_executor {};
+
+            // splits the range into `tasks` chunks, each chunk is processed with the SIMD kernel
+            // an `Executor` is a callable accepting a nullary function object, it may run the function
+            // object inline or on any other thread (e.g. by posting it to a thread pool)
+            template<typename Executor>
+            struct parallel_t {
+                Executor executor;
+                std::size_t tasks;
+            };
+
+            inline parallel_t<thread_executor> parallel(std::size_t threads = 0) {
+                if (threads == 0) {
+                    threads = std::thread::hardware_concurrency();
+                }
+                return { thread_executor{}, threads == 0 ? 1 : threads };
+            }
+
+            template<typename Executor>
+            parallel_t<Executor> parallel(Executor executor, std::size_t tasks) {
+                return { std::move(executor), tasks == 0 ? 1 : tasks };
+            }
+
+        } // namespace execution
+
+        namespace impl {
+
+            // the number of chunks `parallel_chunks` splits [0, n) into (at least 1, at most n for n > 0)
+            template<typename Executor>
+            inline std::size_t parallel_tasks(execution::parallel_t<Executor> const& policy, std::size_t n) {
+                std::size_t const tasks = policy.tasks == 0 ? 1 : policy.tasks;
+                return tasks < n ? tasks : (n == 0 ? 1 : n);
+            }
+
+            // keeps the first exception thrown by any of the tasks
+            class first_exception {
+            public:
+                template<typename F>
+                void run(F const& f) {
+                    try {
+                        f();
+                    }
+                    catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        if (!error_) {
+                            error_ = std::current_exception();
+                        }
+                    }
+                }
+
+                void rethrow() const {
+                    if (error_) {
+                        std::rethrow_exception(error_);
+                    }
+                }
+
+            private:
+                std::mutex mutex_;
+                std::exception_ptr error_;
+            };
+
+            // joins the started threads, also when starting another thread or the calling thread's chunk throws
+            class join_guard {
+            public:
+                explicit join_guard(std::vector<std::thread>& threads)
+                    : threads_(threads)
+                {}
+
+                join_guard(join_guard const&) = delete;
+                join_guard& operator=(join_guard const&) = delete;
+
+                ~join_guard() {
+                    for (auto& thread : threads_) {
+                        if (thread.joinable()) {
+                            thread.join();
+                        }
+                    }
+                }
+
+            private:
+                std::vector<std::thread>& threads_;
+            };
+
+            // calls `body(task, first, last)` for `parallel_tasks(policy, n)` consecutive chunks of [0, n)
+            // and returns when all chunks are processed, the first exception thrown by `body` is rethrown
+            template<typename Body>
+            void parallel_chunks(execution::parallel_t<execution::thread_executor> const& policy, std::size_t n, Body const& body) {
+                std::size_t const tasks = parallel_tasks(policy, n);
+                std::size_t const chunk = (n + tasks - 1) / tasks;
+
+                first_exception errors;
+                std::vector<std::thread> threads;
+                threads.reserve(tasks - 1);
+                {
+                    join_guard guard(threads);
+                    for (std::size_t t = 1; t < tasks; ++t) {
+                        std::size_t const first = t * chunk < n ? t * chunk : n;
+                        std::size_t const last = first + chunk < n ? first + chunk : n;
+                        threads.emplace_back([&body, &errors, t, first, last] {
+                            errors.run([&] { body(t, first, last); });
+                        });
+                    }
+                    // the calling thread processes the first chunk
+                    errors.run([&] { body(0, 0, chunk < n ? chunk : n); });
+                }
+                errors.rethrow();
+            }
+
+            template<typename Executor, typename Body>
+            void parallel_chunks(execution::parallel_t<Executor> const& policy, std::size_t n, Body const& body) {
+                std::size_t const tasks = parallel_tasks(policy, n);
+                std::size_t const chunk = (n + tasks - 1) / tasks;
+
+                first_exception errors;
+                std::mutex mutex;
+                std::condition_variable done;
+                std::size_t posted = 0;
+                std::size_t finished = 0;
+
+                // the posted tasks refer to the locals of this function, they have to finish before it returns
+                auto const wait = [&] {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    done.wait(lock, [&] { return finished >= posted; });
+                };
+
+                try {
+                    for (std::size_t t = 0; t < tasks; ++t) {
+                        std::size_t const first = t * chunk < n ? t * chunk : n;
+                        std::size_t const last = first + chunk < n ? first + chunk : n;
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            ++posted;
+                        }
+                        try {
+                            policy.executor([&, t, first, last] {
+                                errors.run([&] { body(t, first, last); });
+                                std::lock_guard<std::mutex> lock(mutex);
+                                ++finished;
+                                done.notify_one();
+                            });
+                        }
+                        catch (...) {
+                            // a throwing executor has not accepted the task
+                            std::lock_guard<std::mutex> lock(mutex);
+                            --posted;
+                            throw;
+                        }
+                    }
+                }
+                catch (...) {
+                    wait();
+                    throw;
+                }
+
+                wait();
+                errors.rethrow();
+            }
+
+        } // namespace impl
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_EXECUTION_HPP_INCLUDED
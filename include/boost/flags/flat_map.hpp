@@ -0,0 +1,246 @@
+#ifndef BOOST_FLAGS_FLAT_MAP_HPP_INCLUDED
+#define BOOST_FLAGS_FLAT_MAP_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// sorted map with flags as keys in contiguous storage (ordered as total_order)
+
+#include <boost/flags/detail/flat_search.hpp>
+
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+
+        template<typename E, typename V>
+        class flat_flag_map {
+            static_assert(is_flags<E>::value, "boost::flags::flat_flag_map requires an enabled enum type.");
+
+            struct key_of {
+                template<typename P>
+                constexpr E operator()(P const& p) const noexcept { return p.first; }
+            };
+
+        public:
+            using key_type = E;
+            using mapped_type = V;
+            using value_type = std::pair<E, V>;
+            using key_compare = total_order_t;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = value_type&;
+            using const_reference = value_type const&;
+            using container_type = std::vector<value_type>;
+            using iterator = typename container_type::iterator;
+            using const_iterator = typename container_type::const_iterator;
+            using reverse_iterator = typename container_type::reverse_iterator;
+            using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+            flat_flag_map() = default;
+
+            template<typename InputIt>
+            flat_flag_map(InputIt first, InputIt last) {
+                insert(first, last);
+            }
+
+            flat_flag_map(std::initializer_list<value_type> values) {
+                insert(values.begin(), values.end());
+            }
+
+            // iterators (the keys must not be modified through them)
+
+            iterator begin() noexcept { return data_.begin(); }
+            iterator end() noexcept { return data_.end(); }
+            const_iterator begin() const noexcept { return data_.begin(); }
+            const_iterator end() const noexcept { return data_.end(); }
+            const_iterator cbegin() const noexcept { return data_.cbegin(); }
+            const_iterator cend() const noexcept { return data_.cend(); }
+            reverse_iterator rbegin() noexcept { return data_.rbegin(); }
+            reverse_iterator rend() noexcept { return data_.rend(); }
+            const_reverse_iterator rbegin() const noexcept { return data_.rbegin(); }
+            const_reverse_iterator rend() const noexcept { return data_.rend(); }
+
+            // capacity
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            bool empty() const noexcept { return data_.empty(); }
+            size_type size() const noexcept { return data_.size(); }
+            size_type capacity() const noexcept { return data_.capacity(); }
+            void reserve(size_type n) { data_.reserve(n); }
+            void shrink_to_fit() { data_.shrink_to_fit(); }
+
+            // the underlying sorted vector
+            container_type const& sequence() const noexcept { return data_; }
+
+            // element access
+
+            V& operator[](E key) {
+                return try_emplace(key).first->second;
+            }
+
+            V& at(E key) {
+                auto const it = find(key);
+                if (it == end()) {
+                    throw std::out_of_range("boost::flags::flat_flag_map::at");
+                }
+                return it->second;
+            }
+
+            V const& at(E key) const {
+                auto const it = find(key);
+                if (it == end()) {
+                    throw std::out_of_range("boost::flags::flat_flag_map::at");
+                }
+                return it->second;
+            }
+
+            // modifiers
+
+            template<typename... Args>
+            std::pair<iterator, bool> try_emplace(E key, Args&&... args) {
+                auto const pos = position(key);
+                if (pos != data_.size() && impl::order_key(data_[pos].first) == impl::order_key(key)) {
+                    return { data_.begin() + static_cast<difference_type>(pos), false };
+                }
+                auto const it = data_.emplace(data_.begin() + static_cast<difference_type>(pos),
+                    std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+                return { it, true };
+            }
+
+            std::pair<iterator, bool> insert(value_type const& value) {
+                return try_emplace(value.first, value.second);
+            }
+
+            std::pair<iterator, bool> insert(value_type&& value) {
+                return try_emplace(value.first, std::move(value.second));
+            }
+
+            template<typename M>
+            std::pair<iterator, bool> insert_or_assign(E key, M&& mapped) {
+                auto result = try_emplace(key, std::forward<M>(mapped));
+                if (!result.second) {
+                    result.first->second = std::forward<M>(mapped);
+                }
+                return result;
+            }
+
+            // bulk insertion: sorts the new elements and merges them in O(n + m log m)
+            // (the new elements are radix sorted if the domain comprises all bits, resp. in O(n + m) for small enums)
+            // of equal keys the already contained element resp. the first new one is kept
+            template<typename InputIt>
+            void insert(InputIt first, InputIt last) {
+                impl::bulk_merge_insert(data_, first, last, key_of{});
+            }
+
+            void insert(std::initializer_list<value_type> values) {
+                insert(values.begin(), values.end());
+            }
+
+            void merge(flat_flag_map const& other) {
+                insert(other.begin(), other.end());
+            }
+
+            iterator erase(const_iterator pos) {
+                return data_.erase(pos);
+            }
+
+            iterator erase(const_iterator first, const_iterator last) {
+                return data_.erase(first, last);
+            }
+
+            size_type erase(E key) {
+                auto const it = find(key);
+                if (it == end()) {
+                    return 0;
+                }
+                data_.erase(it);
+                return 1;
+            }
+
+            void clear() noexcept {
+                data_.clear();
+            }
+
+            void swap(flat_flag_map& other) noexcept {
+                data_.swap(other.data_);
+            }
+
+            // lookup
+
+            iterator lower_bound(E key) noexcept {
+                return data_.begin() + static_cast<difference_type>(position(key));
+            }
+
+            const_iterator lower_bound(E key) const noexcept {
+                return data_.begin() + static_cast<difference_type>(position(key));
+            }
+
+            iterator upper_bound(E key) noexcept {
+                auto const it = lower_bound(key);
+                return matches(it, key) ? it + 1 : it;
+            }
+
+            const_iterator upper_bound(E key) const noexcept {
+                auto const it = lower_bound(key);
+                return matches(it, key) ? it + 1 : it;
+            }
+
+            iterator find(E key) noexcept {
+                auto const it = lower_bound(key);
+                return matches(it, key) ? it : end();
+            }
+
+            const_iterator find(E key) const noexcept {
+                auto const it = lower_bound(key);
+                return matches(it, key) ? it : end();
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            bool contains(E key) const noexcept {
+                return find(key) != end();
+            }
+
+            size_type count(E key) const noexcept {
+                return contains(key) ? 1 : 0;
+            }
+
+            key_compare key_comp() const noexcept { return {}; }
+
+            friend bool operator==(flat_flag_map const& lhs, flat_flag_map const& rhs) {
+                return lhs.data_ == rhs.data_;
+            }
+
+            friend bool operator!=(flat_flag_map const& lhs, flat_flag_map const& rhs) {
+                return !(lhs == rhs);
+            }
+
+            friend void swap(flat_flag_map& lhs, flat_flag_map& rhs) noexcept {
+                lhs.swap(rhs);
+            }
+
+        private:
+            size_type position(E key) const noexcept {
+                return static_cast<size_type>(impl::branchless_lower_bound(data_.data(), data_.size(), key, key_of{}) - data_.data());
+            }
+
+            template<typename It>
+            bool matches(It it, E key) const noexcept {
+                return it != data_.end() && impl::order_key(it->first) == impl::order_key(key);
+            }
+
+            container_type data_;
+        };
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_FLAT_MAP_HPP_INCLUDED
@@ -0,0 +1,183 @@
+#ifndef BOOST_FLAGS_FLAT_SET_HPP_INCLUDED
+#define BOOST_FLAGS_FLAT_SET_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// sorted set of flags in contiguous storage (ordered as total_order)
+
+#include <boost/flags/detail/flat_search.hpp>
+
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+
+        template<typename E>
+        class flat_flag_set {
+            static_assert(is_flags<E>::value, "boost::flags::flat_flag_set requires an enabled enum type.");
+
+            struct key_of {
+                constexpr E operator()(E value) const noexcept { return value; }
+            };
+
+        public:
+            using key_type = E;
+            using value_type = E;
+            using key_compare = total_order_t;
+            using value_compare = total_order_t;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+            using reference = E const&;
+            using const_reference = E const&;
+            using container_type = std::vector<E>;
+            using iterator = typename container_type::const_iterator;
+            using const_iterator = iterator;
+            using reverse_iterator = typename container_type::const_reverse_iterator;
+            using const_reverse_iterator = reverse_iterator;
+
+            flat_flag_set() = default;
+
+            template<typename InputIt>
+            flat_flag_set(InputIt first, InputIt last) {
+                insert(first, last);
+            }
+
+            flat_flag_set(std::initializer_list<E> values) {
+                insert(values.begin(), values.end());
+            }
+
+            // iterators
+
+            iterator begin() const noexcept { return data_.begin(); }
+            iterator end() const noexcept { return data_.end(); }
+            iterator cbegin() const noexcept { return data_.cbegin(); }
+            iterator cend() const noexcept { return data_.cend(); }
+            reverse_iterator rbegin() const noexcept { return data_.rbegin(); }
+            reverse_iterator rend() const noexcept { return data_.rend(); }
+
+            // capacity
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            bool empty() const noexcept { return data_.empty(); }
+            size_type size() const noexcept { return data_.size(); }
+            size_type capacity() const noexcept { return data_.capacity(); }
+            void reserve(size_type n) { data_.reserve(n); }
+            void shrink_to_fit() { data_.shrink_to_fit(); }
+
+            // the underlying sorted vector
+            container_type const& sequence() const noexcept { return data_; }
+
+            // modifiers
+
+            std::pair<iterator, bool> insert(E value) {
+                auto const pos = position(value);
+                if (pos != data_.size() && impl::order_key(data_[pos]) == impl::order_key(value)) {
+                    return { data_.begin() + static_cast<difference_type>(pos), false };
+                }
+                return { data_.insert(data_.begin() + static_cast<difference_type>(pos), value), true };
+            }
+
+            // bulk insertion: sorts the new values and merges them in O(n + m log m)
+            // (the new elements are radix sorted if the domain comprises all bits, resp. in O(n + m) for small enums)
+            template<typename InputIt>
+            void insert(InputIt first, InputIt last) {
+                impl::bulk_merge_insert(data_, first, last, key_of{});
+            }
+
+            void insert(std::initializer_list<E> values) {
+                insert(values.begin(), values.end());
+            }
+
+            void merge(flat_flag_set const& other) {
+                insert(other.begin(), other.end());
+            }
+
+            iterator erase(iterator pos) {
+                return data_.erase(pos);
+            }
+
+            iterator erase(iterator first, iterator last) {
+                return data_.erase(first, last);
+            }
+
+            size_type erase(E value) {
+                auto const it = find(value);
+                if (it == end()) {
+                    return 0;
+                }
+                data_.erase(it);
+                return 1;
+            }
+
+            void clear() noexcept {
+                data_.clear();
+            }
+
+            void swap(flat_flag_set& other) noexcept {
+                data_.swap(other.data_);
+            }
+
+            // lookup
+
+            iterator lower_bound(E value) const noexcept {
+                return data_.begin() + static_cast<difference_type>(position(value));
+            }
+
+            iterator upper_bound(E value) const noexcept {
+                auto const it = lower_bound(value);
+                return (it != end() && impl::order_key(*it) == impl::order_key(value)) ? it + 1 : it;
+            }
+
+            std::pair<iterator, iterator> equal_range(E value) const noexcept {
+                auto const it = lower_bound(value);
+                return { it, (it != end() && impl::order_key(*it) == impl::order_key(value)) ? it + 1 : it };
+            }
+
+            iterator find(E value) const noexcept {
+                auto const it = lower_bound(value);
+                return (it != end() && impl::order_key(*it) == impl::order_key(value)) ? it : end();
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            bool contains(E value) const noexcept {
+                return find(value) != end();
+            }
+
+            size_type count(E value) const noexcept {
+                return contains(value) ? 1 : 0;
+            }
+
+            key_compare key_comp() const noexcept { return {}; }
+            value_compare value_comp() const noexcept { return {}; }
+
+            friend bool operator==(flat_flag_set const& lhs, flat_flag_set const& rhs) noexcept {
+                return lhs.data_ == rhs.data_;
+            }
+
+            friend bool operator!=(flat_flag_set const& lhs, flat_flag_set const& rhs) noexcept {
+                return !(lhs == rhs);
+            }
+
+            friend void swap(flat_flag_set& lhs, flat_flag_set& rhs) noexcept {
+                lhs.swap(rhs);
+            }
+
+        private:
+            size_type position(E value) const noexcept {
+                return static_cast<size_type>(impl::branchless_lower_bound(data_.data(), data_.size(), value, key_of{}) - data_.data());
+            }
+
+            container_type data_;
+        };
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_FLAT_SET_HPP_INCLUDED
@@ -0,0 +1,144 @@
+#ifndef BOOST_FLAGS_FREQUENCY_HPP_INCLUDED
+#define BOOST_FLAGS_FREQUENCY_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// streaming per-flag frequency counters
+
+#include <boost/flags/detail/positional_popcount.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace boost {
+    namespace flags {
+
+        // counts for every bit of E the number of absorbed values having that bit set
+        // the values are folded into a vertical carry-save adder tree (cf. detail/positional_popcount.hpp) in blocks of
+        // 16 wide words, the adder tree and an incomplete block are kept between calls, so many small batches are as
+        // efficient as one large batch
+        template<typename E>
+        class flag_frequency {
+            static_assert(is_flags<E>::value, "boost::flags::flag_frequency requires an enabled enum type.");
+
+            using word = impl::simd_word;
+            static constexpr std::size_t block = 16 * sizeof(typename word::type) / sizeof(enum_type_t<E>);
+
+        public:
+            using value_type = enum_type_t<E>;
+            using counters_type = std::array<std::uint64_t, sizeof(value_type) * 8>;
+
+            flag_frequency() = default;
+
+            void add(value_type value) noexcept {
+                add(&value, 1);
+            }
+
+            void add(value_type const* values, std::size_t n) noexcept {
+                size_ += n;
+                // complete the block of the previous calls
+                if (pending_size_ != 0) {
+                    std::size_t const m = (std::min)(n, block - pending_size_);
+                    std::copy(values, values + m, pending_.begin() + static_cast<std::ptrdiff_t>(pending_size_));
+                    pending_size_ += m;
+                    values += m;
+                    n -= m;
+                    if (pending_size_ < block) {
+                        return;
+                    }
+                    impl::positional_popcount_blocks<word>(counters_, state_, pending_.data(), block);
+                    pending_size_ = 0;
+                }
+                std::size_t const done = impl::positional_popcount_blocks<word>(counters_, state_, values, n);
+                // the incomplete tail is kept for the next call
+                std::copy(values + done, values + n, pending_.begin());
+                pending_size_ = n - done;
+            }
+
+            template<typename Range>
+            auto add(Range const& values) noexcept -> decltype(impl::range_data(values), void()) {
+                add(impl::range_data(values), impl::range_size(values));
+            }
+
+            // adds the counts of `other` (e.g. a per-thread partial)
+            void merge(flag_frequency const& other) noexcept {
+                for (std::size_t b = 0; b < counters_.size(); ++b) {
+                    counters_[b] += other.counters_[b];
+                }
+                auto state = other.state_;
+                impl::flush_csa<word>(counters_, state);
+                impl::positional_popcount_scalar(counters_, other.pending_.data(), other.pending_size_);
+                size_ += other.size_;
+            }
+
+            flag_frequency& operator+=(flag_frequency const& other) noexcept {
+                merge(other);
+                return *this;
+            }
+
+            // number of absorbed values
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            std::uint64_t size() const noexcept {
+                return size_;
+            }
+
+            // number of absorbed values having `flag` set (`flag` must have exactly one bit set)
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            std::uint64_t count(value_type flag) const noexcept {
+                auto const u = impl::to_unsigned(flag);
+                BOOST_FLAGS_ASSERT(u != 0 && (u & (u - 1)) == 0);
+                std::size_t const b = static_cast<std::size_t>(impl::countr_zero(static_cast<std::uint64_t>(u)));
+                return counters()[b];
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            std::uint64_t operator[](value_type flag) const noexcept {
+                return count(flag);
+            }
+
+            // counts for all bits, index `b` corresponds to `nth_bit(b)`
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            counters_type counters() const noexcept {
+                counters_type result = counters_;
+                auto state = state_;
+                impl::flush_csa<word>(result, state);
+                impl::positional_popcount_scalar(result, pending_.data(), pending_size_);
+                return result;
+            }
+
+            // calls `f(flag, count)` for every single-bit flag with a non-zero count
+            template<typename F>
+            void for_each(F&& f) const {
+                counters_type const c = counters();
+                for (std::size_t b = 0; b < c.size(); ++b) {
+                    if (c[b] != 0) {
+                        using U = impl::unsigned_underlying_t<value_type>;
+                        f(impl::from_unsigned<value_type>(static_cast<U>(U(1) << b)), c[b]);
+                    }
+                }
+            }
+
+            void clear() noexcept {
+                counters_ = {};
+                state_ = {};
+                pending_size_ = 0;
+                size_ = 0;
+            }
+
+        private:
+            counters_type counters_{};
+            impl::csa_state<typename word::type> state_{};
+            std::array<value_type, block> pending_{};
+            std::size_t pending_size_ = 0;
+            std::uint64_t size_ = 0;
+        };
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_FREQUENCY_HPP_INCLUDED
@@ -0,0 +1,380 @@
+#ifndef BOOST_FLAGS_HASH_SET_HPP_INCLUDED
+#define BOOST_FLAGS_HASH_SET_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// open-addressing hash set for flags with group probing
+//
+// every slot has a control byte: empty, deleted or (for full slots) 7 bits of the hash ("h2").
+// the slots are probed in groups of 16 (SSE2) resp. 8 (SWAR) control bytes, which are compared
+// to h2 at once, so a lookup usually inspects a single group and compares a single key
+
+#include <boost/flags/detail/bits.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+        namespace impl {
+
+            constexpr std::int8_t ctrl_empty = -128;   // 0b10000000
+            constexpr std::int8_t ctrl_deleted = -2;   // 0b11111110
+
+            // set of slot indices within a group
+            template<unsigned Shift>
+            struct group_mask {
+                std::uint64_t bits;
+
+                explicit operator bool() const noexcept { return bits != 0; }
+
+                std::size_t lowest() const noexcept {
+                    return static_cast<std::size_t>(countr_zero(bits)) >> Shift;
+                }
+
+                void remove_lowest() noexcept {
+                    bits &= bits - 1;
+                }
+            };
+
+#if BOOST_FLAGS_HAS_SSE2
+            struct probe_group {
+                static constexpr std::size_t width = 16;
+                using mask = group_mask<0>;
+
+                __m128i ctrl;
+
+                explicit probe_group(std::int8_t const* p) noexcept
+                    : ctrl(_mm_loadu_si128(reinterpret_cast<__m128i const*>(p))) {}
+
+                mask match(std::int8_t h2) const noexcept {
+                    return { static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(h2)))) };
+                }
+
+                mask match_empty() const noexcept {
+                    return { static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(ctrl_empty)))) };
+                }
+
+                // the sign bit is set exactly for empty and deleted slots
+                mask match_empty_or_deleted() const noexcept {
+                    return { static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl)) };
+                }
+            };
+#else // BOOST_FLAGS_HAS_SSE2
+            struct probe_group {
+                static constexpr std::size_t width = 8;
+                using mask = group_mask<3>;
+
+                static constexpr std::uint64_t lsbs = 0x0101010101010101ull;
+                static constexpr std::uint64_t msbs = 0x8080808080808080ull;
+
+                std::uint64_t ctrl;
+
+                explicit probe_group(std::int8_t const* p) noexcept {
+                    std::memcpy(&ctrl, p, sizeof(ctrl));
+                }
+
+                // may report false positives (bytes next to a match), which are filtered by the key comparison
+                mask match(std::int8_t h2) const noexcept {
+                    std::uint64_t const x = ctrl ^ (lsbs * static_cast<std::uint8_t>(h2));
+                    return { (x - lsbs) & ~x & msbs };
+                }
+
+                // empty has the sign bit set and bit 1 cleared
+                mask match_empty() const noexcept {
+                    return { ctrl & ~(ctrl << 6) & msbs };
+                }
+
+                mask match_empty_or_deleted() const noexcept {
+                    return { ctrl & msbs };
+                }
+            };
+#endif // BOOST_FLAGS_HAS_SSE2
+
+        } // namespace impl
+
+
+        template<typename E>
+        class flag_hash_set {
+            static_assert(is_flags<E>::value, "boost::flags::flag_hash_set requires an enabled enum type.");
+
+            using group = impl::probe_group;
+            static constexpr std::size_t group_width = group::width;
+
+        public:
+            using key_type = E;
+            using value_type = E;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+
+            class iterator {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = E;
+                using difference_type = std::ptrdiff_t;
+                using pointer = E const*;
+                using reference = E const&;
+
+                iterator() = default;
+
+                reference operator*() const noexcept { return set_->slots_[index_]; }
+                pointer operator->() const noexcept { return &set_->slots_[index_]; }
+
+                iterator& operator++() noexcept {
+                    ++index_;
+                    skip();
+                    return *this;
+                }
+
+                iterator operator++(int) noexcept {
+                    iterator result = *this;
+                    ++*this;
+                    return result;
+                }
+
+                friend bool operator==(iterator const& lhs, iterator const& rhs) noexcept {
+                    return lhs.index_ == rhs.index_;
+                }
+
+                friend bool operator!=(iterator const& lhs, iterator const& rhs) noexcept {
+                    return lhs.index_ != rhs.index_;
+                }
+
+            private:
+                friend class flag_hash_set;
+
+                iterator(flag_hash_set const* set, std::size_t index) noexcept : set_(set), index_(index) {}
+
+                void skip() noexcept {
+                    while (index_ < set_->ctrl_.size() && set_->ctrl_[index_] < 0) {
+                        ++index_;
+                    }
+                }
+
+                flag_hash_set const* set_ = nullptr;
+                std::size_t index_ = 0;
+            };
+            using const_iterator = iterator;
+
+            flag_hash_set() = default;
+
+            explicit flag_hash_set(size_type n) {
+                reserve(n);
+            }
+
+            template<typename InputIt>
+            flag_hash_set(InputIt first, InputIt last) {
+                insert(first, last);
+            }
+
+            flag_hash_set(std::initializer_list<E> values) {
+                insert(values.begin(), values.end());
+            }
+
+            iterator begin() const noexcept {
+                iterator it(this, 0);
+                it.skip();
+                return it;
+            }
+
+            iterator end() const noexcept {
+                return iterator(this, ctrl_.size());
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            bool empty() const noexcept { return size_ == 0; }
+            size_type size() const noexcept { return size_; }
+            size_type capacity() const noexcept { return ctrl_.size(); }
+
+            // ensures that n elements can be held without rehashing
+            void reserve(size_type n) {
+                std::size_t capacity = group_width;
+                while (capacity / 8 * 7 < n) {
+                    capacity *= 2;
+                }
+                if (capacity > ctrl_.size()) {
+                    rehash(capacity);
+                }
+            }
+
+            std::pair<iterator, bool> insert(E value) {
+                std::size_t const hash = impl::hash_flags(value);
+                std::size_t const found = find_index(value, hash);
+                if (found != npos) {
+                    return { iterator(this, found), false };
+                }
+                if (size_ + deleted_ + 1 > ctrl_.size() / 8 * 7) {
+                    // grow, or just purge the deleted slots if they are the majority
+                    rehash(ctrl_.empty() ? group_width : (size_ + 1 > ctrl_.size() / 16 * 7 ? ctrl_.size() * 2 : ctrl_.size()));
+                }
+                std::size_t const index = insert_slot(hash);
+                if (ctrl_[index] == impl::ctrl_deleted) {
+                    --deleted_;
+                }
+                ctrl_[index] = h2(hash);
+                slots_[index] = value;
+                ++size_;
+                return { iterator(this, index), true };
+            }
+
+            template<typename InputIt>
+            void insert(InputIt first, InputIt last) {
+                for (; first != last; ++first) {
+                    insert(*first);
+                }
+            }
+
+            void insert(std::initializer_list<E> values) {
+                insert(values.begin(), values.end());
+            }
+
+            size_type erase(E value) noexcept {
+                std::size_t const index = find_index(value, impl::hash_flags(value));
+                if (index == npos) {
+                    return 0;
+                }
+                ctrl_[index] = impl::ctrl_deleted;
+                --size_;
+                ++deleted_;
+                return 1;
+            }
+
+            iterator erase(iterator pos) noexcept {
+                ctrl_[pos.index_] = impl::ctrl_deleted;
+                --size_;
+                ++deleted_;
+                return ++pos;
+            }
+
+            void clear() noexcept {
+                std::fill(ctrl_.begin(), ctrl_.end(), impl::ctrl_empty);
+                size_ = 0;
+                deleted_ = 0;
+            }
+
+            void swap(flag_hash_set& other) noexcept {
+                ctrl_.swap(other.ctrl_);
+                slots_.swap(other.slots_);
+                std::swap(size_, other.size_);
+                std::swap(deleted_, other.deleted_);
+            }
+
+            iterator find(E value) const noexcept {
+                std::size_t const index = find_index(value, impl::hash_flags(value));
+                return index == npos ? end() : iterator(this, index);
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            bool contains(E value) const noexcept {
+                return find_index(value, impl::hash_flags(value)) != npos;
+            }
+
+            size_type count(E value) const noexcept {
+                return contains(value) ? 1 : 0;
+            }
+
+            friend bool operator==(flag_hash_set const& lhs, flag_hash_set const& rhs) noexcept {
+                if (lhs.size() != rhs.size()) {
+                    return false;
+                }
+                for (E value : lhs) {
+                    if (!rhs.contains(value)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            friend bool operator!=(flag_hash_set const& lhs, flag_hash_set const& rhs) noexcept {
+                return !(lhs == rhs);
+            }
+
+            friend void swap(flag_hash_set& lhs, flag_hash_set& rhs) noexcept {
+                lhs.swap(rhs);
+            }
+
+        private:
+            static constexpr std::size_t npos = ~std::size_t(0);
+
+            static std::int8_t h2(std::size_t hash) noexcept {
+                return static_cast<std::int8_t>(hash & 0x7f);
+            }
+
+            std::size_t groups_mask() const noexcept {
+                return ctrl_.size() / group_width - 1;
+            }
+
+            // triangular probing over the groups (visits every group, as the number of groups is a power of 2)
+            std::size_t find_index(E value, std::size_t hash) const noexcept {
+                if (ctrl_.empty()) {
+                    return npos;
+                }
+                auto const key = impl::get_underlying_impl(value);
+                std::size_t const mask = groups_mask();
+                std::size_t g = (hash >> 7) & mask;
+                for (std::size_t step = 1;; ++step) {
+                    std::size_t const base = g * group_width;
+                    group const grp(ctrl_.data() + base);
+                    for (auto m = grp.match(h2(hash)); m; m.remove_lowest()) {
+                        std::size_t const index = base + m.lowest();
+                        // (the SWAR match may report neighbouring non-matching bytes)
+                        if (ctrl_[index] == h2(hash) && impl::get_underlying_impl(slots_[index]) == key) {
+                            return index;
+                        }
+                    }
+                    if (grp.match_empty() || step > mask) {
+                        return npos;
+                    }
+                    g = (g + step) & mask;
+                }
+            }
+
+            // first empty or deleted slot of the probe sequence (requires a free slot)
+            std::size_t insert_slot(std::size_t hash) const noexcept {
+                std::size_t const mask = groups_mask();
+                std::size_t g = (hash >> 7) & mask;
+                for (std::size_t step = 1;; ++step) {
+                    std::size_t const base = g * group_width;
+                    auto const m = group(ctrl_.data() + base).match_empty_or_deleted();
+                    if (m) {
+                        return base + m.lowest();
+                    }
+                    g = (g + step) & mask;
+                }
+            }
+
+            void rehash(std::size_t capacity) {
+                std::vector<std::int8_t> old_ctrl(capacity, impl::ctrl_empty);
+                std::vector<E> old_slots(capacity);
+                old_ctrl.swap(ctrl_);
+                old_slots.swap(slots_);
+                deleted_ = 0;
+                for (std::size_t i = 0; i < old_ctrl.size(); ++i) {
+                    if (old_ctrl[i] >= 0) {
+                        std::size_t const hash = impl::hash_flags(old_slots[i]);
+                        std::size_t const index = insert_slot(hash);
+                        ctrl_[index] = h2(hash);
+                        slots_[index] = old_slots[i];
+                    }
+                }
+            }
+
+            std::vector<std::int8_t> ctrl_;
+            std::vector<E> slots_;
+            std::size_t size_ = 0;
+            std::size_t deleted_ = 0;
+        };
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_HASH_SET_HPP_INCLUDED
@@ -0,0 +1,1195 @@
+#ifndef BOOST_FLAGS_MACROS_HPP_INCLUDED
+#define BOOST_FLAGS_MACROS_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// configuration and macros of Boost.Flags without any declarations
+//
+// included by <boost/flags.hpp>; when Boost.Flags is used as module (`import boost.flags;`) this header
+// provides the macros (BOOST_FLAGS_ENABLE, BOOST_FLAGS, BOOST_FLAGS_AND, ...), as modules do not export macros
+
+#include <cstddef>
+#include <type_traits>
+
+// the library feature-test macros must not depend on previously included headers, otherwise
+// the configuration of a module and its importers might differ
+#if defined(__has_include)
+# if __has_include(<version>)
+#  include <version>
+# endif
+#endif
+
+
+// detect g++ compiler
+#if defined(__GNUC__) && (!defined(__clang__) || defined(__MINGW32__))
+# define BOOST_FLAGS_IS_GCC_COMPILER 1
+#else // defined(__GNUC__) && !defined(__clang__)
+# define BOOST_FLAGS_IS_GCC_COMPILER 0
+#endif // defined(__GNUC__) && !defined(__clang__)
+
+
+// check if the spaceship has already landed
+#if !defined(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
+// g++ does not allow overwriting rel. operators with spaceship for enums 
+// cf. https://cplusplus.github.io/CWG/issues/2673.html
+// cf. https://gcc.gnu.org/bugzilla/show_bug.cgi?id=105200
+// hopefully g++ 15 will have fixed it
+# if (BOOST_FLAGS_IS_GCC_COMPILER && __GNUC__ < 15) || !defined(__cpp_impl_three_way_comparison)
+#  define BOOST_FLAGS_HAS_THREE_WAY_COMPARISON 0
+# else // (BOOST_FLAGS_IS_GCC_COMPILER && __GNUC__ < 15) || !defined(__cpp_impl_three_way_comparison)
+#  define BOOST_FLAGS_HAS_THREE_WAY_COMPARISON 1
+# endif // (BOOST_FLAGS_IS_GCC_COMPILER && __GNUC__ < 15) || !defined(__cpp_impl_three_way_comparison)
+#endif // !defined(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
+
+
+// check for library support of three-way-comparison (flags will use std::partial_ordering)
+#if !defined(BOOST_FLAGS_HAS_PARTIAL_ORDERING)
+# if defined(__has_include)
+#  if __has_include(<compare>) && defined(__cpp_lib_three_way_comparison) && (__cpp_lib_three_way_comparison >= 201907L)
+#   define BOOST_FLAGS_HAS_PARTIAL_ORDERING 1
+#  else // __has_include(<compare>) && defined(__cpp_lib_three_way_comparison) && (__cpp_lib_three_way_comparison >= 201907L)
+#   define BOOST_FLAGS_HAS_PARTIAL_ORDERING 0
+#  endif // __has_include(<compare>) && defined(__cpp_lib_three_way_comparison) && (__cpp_lib_three_way_comparison >= 201907L)
+# else // defined(__has_include)
+#  define BOOST_FLAGS_HAS_PARTIAL_ORDERING 0
+# endif // defined(__has_include)
+#endif // !defined(BOOST_FLAGS_HAS_PARTIAL_ORDERING)
+
+#if (BOOST_FLAGS_HAS_THREE_WAY_COMPARISON) && !(BOOST_FLAGS_HAS_PARTIAL_ORDERING)
+// this should usually not happen as spaceship requires std::partial_ordering
+# undef BOOST_FLAGS_HAS_PARTIAL_ORDERING
+# define BOOST_FLAGS_HAS_PARTIAL_ORDERING 1
+#endif // (BOOST_FLAGS_HAS_THREE_WAY_COMPARISON) && !(BOOST_FLAGS_HAS_PARTIAL_ORDERING)
+
+// [[nodiscard]] attribute
+#if !defined(BOOST_FLAGS_ATTRIBUTE_NODISCARD)
+# if defined(__has_attribute) && defined(__SUNPRO_CC) && (__SUNPRO_CC > 0x5130)
+# if __has_attribute(nodiscard)
+#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD [[nodiscard]]
+# endif
+# elif defined(__has_cpp_attribute)
+// clang-6 accepts [[nodiscard]] with -std=c++14, but warns about it -pedantic
+# if __has_cpp_attribute(nodiscard) && !(defined(__clang__) && (__cplusplus < 201703L)) && !(defined(__GNUC__) && (__cplusplus < 201100))
+#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD [[nodiscard]]
+# endif
+# endif
+# ifndef BOOST_FLAGS_ATTRIBUTE_NODISCARD
+#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD
+# endif
+#endif // !defined(BOOST_FLAGS_ATTRIBUTE_NODISCARD)
+
+
+#if !defined(BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR)
+# if (defined(__clang_major__) && (__clang_major__ < 10)) || (defined(__GNUC__) && (__GNUC__ < 10))
+#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR
+# else // (defined(__clang_major__) && (__clang_major__ < 10)) || (defined(__GNUC__) && (__GNUC__ < 10))
+#  define BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR BOOST_FLAGS_ATTRIBUTE_NODISCARD
+# endif // (defined(__clang_major__) && (__clang_major__ < 10)) || (defined(__GNUC__) && (__GNUC__ < 10))
+#endif // !defined(BOOST_FLAGS_ATTRIBUTE_NODISCARD_CTOR)
+
+
+// BOOST_FLAGS_DEBUG_INLINE: force inlining of the operators and get_underlying also in unoptimized builds (-O0, -Og),
+// `artificial` lets the debugger step over them like built-in operators
+#if !defined(BOOST_FLAGS_ATTRIBUTE_FORCEINLINE)
+# if defined(BOOST_FLAGS_DEBUG_INLINE)
+#  if defined(__GNUC__) || defined(__clang__)
+#   if defined(__has_attribute)
+#    if __has_attribute(__artificial__)
+#     define BOOST_FLAGS_ATTRIBUTE_FORCEINLINE __attribute__((__always_inline__, __artificial__))
+#    endif
+#   endif
+#   ifndef BOOST_FLAGS_ATTRIBUTE_FORCEINLINE
+#    define BOOST_FLAGS_ATTRIBUTE_FORCEINLINE __attribute__((__always_inline__))
+#   endif
+#  elif defined(_MSC_VER)
+// note: MSVC ignores __forceinline with /Od, debug builds require /Ob1
+#   define BOOST_FLAGS_ATTRIBUTE_FORCEINLINE __forceinline
+#  endif
+# endif // defined(BOOST_FLAGS_DEBUG_INLINE)
+# ifndef BOOST_FLAGS_ATTRIBUTE_FORCEINLINE
+#  define BOOST_FLAGS_ATTRIBUTE_FORCEINLINE
+# endif
+#endif // !defined(BOOST_FLAGS_ATTRIBUTE_FORCEINLINE)
+
+
+// adapted from boost/asio/detail/config.hpp
+// Support concepts on compilers known to allow them.
+#if !defined(BOOST_FLAGS_HAS_CONCEPTS)
+# if !defined(BOOST_FLAGS_DISABLE_CONCEPTS)
+#  if defined(__cpp_concepts)
+#   define BOOST_FLAGS_HAS_CONCEPTS 1
+#   if (__cpp_concepts >= 201707)
+#    define BOOST_FLAGS_CONCEPT concept
+#   else // (__cpp_concepts >= 201707)
+#    define BOOST_FLAGS_CONCEPT concept bool
+#   endif // (__cpp_concepts >= 201707)
+#  else // defined(__cpp_concepts)
+#   define BOOST_FLAGS_HAS_CONCEPTS 0
+#  endif // defined(__cpp_concepts)
+# else // !defined(BOOST_FLAGS_DISABLE_CONCEPTS)
+#  define BOOST_FLAGS_HAS_CONCEPTS 0
+# endif // !defined(BOOST_FLAGS_DISABLE_CONCEPTS)
+#endif // !defined(BOOST_FLAGS_HAS_CONCEPTS)
+
+
+// check if std::is_scoped_enum is available
+#if !defined(BOOST_FLAGS_HAS_IS_SCOPED_ENUM)
+# if defined(__cpp_lib_is_scoped_enum)
+#  define BOOST_FLAGS_HAS_IS_SCOPED_ENUM 1
+# else // defined(__cpp_lib_is_scoped_enum)
+#  define BOOST_FLAGS_HAS_IS_SCOPED_ENUM 0
+# endif // defined(__cpp_lib_is_scoped_enum)
+#endif // !defined(BOOST_FLAGS_HAS_IS_SCOPED_ENUM)
+
+
+// check for std::conjunction, std::disjunction and std::negation
+#if !defined(BOOST_FLAGS_HAS_LOGICAL_TRAITS)
+# if defined(__cpp_lib_logical_traits)
+#  define BOOST_FLAGS_HAS_LOGICAL_TRAITS 1
+# else //  defined(__cpp_lib_logical_traits)
+#  define BOOST_FLAGS_HAS_LOGICAL_TRAITS 0
+# endif //  defined(__cpp_lib_logical_traits)
+#endif // !defined(BOOST_FLAGS_HAS_LOGICAL_TRAITS)
+
+
+// operator rewritten candidates
+#if !defined(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
+# if __cplusplus < 202002L
+#  define BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES 0
+# else // __cplusplus < 202002L
+#  define BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES 1
+# endif // __cplusplus<202002L
+#endif // !defined(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
+
+
+// Variable templates
+#if !defined(BOOST_FLAGS_HAS_VARIABLE_TEMPLATES)
+# if defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
+#  define BOOST_FLAGS_HAS_VARIABLE_TEMPLATES 1
+# else // defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
+#  define BOOST_FLAGS_HAS_VARIABLE_TEMPLATES 0
+# endif // defined(__cpp_variable_templates) && __cpp_variable_templates >= 201304L
+#endif // !defined(BOOST_FLAGS_HAS_VARIABLE_TEMPLATES)
+
+
+// assumption for the optimizer (options::assume_domain): an expression of type void, so it can be used
+// in C++11 constexpr functions (in contrast to the statement `[[assume(cond)]]`)
+#if !defined(BOOST_FLAGS_ASSUME)
+# if defined(__GNUC__) || defined(__clang__)
+#  define BOOST_FLAGS_ASSUME(cond) ((cond) ? void(0) : __builtin_unreachable())
+# elif defined(_MSC_VER)
+#  define BOOST_FLAGS_ASSUME(cond) ((cond) ? void(0) : __assume(0))
+# else
+#  define BOOST_FLAGS_ASSUME(cond) void(0)
+# endif
+#endif // !defined(BOOST_FLAGS_ASSUME)
+
+
+// detection of constant evaluation (the check policies options::check_assert, check_mask and check_trap
+// are not applied in constant expressions, without detection check_assert and check_trap are not applied
+// at all and check_mask doesn't compile)
+#if !defined(BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED)
+# if defined(__has_builtin)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#   define BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED 1
+#  endif
+# endif
+# if !defined(BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED)
+#  if (BOOST_FLAGS_IS_GCC_COMPILER && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+#   define BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED 1
+#  else
+#   define BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED 0
+#  endif
+# endif
+#endif // !defined(BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED)
+
+#if BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED
+# define BOOST_FLAGS_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else // BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED
+# define BOOST_FLAGS_IS_CONSTANT_EVALUATED() true
+#endif // BOOST_FLAGS_HAS_IS_CONSTANT_EVALUATED
+
+
+// options::check_assert and options::check_trap are only active if BOOST_FLAGS_ENABLE_CHECKS is 1
+// (default: 1 unless NDEBUG is defined), options::check_mask is always active
+#if !defined(BOOST_FLAGS_ENABLE_CHECKS)
+# if defined(NDEBUG)
+#  define BOOST_FLAGS_ENABLE_CHECKS 0
+# else // defined(NDEBUG)
+#  define BOOST_FLAGS_ENABLE_CHECKS 1
+# endif // defined(NDEBUG)
+#endif // !defined(BOOST_FLAGS_ENABLE_CHECKS)
+
+// assertion used by options::check_assert (an expression of type void)
+#if !defined(BOOST_FLAGS_ASSERT)
+# include <cassert>
+# define BOOST_FLAGS_ASSERT(cond) assert(cond)
+#endif // !defined(BOOST_FLAGS_ASSERT)
+
+// immediate termination used by options::check_trap (an expression of type void)
+#if !defined(BOOST_FLAGS_TRAP)
+# if defined(__GNUC__) || defined(__clang__)
+#  define BOOST_FLAGS_TRAP() __builtin_trap()
+# else
+#  include <cstdlib>
+#  define BOOST_FLAGS_TRAP() std::abort()
+# endif
+#endif // !defined(BOOST_FLAGS_TRAP)
+
+
+// per-call-site profiling of the flag tests any, none, intersect, disjoint and BOOST_FLAGS_AND
+// (cf. <boost/flags/profile.hpp>, requires C++20), must be equal for all translation units
+#if !defined(BOOST_FLAGS_PROFILE)
+# define BOOST_FLAGS_PROFILE 0
+#endif // !defined(BOOST_FLAGS_PROFILE)
+
+#if BOOST_FLAGS_PROFILE
+# define BOOST_FLAGS_PROFILE_LOCATION_PARAM , std::source_location boost_flags_location = std::source_location::current()
+# define BOOST_FLAGS_PROFILE_LOCATION_MEMBER std::source_location location = std::source_location::current();
+# define BOOST_FLAGS_PROFILE_TEST(result, location) ::boost::flags::profile::impl::test((result), (location))
+#else // BOOST_FLAGS_PROFILE
+# define BOOST_FLAGS_PROFILE_LOCATION_PARAM
+# define BOOST_FLAGS_PROFILE_LOCATION_MEMBER
+# define BOOST_FLAGS_PROFILE_TEST(result, location) (result)
+#endif // BOOST_FLAGS_PROFILE
+
+
+// check, if consteval is available
+#ifdef __cpp_consteval
+#define BOOST_FLAGS_CONSTEVAL consteval
+#else
+#define BOOST_FLAGS_CONSTEVAL constexpr
+#endif
+
+
+#define BOOST_FLAGS_EMPTY()
+
+
+///////////////////////////////////////////////////////////////////////////////////////
+//
+// macros
+//
+
+
+
+// NOTE: The forwarding operators deliberately do not use concepts/SFINAE, as this will generate
+// ambiguity errors if the operators are also found via `using`-declarations.
+// Specifying the enum type directly as parameter type ensures that these overloads are 
+// distinguishable from the templates in namespace boost::flags.
+
+#define BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, op, RET)                                     \
+BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND BOOST_FLAGS_ATTRIBUTE_FORCEINLINE                            \
+constexpr RET operator op(E l, E r) noexcept {                                                      \
+    return ::boost::flags::operator op(l, r);                                                       \
+}                                                                                                   \
+
+#define BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, op, RET)                                      \
+BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND BOOST_FLAGS_ATTRIBUTE_FORCEINLINE                            \
+constexpr RET operator op(E v) noexcept {                                                           \
+    return ::boost::flags::operator op(v);                                                          \
+}                                                                                                   \
+
+#define BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, op)                                      \
+FRIEND BOOST_FLAGS_ATTRIBUTE_FORCEINLINE constexpr E& operator op(E& l, E r) noexcept {             \
+    return ::boost::flags::operator op(l, r);                                                       \
+}                                                                                                   \
+
+
+// NOTE: The deleted forwarding operators must use concepts/SFINAE, as these may not be
+// instantiated and otherwise would lead to hard errors
+
+#if BOOST_FLAGS_HAS_CONCEPTS
+
+#define BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, op, RET)                                      \
+template<typename T> requires std::is_same<T, E>::value                                             \
+BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(T l, T r) noexcept {               \
+    return ::boost::flags::operator op(l, r);                                                       \
+}                                                                                                   \
+
+#define BOOST_FLAGS_DELETE_UNARY_OPERATOR(E, FRIEND, op, RET)                                       \
+template<typename T> requires std::is_same<T, E>::value                                             \
+BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(T v) noexcept {                    \
+    return ::boost::flags::operator op(v);                                                          \
+}                                                                                                   \
+
+#define BOOST_FLAGS_DELETE_ASSIGNMENT_OPERATOR(E, FRIEND, op)                                       \
+template<typename T> requires std::is_same<T, E>::value                                             \
+FRIEND constexpr E& operator op(T& l, T r) noexcept {                                               \
+    return ::boost::flags::operator op(l, r);                                                       \
+}                                                                                                   \
+
+#else // BOOST_FLAGS_HAS_CONCEPTS
+
+#define BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, op, RET)                                      \
+template<typename T, typename std::enable_if<std::is_same<T, E>::value, int*>::type = nullptr>      \
+BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(T l, T r) noexcept {               \
+    return ::boost::flags::operator op(l, r);                                                       \
+}                                                                                                   \
+
+#define BOOST_FLAGS_DELETE_UNARY_OPERATOR(E, FRIEND, op, RET)                                       \
+template<typename T, typename std::enable_if<std::is_same<T, E>::value, int*>::type = nullptr>      \
+BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND constexpr RET operator op(T v) noexcept {                    \
+    return ::boost::flags::operator op(v);                                                          \
+}                                                                                                   \
+
+#define BOOST_FLAGS_DELETE_ASSIGNMENT_OPERATOR(E, FRIEND, op)                                       \
+template<typename T, typename std::enable_if<std::is_same<T, E>::value, int*>::type = nullptr>      \
+FRIEND constexpr E& operator op(T& l, T r) noexcept {                                               \
+    return ::boost::flags::operator op(l, r);                                                       \
+}                                                                                                   \
+
+#endif // BOOST_FLAGS_HAS_CONCEPTS
+
+
+
+
+
+#if !(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
+
+#define BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, op, RET)                                   \
+BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND BOOST_FLAGS_ATTRIBUTE_FORCEINLINE                            \
+constexpr RET operator op(E l, std::nullptr_t r) noexcept {                                         \
+    return ::boost::flags::operator op(l, r);                                                       \
+}                                                                                                   \
+BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND BOOST_FLAGS_ATTRIBUTE_FORCEINLINE                            \
+constexpr RET operator op(std::nullptr_t l, E r) noexcept {                                         \
+    return ::boost::flags::operator op(l, r);                                                       \
+}                                                                                                   \
+
+
+# define BOOST_FLAGS_USING_OPERATOR_NOT_EQUAL   using ::boost::flags::operator!=;
+# define BOOST_FLAGS_FORWARD_OPERATOR_NOT_EQUAL(E, FRIEND)                                          \
+BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, !=, bool)
+
+#else // !(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
+
+#define BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, op, RET)                                   \
+BOOST_FLAGS_ATTRIBUTE_NODISCARD FRIEND BOOST_FLAGS_ATTRIBUTE_FORCEINLINE                            \
+constexpr RET operator op(E l, std::nullptr_t r) noexcept {                                         \
+    return ::boost::flags::operator op(l, r);                                                       \
+}                                                                                                   \
+
+
+# define BOOST_FLAGS_USING_OPERATOR_NOT_EQUAL
+# define BOOST_FLAGS_FORWARD_OPERATOR_NOT_EQUAL(E, FRIEND)
+
+
+#endif // !(BOOST_FLAGS_HAS_REWRITTEN_CANDIDATES)
+
+#if BOOST_FLAGS_HAS_PARTIAL_ORDERING
+
+# define BOOST_FLAGS_USING_OPERATOR_SPACESHIP using ::boost::flags::operator<=>;
+# define BOOST_FLAGS_FORWARD_OPERATOR_SPACESHIP(E, FRIEND)                                          \
+BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, <=>, std::partial_ordering)
+
+#else // BOOST_FLAGS_HAS_PARTIAL_ORDERING
+# define BOOST_FLAGS_USING_OPERATOR_SPACESHIP
+# define BOOST_FLAGS_FORWARD_OPERATOR_SPACESHIP(E, FRIEND)
+#endif // BOOST_FLAGS_HAS_PARTIAL_ORDERING
+
+#if defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
+
+#define BOOST_FLAGS_USING_OPERATORS()                                                               \
+using ::boost::flags::operator|;                                                                    \
+using ::boost::flags::operator&;                                                                    \
+using ::boost::flags::operator^;                                                                    \
+using ::boost::flags::operator~;                                                                    \
+using ::boost::flags::operator|=;                                                                   \
+using ::boost::flags::operator&=;                                                                   \
+using ::boost::flags::operator^=;                                                                   \
+using ::boost::flags::operator!;                                                                    \
+using ::boost::flags::operator==;                                                                   \
+BOOST_FLAGS_USING_OPERATOR_NOT_EQUAL                                                                \
+BOOST_FLAGS_USING_OPERATOR_SPACESHIP                                                                \
+using ::boost::flags::operator&&;                                                                   \
+using ::boost::flags::operator||;                                                                   \
+using ::boost::flags::operator++;                                                                   \
+using ::boost::flags::operator-;                                                                    \
+using ::boost::flags::operator*;                                                                    \
+using ::boost::flags::operator/;                                                                    \
+using ::boost::flags::operator%;                                                                    \
+using ::boost::flags::operator<<;                                                                   \
+using ::boost::flags::operator>>;                                                                   \
+
+#else // defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
+
+#define BOOST_FLAGS_USING_OPERATORS()                                                               \
+using ::boost::flags::operator|;                                                                    \
+using ::boost::flags::operator&;                                                                    \
+using ::boost::flags::operator^;                                                                    \
+using ::boost::flags::operator~;                                                                    \
+using ::boost::flags::operator|=;                                                                   \
+using ::boost::flags::operator&=;                                                                   \
+using ::boost::flags::operator^=;                                                                   \
+using ::boost::flags::operator!;                                                                    \
+using ::boost::flags::operator==;                                                                   \
+BOOST_FLAGS_USING_OPERATOR_NOT_EQUAL                                                                \
+BOOST_FLAGS_USING_OPERATOR_SPACESHIP                                                                \
+using ::boost::flags::operator&&;                                                                   \
+using ::boost::flags::operator||;                                                                   \
+using ::boost::flags::operator++;                                                                   \
+
+#endif // defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
+
+#define BOOST_FLAGS_USING_UTILITIES()                                                               \
+using ::boost::flags::any;                                                                          \
+using ::boost::flags::none;                                                                         \
+using ::boost::flags::subseteq;                                                                     \
+using ::boost::flags::subset;                                                                       \
+using ::boost::flags::intersect;                                                                    \
+using ::boost::flags::disjoint;                                                                     \
+using ::boost::flags::make_null;                                                                    \
+using ::boost::flags::make_if;                                                                      \
+using ::boost::flags::modify;                                                                       \
+using ::boost::flags::modify_inplace;                                                               \
+using ::boost::flags::add_if;                                                                       \
+using ::boost::flags::add_if_inplace;                                                               \
+using ::boost::flags::remove_if;                                                                    \
+using ::boost::flags::remove_if_inplace;                                                            \
+using ::boost::flags::get_underlying;                                                               \
+
+#define BOOST_FLAGS_USING_ALL()                                                                     \
+BOOST_FLAGS_USING_OPERATORS()                                                                       \
+BOOST_FLAGS_USING_UTILITIES()                                                                       \
+
+
+
+#if defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
+
+#define BOOST_FLAGS_FORWARD_OPERATORS_IMPL(E, C, FRIEND)                                            \
+BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, |, E)                                                \
+BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, &, E)                                                \
+BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, ^, E)                                                \
+BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, ~, C)                                                 \
+BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, |=)                                              \
+BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, &=)                                              \
+BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, ^=)                                              \
+BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, !, bool)                                              \
+BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, ==, bool)                                          \
+BOOST_FLAGS_FORWARD_OPERATOR_NOT_EQUAL(E, FRIEND)                                                   \
+BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, +, unsigned int)                                      \
+BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, -, unsigned int)                                      \
+BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, *, unsigned int)                                      \
+BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, / , unsigned int)                                     \
+BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, %, unsigned int)                                      \
+BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, << , unsigned int)                                    \
+BOOST_FLAGS_DELETE_BINARY_OPERATOR(E, FRIEND, >> , unsigned int)                                    \
+
+#else // defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
+
+#define BOOST_FLAGS_FORWARD_OPERATORS_IMPL(E, C, FRIEND)                                            \
+BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, |, E)                                                \
+BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, &, E)                                                \
+BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, FRIEND, ^, E)                                                \
+BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, ~, C)                                                 \
+BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, |=)                                              \
+BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, &=)                                              \
+BOOST_FLAGS_FORWARD_ASSIGNMENT_OPERATOR(E, FRIEND, ^=)                                              \
+BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, FRIEND, !, bool)                                              \
+BOOST_FLAGS_FORWARD_EQUALITY_OPERATOR(E, FRIEND, ==, bool)                                          \
+BOOST_FLAGS_FORWARD_OPERATOR_NOT_EQUAL(E, FRIEND)                                                   \
+
+#endif // defined(BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS) && BOOST_FLAGS_DELETE_ARITHMETIC_OPERATORS == 1
+
+
+#define BOOST_FLAGS_FORWARD_OPERATORS(E)                                                            \
+BOOST_FLAGS_FORWARD_OPERATORS_IMPL(E, ::boost::flags::complement<E>, BOOST_FLAGS_EMPTY())
+
+#define BOOST_FLAGS_FORWARD_OPERATORS_LOCAL(E)                                                      \
+BOOST_FLAGS_FORWARD_OPERATORS_IMPL(E, ::boost::flags::complement<E>, friend)
+
+
+#define BOOST_FLAGS_SPECIALIZE_STD_LESS(E)                                                          \
+ /* specialize std::less for E and complement<E> */                                                 \
+ /* at least gcc < version 7 is not conforming with template specialization */                      \
+ /* put it explicitly into namespace std to make them all happy */                                  \
+namespace std {                                                                                     \
+    template<>                                                                                      \
+    struct less<E> {                                                                                \
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD                                                             \
+            constexpr bool operator()(E const& lhs, E const& rhs) const noexcept {                  \
+            return boost::flags::total_order(lhs, rhs);                                             \
+        }                                                                                           \
+    };                                                                                              \
+    template<>                                                                                      \
+    struct less<boost::flags::complement<E>> {                                                      \
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD                                                             \
+            constexpr bool operator()(                                                              \
+                boost::flags::complement<E> const& lhs,                                             \
+                boost::flags::complement<E> const& rhs                                              \
+                ) const noexcept {                                                                  \
+            return boost::flags::total_order(lhs, rhs);                                             \
+        }                                                                                           \
+    };                                                                                              \
+} /* namespace std */
+
+
+#define BOOST_FLAGS_SPECIALIZE_STD_HASH(E)                                                          \
+ /* specialize std::hash for E and complement<E> with a strong bit mixer */                         \
+namespace std {                                                                                     \
+    template<>                                                                                      \
+    struct hash<E> {                                                                                \
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD                                                             \
+            std::size_t operator()(E const& value) const noexcept {                                 \
+            return boost::flags::impl::hash_flags(value);                                           \
+        }                                                                                           \
+    };                                                                                              \
+    template<>                                                                                      \
+    struct hash<boost::flags::complement<E>> {                                                      \
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD                                                             \
+            std::size_t operator()(boost::flags::complement<E> const& value) const noexcept {       \
+            return boost::flags::impl::hash_flags(value);                                           \
+        }                                                                                           \
+    };                                                                                              \
+} /* namespace std */
+
+#if !(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
+
+#if BOOST_FLAGS_HAS_CONCEPTS
+
+#define BOOST_FLAGS_DELETE_REL_IMPL(E, FRIEND)                                                      \
+/* matches better than built-in relational operators */                                             \
+FRIEND bool operator< (E l, E r) = delete;                                                          \
+FRIEND bool operator<= (E l, E r) = delete;                                                         \
+FRIEND bool operator> (E l, E r) = delete;                                                          \
+FRIEND bool operator>= (E l, E r) = delete;                                                         \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2>                                                                  \
+    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
+    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
+FRIEND bool operator< (T1 l, T2 r) = delete;                                                        \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2>                                                                  \
+    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
+    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
+FRIEND bool operator<= (T1 l, T2 r) = delete;                                                       \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2>                                                                  \
+    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
+    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
+FRIEND bool operator> (T1 l, T2 r) = delete;                                                        \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2>                                                                  \
+    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
+    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
+FRIEND bool operator>= (T1 l, T2 r) = delete;                                                       \
+                                                                                                    \
+
+
+
+#else // BOOST_FLAGS_HAS_CONCEPTS
+
+#define BOOST_FLAGS_DELETE_REL_IMPL(E, FRIEND)                                                      \
+/* matches better than built-in relational operators */                                             \
+FRIEND bool operator< (E l, E r) = delete;                                                          \
+FRIEND bool operator<= (E l, E r) = delete;                                                         \
+FRIEND bool operator> (E l, E r) = delete;                                                          \
+FRIEND bool operator>= (E l, E r) = delete;                                                         \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2,                                                                  \
+    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
+    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
+FRIEND bool operator< (T1 l, T2 r) = delete;                                                        \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2,                                                                  \
+    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
+    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
+FRIEND bool operator<= (T1 l, T2 r) = delete;                                                       \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2,                                                                  \
+    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
+    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
+FRIEND bool operator> (T1 l, T2 r) = delete;                                                        \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2,                                                                  \
+    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
+    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
+FRIEND bool operator>= (T1 l, T2 r) = delete;                                                       \
+                                                                                                    \
+
+
+#endif // BOOST_FLAGS_HAS_CONCEPTS
+
+
+#else // !(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
+
+#if BOOST_FLAGS_HAS_CONCEPTS
+
+#define BOOST_FLAGS_DELETE_REL_IMPL(E, FRIEND)                                                      \
+/* matches better than built-in relational operators */                                             \
+FRIEND bool operator< (E l, E r) = delete;                                                          \
+FRIEND bool operator<= (E l, E r) = delete;                                                         \
+FRIEND bool operator> (E l, E r) = delete;                                                          \
+FRIEND bool operator>= (E l, E r) = delete;                                                         \
+FRIEND std::partial_ordering operator<=> (E l, E r) = delete;                                       \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2>                                                                  \
+    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
+    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
+FRIEND bool operator< (T1 l, T2 r) = delete;                                                        \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2>                                                                  \
+    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
+    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
+FRIEND bool operator<= (T1 l, T2 r) = delete;                                                       \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2>                                                                  \
+    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
+    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
+FRIEND bool operator> (T1 l, T2 r) = delete;                                                        \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2>                                                                  \
+    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
+    std::is_same_v<E, boost::flags::enum_type_t<T2>>)                                               \
+FRIEND bool operator>= (T1 l, T2 r) = delete;                                                       \
+                                                                                                    \
+template<typename T1, typename T2>                                                                  \
+    requires (std::is_same_v<E, boost::flags::enum_type_t<T1>> ||                                   \
+              std::is_same_v<E, boost::flags::enum_type_t<T2>> )                                    \
+FRIEND std::partial_ordering operator<=> (T1 l, T2 r) = delete;                                     \
+
+
+#else // BOOST_FLAGS_HAS_CONCEPTS
+
+#define BOOST_FLAGS_DELETE_REL_IMPL(E, FRIEND)                                                      \
+/* matches better than built-in relational operators */                                             \
+FRIEND bool operator< (E l, E r) = delete;                                                          \
+FRIEND bool operator<= (E l, E r) = delete;                                                         \
+FRIEND bool operator> (E l, E r) = delete;                                                          \
+FRIEND bool operator>= (E l, E r) = delete;                                                         \
+FRIEND std::partial_ordering operator<=> (E l, E r) = delete;                                       \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2,                                                                  \
+    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
+    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
+FRIEND bool operator< (T1 l, T2 r) = delete;                                                        \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2,                                                                  \
+    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
+    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
+FRIEND bool operator<= (T1 l, T2 r) = delete;                                                       \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2,                                                                  \
+    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
+    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
+FRIEND bool operator> (T1 l, T2 r) = delete;                                                        \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2,                                                                  \
+    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
+    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
+FRIEND bool operator>= (T1 l, T2 r) = delete;                                                       \
+                                                                                                    \
+/* matches all other E, complement<E> arguments */                                                  \
+template<typename T1, typename T2,                                                                  \
+    typename std::enable_if<std::is_same<E, boost::flags::enum_type_t<T1>>::value ||                \
+    std::is_same<E, boost::flags::enum_type_t<T2>>::value, int*>::type = nullptr>                   \
+FRIEND std::partial_ordering operator<=> (T1 l, T2 r) = delete;                                     
+
+
+#endif // BOOST_FLAGS_HAS_CONCEPTS
+
+#endif // !(BOOST_FLAGS_HAS_THREE_WAY_COMPARISON)
+
+#define BOOST_FLAGS_DELETE_REL(E)                                                                   \
+BOOST_FLAGS_DELETE_REL_IMPL(E, BOOST_FLAGS_EMPTY())
+#define BOOST_FLAGS_LOCAL_DELETE_REL(E)  BOOST_FLAGS_DELETE_REL_IMPL(E, friend)
+
+
+#define BOOST_FLAGS_PSEUDO_AND_OPERATOR & boost::flags::pseudo_and_op_tag{} &
+
+#define BOOST_FLAGS_AND  BOOST_FLAGS_PSEUDO_AND_OPERATOR
+
+#define BOOST_FLAGS_NULL boost::flags::null_tag{}
+
+
+
+// enabling macro for enum E at namespace scope
+#define BOOST_FLAGS_ENABLE_EX(E, OPTS)                                                              \
+    BOOST_FLAGS_CONSTEVAL inline                                                                    \
+    boost::flags::options_constant<OPTS> boost_flags_enable(E) {                                    \
+        return {};                                                                                  \
+    }                                                                                               \
+
+#define BOOST_FLAGS_ENABLE(E)                                                                       \
+    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable)                                         \
+    BOOST_FLAGS_USING_OPERATORS()                                                                   \
+
+#define BOOST_FLAGS_ENABLE_DISABLE_COMPLEMENT(E)                                                    \
+    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
+        boost::flags::options::disable_complement)                                                  \
+    BOOST_FLAGS_USING_OPERATORS()                                                                   \
+
+#define BOOST_FLAGS_ENABLE_DISABLE_COMPLEMENT_LOGICAL_AND(E)                                        \
+    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
+        boost::flags::options::disable_complement | boost::flags::options::logical_and)             \
+    BOOST_FLAGS_USING_OPERATORS()                                                                   \
+
+#define BOOST_FLAGS_ENABLE_LOGICAL_AND(E)                                                           \
+    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
+        boost::flags::options::logical_and)                                                         \
+    BOOST_FLAGS_USING_OPERATORS()                                                                   \
+
+#define BOOST_FLAGS_ENABLE_PRE_INCREMENT(E)                                                         \
+    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
+        boost::flags::options::pre_increment)                                                       \
+    BOOST_FLAGS_USING_OPERATORS()                                                                   \
+
+#define BOOST_FLAGS_ENABLE_DISABLE_COMPLEMENT_PRE_INCREMENT(E)                                      \
+    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
+        boost::flags::options::disable_complement | boost::flags::options::pre_increment)           \
+    BOOST_FLAGS_USING_OPERATORS()                                                                   \
+
+#define BOOST_FLAGS_ENABLE_DISABLE_COMPLEMENT_LOGICAL_AND_PRE_INCREMENT(E)                          \
+    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
+        boost::flags::options::disable_complement | boost::flags::options::logical_and |            \
+        boost::flags::options::pre_increment)                                                       \
+    BOOST_FLAGS_USING_OPERATORS()                                                                   \
+
+#define BOOST_FLAGS_ENABLE_LOGICAL_AND_PRE_INCREMENT(E)                                             \
+    BOOST_FLAGS_ENABLE_EX(E, boost::flags::options::enable |                                        \
+        boost::flags::options::logical_and | boost::flags::options::pre_increment)                  \
+    BOOST_FLAGS_USING_OPERATORS()                                                                   \
+
+
+// enabling macro for enum E at class scope
+#define BOOST_FLAGS_ENABLE_LOCAL_EX(E, OPTS)                                                        \
+    friend BOOST_FLAGS_CONSTEVAL inline                                                             \
+    boost::flags::options_constant<OPTS> boost_flags_enable(E) {                                    \
+        return {};                                                                                  \
+    }                                                                                               \
+    BOOST_FLAGS_FORWARD_OPERATORS_LOCAL(E)                                                          \
+
+
+#define BOOST_FLAGS_ENABLE_LOCAL(E)                                                                 \
+    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable)                                   \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT(E)                                              \
+    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
+        boost::flags::options::disable_complement)                                                  \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_LOGICAL_AND(E)                                  \
+    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
+        boost::flags::options::disable_complement | boost::flags::options::logical_and)             \
+    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_LOGICAL_AND(E)                                                     \
+    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
+        boost::flags::options::logical_and)                                                         \
+    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_PRE_INCREMENT(E)                                                   \
+    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
+        boost::flags::options::pre_increment)                                                       \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_PRE_INCREMENT(E)                                \
+    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
+        boost::flags::options::disable_complement | boost::flags::options::pre_increment)           \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_LOGICAL_AND_PRE_INCREMENT(E)                    \
+    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
+        boost::flags::options::disable_complement | boost::flags::options::logical_and |            \
+        boost::flags::options::pre_increment)                                                       \
+    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_LOGICAL_AND_PRE_INCREMENT(E)                                       \
+    BOOST_FLAGS_ENABLE_LOCAL_EX(E, boost::flags::options::enable |                                  \
+        boost::flags::options::logical_and | boost::flags::options::pre_increment)                  \
+    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
+
+
+
+
+#define BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, OPTS)                                          \
+    friend BOOST_FLAGS_CONSTEVAL inline                                                             \
+    boost::flags::options_constant<OPTS> boost_flags_enable(E) {                                    \
+        return {};                                                                                  \
+    }                                                                                               \
+
+
+#define BOOST_FLAGS_ENABLE_LOCAL_NO_FORWARDING(E)                                                   \
+    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable)                     \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_NO_FORWARDING(E)                                \
+    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
+        boost::flags::options::disable_complement)                                                  \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_LOGICAL_AND_NO_FORWARDING(E)                    \
+    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
+        boost::flags::options::disable_complement | boost::flags::options::logical_and)             \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_LOGICAL_AND_NO_FORWARDING(E)                                       \
+    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
+        boost::flags::options::logical_and)                                                         \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_PRE_INCREMENT_NO_FORWARDING(E)                                     \
+    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
+        boost::flags::options::pre_increment)                                                       \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_PRE_INCREMENT_NO_FORWARDING(E)                  \
+    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
+        boost::flags::options::disable_complement | boost::flags::options::pre_increment)           \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_DISABLE_COMPLEMENT_LOGICAL_AND_PRE_INCREMENT_NO_FORWARDING(E)      \
+    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
+        boost::flags::options::disable_complement | boost::flags::options::logical_and |            \
+        boost::flags::options::pre_increment)                                                       \
+
+#define BOOST_FLAGS_ENABLE_LOCAL_LOGICAL_AND_PRE_INCREMENT_NO_FORWARDING(E)                         \
+    BOOST_FLAGS_ENABLE_LOCAL_EX_NO_FORWARDING(E, boost::flags::options::enable |                    \
+        boost::flags::options::logical_and | boost::flags::options::pre_increment)                  \
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// VARIADIC MACRO:  BOOST_FLAGS(E, ...)
+//
+// This macro allows to specify all options within a single macro invocation. Its syntax is
+// 
+// BOOST_FLAGS(E, OPTIONS)
+// 
+// where OPTIONS is an optional comma separated list (if OPTIONS is empty the comma after E may be omitted)
+// containing at most one of each of the following options:
+// - BOOST_FLAGS_LOGICAL_AND            : enable operator&& for enum E
+// - BOOST_FLAGS_PRE_INCREMENT               : enable unary operator++ for enum E
+// - BOOST_FLAGS_DISABLE_COMPLEMENT     : disable 'complement' template for enum E
+// - BOOST_FLAGS_ASSUME_DOMAIN          : get_underlying / from_underlying assume that values only contain bits of the domain
+// - BOOST_FLAGS_CHECK_ASSERT           : from_underlying / binary operators assert that values only contain bits of the domain
+// - BOOST_FLAGS_CHECK_MASK             : from_underlying / binary operators clear all bits outside of the domain
+// - BOOST_FLAGS_CHECK_TRAP             : from_underlying / binary operators trap on bits outside of the domain
+//                                        (at most one of the BOOST_FLAGS_CHECK_... options may be specified)
+// - BOOST_FLAGS_NO_FORWARDING          : do not forward operators when using BOOST_FLAGS_LOCAL (has no effect for BOOST_FLAGS)
+//                                        This is required when using operators from namespace boost::flags inside classes 
+//                                        (through usage of BOOST_FLAGS(...) or BOOST_FLAGS_USING_OPERATORS(...) in classes
+//                                        namespace before its definition). See documentation for further details.
+//  
+// furthermore at most one of the following relational-operator options may be specified:
+// - BOOST_FLAGS_DEFAULT_REL            : use operators <, <=, >, >= and <=> as specified by the C++ standard
+// - BOOST_FLAGS_DELETE_REL             : delete operators <, <=, >, >= and <=> if at least one argument is of type E (or `complement`s of E)
+//
+// If no relational-operator option is specified, the macro defaults to using BOOST_FLAGS_DEFAULT_REL
+// 
+// When you encounter errors using BOOST_FLAGS(E, ...) this can have multiple reasons (list is NOT exhaustive)
+//
+// - the invoked preprocessor is not standard conforming to at least C++11
+// - misspelling one of the options
+// - forgetting a comma or specifying a comma too much
+// - specifying the same options more than once
+// - specifying more than one relational-operator option
+//
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_LOGICAL_AND(NAME, ...)                                    \
+| boost::flags::options::logical_and BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_PRE_INCREMENT(NAME, ...)                                  \
+| boost::flags::options::pre_increment BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                             \
+| boost::flags::options::disable_complement BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_ASSUME_DOMAIN(NAME, ...)                                  \
+| boost::flags::options::assume_domain BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_CHECK_ASSERT(NAME, ...)                                   \
+| boost::flags::options::check_assert BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_CHECK_MASK(NAME, ...)                                     \
+| boost::flags::options::check_mask BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_CHECK_TRAP(NAME, ...)                                     \
+| boost::flags::options::check_trap BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_NO_FORWARDING(NAME, ...)                                  \
+BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                                    \
+BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_BOOST_FLAGS_DELETE_REL(NAME, ...)                                     \
+BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_OP_(...) 
+#define BOOST_FLAGS_EXPAND_OPS(NAME, ...) BOOST_FLAGS_EXPAND_OP_##NAME(__VA_ARGS__) 
+
+
+// needed for BOOST_FLAGS_LOCAL
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_LOGICAL_AND(NAME, ...) 1
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_PRE_INCREMENT(NAME, ...)                         \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                    \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_ASSUME_DOMAIN(NAME, ...)                         \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_CHECK_ASSERT(NAME, ...)                          \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_CHECK_MASK(NAME, ...)                            \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_CHECK_TRAP(NAME, ...)                            \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_NO_FORWARDING(NAME, ...)                         \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                           \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_BOOST_FLAGS_DELETE_REL(NAME, ...)                            \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP_(...) 0
+#define BOOST_FLAGS_HAS_LOGICAL_AND_OP(NAME, ...)                                                   \
+BOOST_FLAGS_HAS_LOGICAL_AND_OP_##NAME(__VA_ARGS__) 
+
+// needed for BOOST_FLAGS_LOCAL
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_PRE_INCREMENT(NAME, ...) 1
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_LOGICAL_AND(NAME, ...)                         \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                  \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_ASSUME_DOMAIN(NAME, ...)                       \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_CHECK_ASSERT(NAME, ...)                        \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_CHECK_MASK(NAME, ...)                          \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_CHECK_TRAP(NAME, ...)                          \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_NO_FORWARDING(NAME, ...)                       \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                         \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_BOOST_FLAGS_DELETE_REL(NAME, ...)                          \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP_(...) 0
+#define BOOST_FLAGS_HAS_PRE_INCREMENT_OP(NAME, ...)                                                 \
+BOOST_FLAGS_HAS_PRE_INCREMENT_OP_##NAME(__VA_ARGS__) 
+
+// needed for BOOST_FLAGS_LOCAL
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_NO_FORWARDING(NAME, ...) 1 
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_LOGICAL_AND(NAME, ...)                             \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__)
+
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_PRE_INCREMENT(NAME, ...)                           \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__)
+
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                      \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_ASSUME_DOMAIN(NAME, ...)                           \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_CHECK_ASSERT(NAME, ...)                            \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_CHECK_MASK(NAME, ...)                              \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_CHECK_TRAP(NAME, ...)                              \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                             \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_IS_NO_FORWARDING_BOOST_FLAGS_DELETE_REL(NAME, ...)                              \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_IS_NO_FORWARDING_(...) 0
+#define BOOST_FLAGS_IS_NO_FORWARDING(NAME, ...)                                                     \
+BOOST_FLAGS_IS_NO_FORWARDING_##NAME(__VA_ARGS__) 
+
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_LOGICAL_AND(NAME, ...)                                   \
+BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_PRE_INCREMENT(NAME, ...)                                 \
+BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_DISABLE_COMPLEMENT(NAME, ...)                            \
+BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_ASSUME_DOMAIN(NAME, ...)                                 \
+BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_CHECK_ASSERT(NAME, ...)                                  \
+BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_CHECK_MASK(NAME, ...)                                    \
+BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_CHECK_TRAP(NAME, ...)                                    \
+BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_NO_FORWARDING(NAME, ...)                                 \
+BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_DEFAULT_REL(NAME, ...)                                   \
+BOOST_FLAGS_GENERATE_DEFAULT_REL BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_BOOST_FLAGS_DELETE_REL(NAME, ...)                                    \
+BOOST_FLAGS_GENERATE_DELETE_REL BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+#define BOOST_FLAGS_EXPAND_REL_(...) 
+#define BOOST_FLAGS_EXPAND_RELS(NAME, ...) BOOST_FLAGS_EXPAND_REL_##NAME(__VA_ARGS__) 
+
+
+
+#define BOOST_FLAGS_GENERATE_OPS(E, OPS)                                                            \
+    BOOST_FLAGS_CONSTEVAL inline                                                                    \
+    boost::flags::options_constant<boost::flags::options::enable OPS>                               \
+    boost_flags_enable(E) {                                                                         \
+        return {};                                                                                  \
+    }                                                                                               \
+
+
+// this is the default case, when no relation-option is specified
+#define BOOST_FLAGS_GENERATE_REL_(E)                                                                \
+    BOOST_FLAGS_GENERATE_REL_BOOST_FLAGS_GENERATE_DEFAULT_REL(E)
+
+#define BOOST_FLAGS_GENERATE_REL_BOOST_FLAGS_GENERATE_DEFAULT_REL(E)                                \
+
+#define BOOST_FLAGS_GENERATE_REL_BOOST_FLAGS_GENERATE_DELETE_REL(E)                                 \
+    BOOST_FLAGS_DELETE_REL(E)
+
+
+// for better diagnostics, when more than one relational operation options is specified
+#define BOOST_FLAGS_GENERATE_DEFAULT_REL(E) ;                                                       \
+static_assert(false, "multiple relational operation options specified");
+
+#define BOOST_FLAGS_GENERATE_DELETE_REL(E) ;                                                        \
+static_assert(false, "multiple relational operation options specified");
+
+
+
+// forward once to enforce expansion
+#define BOOST_FLAGS_GENERATE_REL2(E, REL) BOOST_FLAGS_GENERATE_REL_##REL(E)
+
+#define BOOST_FLAGS_GENERATE_REL(E, REL) BOOST_FLAGS_GENERATE_REL2(E, REL)
+
+
+// please see comment above about usage and possible errors with the variadic macro BOOST_FLAGS(E, ...)
+
+#define BOOST_FLAGS(E, ...)                                                                         \
+    BOOST_FLAGS_GENERATE_OPS(E, BOOST_FLAGS_EXPAND_OPS(__VA_ARGS__))                                \
+    BOOST_FLAGS_GENERATE_REL(E, BOOST_FLAGS_EXPAND_RELS(__VA_ARGS__))                               \
+    BOOST_FLAGS_USING_OPERATORS()                                                                   \
+
+
+// additional macros for BOOST_FLAGS_LOCAL
+
+#define BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_0(E)
+
+#define BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_1(E)                                         \
+    BOOST_FLAGS_FORWARD_BINARY_OPERATOR(E, friend, &&, bool)                                        \
+
+
+#define BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_(E, VALUE)                                   \
+    BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_##VALUE(E)
+
+#define BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD(E, VALUE)                                    \
+    BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD_(E, VALUE)
+
+
+#define BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_0(E)
+
+#define BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_1(E)                                       \
+    BOOST_FLAGS_FORWARD_UNARY_OPERATOR(E, friend, +, ::boost::flags::impl::bool_convertible<E>)
+
+
+#define BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_(E, VALUE)                                 \
+    BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_##VALUE(E)
+
+#define BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD(E, VALUE)                                  \
+    BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD_(E, VALUE)
+
+
+
+#define BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_NOT_0(E, LOGICAL_AND, PRE_INCREMENT)                    \
+    BOOST_FLAGS_FORWARD_OPERATORS_LOCAL(E)                                                          \
+    BOOST_FLAGS_LOCAL_GENERATE_LOGICAL_AND_FORWARD(E, LOGICAL_AND)                                  \
+    BOOST_FLAGS_LOCAL_GENERATE_PRE_INCREMENT_FORWARD(E, PRE_INCREMENT)
+
+#define BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_NOT_1(E, LOGICAL_AND, PRE_INCREMENT)
+
+#define BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_(E, NOT_VALUE, LOGICAL_AND, PRE_INCREMENT)              \
+    BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_NOT_##NOT_VALUE(E, LOGICAL_AND, PRE_INCREMENT)
+
+#define BOOST_FLAGS_LOCAL_GENERATE_FORWARDS(E, NOT_VALUE, LOGICAL_AND, PRE_INCREMENT)               \
+    BOOST_FLAGS_LOCAL_GENERATE_FORWARDS_(E, NOT_VALUE, LOGICAL_AND, PRE_INCREMENT)
+
+
+
+#define BOOST_FLAGS_LOCAL_GENERATE_OPS(E, OPS)                                                      \
+    friend BOOST_FLAGS_CONSTEVAL inline                                                             \
+    boost::flags::options_constant<boost::flags::options::enable OPS>                               \
+    boost_flags_enable(E) {                                                                         \
+        return {};                                                                                  \
+    }
+
+
+// this is the default case, when no relation-option is specified
+#define BOOST_FLAGS_LOCAL_GENERATE_REL_(E)                                                          \
+    BOOST_FLAGS_LOCAL_GENERATE_REL_BOOST_FLAGS_GENERATE_DEFAULT_REL(E)
+
+#define BOOST_FLAGS_LOCAL_GENERATE_REL_BOOST_FLAGS_GENERATE_DEFAULT_REL(E)                          \
+
+#define BOOST_FLAGS_LOCAL_GENERATE_REL_BOOST_FLAGS_GENERATE_DELETE_REL(E)                           \
+    BOOST_FLAGS_LOCAL_DELETE_REL(E)
+
+
+// for better diagnostics, when more than one relational operation options is specified
+#define BOOST_FLAGS_LOCAL_GENERATE_DEFAULT_REL(E) ;                                                 \
+static_assert(false, "multiple relational operation options specified");
+
+#define BOOST_FLAGS_LOCAL_GENERATE_DELETE_REL(E) ;                                                  \
+static_assert(false, "multiple relational operation options specified");
+
+
+// forward once to enforce expansion
+#define BOOST_FLAGS_LOCAL_GENERATE_REL2(E, REL) BOOST_FLAGS_LOCAL_GENERATE_REL_##REL(E)
+
+#define BOOST_FLAGS_LOCAL_GENERATE_REL(E, REL)  BOOST_FLAGS_LOCAL_GENERATE_REL2(E, REL)
+
+
+#define BOOST_FLAGS_LOCAL(E, ...)                                                                   \
+    BOOST_FLAGS_LOCAL_GENERATE_OPS(E, BOOST_FLAGS_EXPAND_OPS(__VA_ARGS__))                          \
+    BOOST_FLAGS_LOCAL_GENERATE_FORWARDS(E, BOOST_FLAGS_IS_NO_FORWARDING(__VA_ARGS__),               \
+        BOOST_FLAGS_HAS_LOGICAL_AND_OP(__VA_ARGS__),                                                \
+        BOOST_FLAGS_HAS_PRE_INCREMENT_OP(__VA_ARGS__))                                              \
+    BOOST_FLAGS_LOCAL_GENERATE_REL(E, BOOST_FLAGS_EXPAND_RELS(__VA_ARGS__))                         \
+
+
+#endif  // BOOST_FLAGS_MACROS_HPP_INCLUDED
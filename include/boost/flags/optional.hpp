@@ -0,0 +1,131 @@
+#ifndef BOOST_FLAGS_OPTIONAL_HPP_INCLUDED
+#define BOOST_FLAGS_OPTIONAL_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// optional flags with the size of E
+//
+// std::optional<E> adds an engaged flag (and padding) to E. compact_optional<E> stores the
+// disengaged state as a bit pattern no value of E uses: all bits outside of the domain of E
+// (cf. <boost/flags/domain.hpp>) set. This requires a domain that doesn't cover the whole
+// underlying type, which is checked statically.
+
+#include <boost/flags/domain.hpp>
+
+#include <optional>
+
+namespace boost {
+    namespace flags {
+
+        template<typename E>
+        class compact_optional {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::compact_optional requires an enabled enum type.");
+
+            using bits_type = impl::unsigned_underlying_t<E>;
+
+        public:
+            using value_type = E;
+
+            // the bit pattern of the disengaged state
+            static constexpr bits_type empty_bits = static_cast<bits_type>(~impl::domain_helper<E>::value);
+
+            static_assert(empty_bits != 0,
+                "boost::flags::compact_optional: the domain of E covers all bits of the underlying type, there is no unused bit pattern.");
+
+            constexpr compact_optional() noexcept = default;
+
+            constexpr compact_optional(std::nullopt_t) noexcept {}
+
+            constexpr compact_optional(E value) noexcept
+                : bits_(impl::to_unsigned(value))
+            {
+                BOOST_FLAGS_ASSERT(bits_ != empty_bits && "value is the disengaged bit pattern");
+            }
+
+            constexpr compact_optional(std::optional<E> const& value) noexcept
+                : compact_optional(value ? compact_optional(*value) : compact_optional())
+            {}
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr bool has_value() const noexcept { return bits_ != empty_bits; }
+
+            constexpr explicit operator bool() const noexcept { return has_value(); }
+
+            // precondition: has_value()
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr E operator*() const noexcept {
+                BOOST_FLAGS_ASSERT(has_value());
+                return impl::from_unsigned<E>(bits_);
+            }
+
+            // throws std::bad_optional_access if disengaged
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr E value() const {
+                if (!has_value()) {
+                    throw std::bad_optional_access();
+                }
+                return impl::from_unsigned<E>(bits_);
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr E value_or(E default_value) const noexcept {
+                return has_value() ? impl::from_unsigned<E>(bits_) : default_value;
+            }
+
+            constexpr E emplace(E value) noexcept {
+                *this = compact_optional(value);
+                return value;
+            }
+
+            constexpr void reset() noexcept { bits_ = empty_bits; }
+
+            constexpr void swap(compact_optional& other) noexcept {
+                bits_type const tmp = bits_;
+                bits_ = other.bits_;
+                other.bits_ = tmp;
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr std::optional<E> to_optional() const noexcept {
+                return has_value() ? std::optional<E>(impl::from_unsigned<E>(bits_)) : std::nullopt;
+            }
+
+            // the disengaged state compares equal to std::nullopt, an engaged one to its value
+            friend constexpr bool operator==(compact_optional const& lhs, compact_optional const& rhs) noexcept {
+                return lhs.bits_ == rhs.bits_;
+            }
+            friend constexpr bool operator!=(compact_optional const& lhs, compact_optional const& rhs) noexcept {
+                return lhs.bits_ != rhs.bits_;
+            }
+
+            friend constexpr bool operator==(compact_optional const& lhs, std::nullopt_t) noexcept { return !lhs.has_value(); }
+            friend constexpr bool operator==(std::nullopt_t, compact_optional const& rhs) noexcept { return !rhs.has_value(); }
+            friend constexpr bool operator!=(compact_optional const& lhs, std::nullopt_t) noexcept { return lhs.has_value(); }
+            friend constexpr bool operator!=(std::nullopt_t, compact_optional const& rhs) noexcept { return rhs.has_value(); }
+
+            friend constexpr bool operator==(compact_optional const& lhs, E rhs) noexcept {
+                return lhs.has_value() && lhs.bits_ == impl::to_unsigned(rhs);
+            }
+            friend constexpr bool operator==(E lhs, compact_optional const& rhs) noexcept { return rhs == lhs; }
+            friend constexpr bool operator!=(compact_optional const& lhs, E rhs) noexcept { return !(lhs == rhs); }
+            friend constexpr bool operator!=(E lhs, compact_optional const& rhs) noexcept { return !(rhs == lhs); }
+
+        private:
+            bits_type bits_ = empty_bits;
+        };
+
+        template<typename E>
+        constexpr void swap(compact_optional<E>& lhs, compact_optional<E>& rhs) noexcept {
+            lhs.swap(rhs);
+        }
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_OPTIONAL_HPP_INCLUDED
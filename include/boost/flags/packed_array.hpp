@@ -0,0 +1,527 @@
+#ifndef BOOST_FLAGS_PACKED_ARRAY_HPP_INCLUDED
+#define BOOST_FLAGS_PACKED_ARRAY_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// array of flags packed into domain_bits_v<E> bits per element (cf. <boost/flags/domain.hpp>)
+//
+// element i occupies the bits [i * B, (i + 1) * B) of a sequence of 64-bit words (B = domain_bits_v<E>),
+// the bits of the domain are stored compacted (for a domain of contiguous low bits B is its bit width).
+// elements may straddle two words, a zero padding word at the end allows to read 64 bits at any offset.
+//
+// the bulk conversions unpack / pack convert a 64-bit word of elements at once (BMI2: a single
+// pdep / pext, which also spreads the compacted bits to the domain), the scans with mask_compare
+// predicates compare the packed lanes directly (SWAR)
+
+#include <boost/flags/domain.hpp>
+#include <boost/flags/scan.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+        namespace impl {
+
+            template<typename E>
+            struct packed_layout {
+                static constexpr std::uint64_t domain = domain_helper<enum_type_t<E>>::value;
+                static constexpr std::size_t bits = static_cast<std::size_t>(constexpr_popcount(domain));
+                static constexpr std::uint64_t lane_mask = bits == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << bits) - 1;
+
+                static_assert(bits != 0, "boost::flags::packed_flags_array requires a non-empty domain.");
+
+                // unpack / pack: the elements of a 64-bit word of E and the pdep / pext mask spreading them
+                static constexpr std::size_t word_lanes = 8 / sizeof(E);
+                static constexpr std::uint64_t spread_mask = [] {
+                    std::uint64_t m = 0;
+                    for (std::size_t i = 0; i < word_lanes; ++i) {
+                        m |= domain << (i * 8 * sizeof(E));
+                    }
+                    return m;
+                }();
+
+                // scans: the packed lanes compared at once and the top bit of every lane
+                static constexpr std::size_t scan_lanes = 64 / bits;
+                static constexpr std::uint64_t high_bits = [] {
+                    std::uint64_t m = 0;
+                    for (std::size_t i = 0; i < scan_lanes; ++i) {
+                        m |= std::uint64_t(1) << (i * bits + bits - 1);
+                    }
+                    return m;
+                }();
+
+                static constexpr std::uint64_t replicate(std::uint64_t lane) noexcept {
+                    std::uint64_t result = 0;
+                    for (std::size_t i = 0; i < scan_lanes; ++i) {
+                        result |= lane << (i * bits);
+                    }
+                    return result;
+                }
+            };
+
+            inline constexpr std::size_t packed_word_count(std::size_t bit_count) noexcept {
+                return (bit_count + 63) / 64;
+            }
+
+            // the 64 bits starting at `offset` (requires a readable word behind the word containing `offset`)
+            inline std::uint64_t read_bits(std::uint64_t const* words, std::size_t offset) noexcept {
+                std::size_t const k = offset / 64;
+                unsigned const s = static_cast<unsigned>(offset % 64);
+                return (words[k] >> s) | ((words[k + 1] << 1) << (63 - s));
+            }
+
+            // overwrites `count` (<= 64) bits starting at `offset` with the low bits of `value`
+            inline void write_bits(std::uint64_t* words, std::size_t offset, std::size_t count, std::uint64_t value) noexcept {
+                std::size_t const k = offset / 64;
+                unsigned const s = static_cast<unsigned>(offset % 64);
+                std::uint64_t const m = count == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << count) - 1;
+                value &= m;
+                words[k] = (words[k] & ~(m << s)) | (value << s);
+                if (s + count > 64) {
+                    unsigned const h = 64 - s;
+                    words[k + 1] = (words[k + 1] & ~(m >> h)) | (value >> h);
+                }
+            }
+
+            template<typename E>
+            inline enum_type_t<E> packed_get(std::uint64_t const* words, std::size_t i) noexcept {
+                using layout = packed_layout<E>;
+                return expand_domain<E>(read_bits(words, i * layout::bits) & layout::lane_mask);
+            }
+
+            template<typename E>
+            inline void packed_set(std::uint64_t* words, std::size_t i, E value) noexcept {
+                using layout = packed_layout<E>;
+                write_bits(words, i * layout::bits, layout::bits, compact_domain(value));
+            }
+
+            template<typename E>
+            inline void packed_unpack(std::uint64_t const* words, std::size_t first, std::size_t count, E* out) noexcept {
+                std::size_t i = 0;
+#if BOOST_FLAGS_HAS_BMI2 && (defined(__x86_64__) || defined(_M_X64))
+                using layout = packed_layout<E>;
+                constexpr std::size_t k = layout::word_lanes;
+                for (; i + k <= count; i += k) {
+                    std::uint64_t const w = _pdep_u64(read_bits(words, (first + i) * layout::bits), layout::spread_mask);
+                    std::memcpy(out + i, &w, sizeof(w));
+                }
+#endif // BOOST_FLAGS_HAS_BMI2
+                for (; i < count; ++i) {
+                    out[i] = packed_get<E>(words, first + i);
+                }
+            }
+
+            template<typename E>
+            inline void packed_pack(std::uint64_t* words, std::size_t first, E const* in, std::size_t count) noexcept {
+                std::size_t i = 0;
+#if BOOST_FLAGS_HAS_BMI2 && (defined(__x86_64__) || defined(_M_X64))
+                using layout = packed_layout<E>;
+                constexpr std::size_t k = layout::word_lanes;
+                for (; i + k <= count; i += k) {
+                    std::uint64_t w;
+                    std::memcpy(&w, in + i, sizeof(w));
+                    write_bits(words, (first + i) * layout::bits, k * layout::bits, _pext_u64(w, layout::spread_mask));
+                }
+#endif // BOOST_FLAGS_HAS_BMI2
+                for (; i < count; ++i) {
+                    packed_set(words, first + i, in[i]);
+                }
+            }
+
+            // gathers the top bits of the lanes (`lane_high` selects them) into consecutive bits
+            template<typename E>
+            inline std::uint64_t compress_lanes(std::uint64_t lane_high) noexcept {
+                using layout = packed_layout<E>;
+#if BOOST_FLAGS_HAS_BMI2 && (defined(__x86_64__) || defined(_M_X64))
+                return _pext_u64(lane_high, layout::high_bits);
+#else // BOOST_FLAGS_HAS_BMI2
+                if constexpr (layout::bits == 1) {
+                    return lane_high;
+                } else {
+                    std::uint64_t result = 0;
+                    for (; lane_high; lane_high &= lane_high - 1) {
+                        result |= std::uint64_t(1) << (static_cast<std::size_t>(countr_zero(lane_high)) / layout::bits);
+                    }
+                    return result;
+                }
+#endif // BOOST_FLAGS_HAS_BMI2
+            }
+
+            // mask_compare on up to 64 packed elements: the lanes of (x & mask) ^ expected are tested for zero at once,
+            // ((y & low) + low) | y has the top bit of a lane set iff the lane is non-zero
+            template<typename E>
+            inline std::uint64_t scan_packed_block(std::uint64_t const* words, std::size_t first, std::size_t count,
+                mask_compare<E> const& pred) noexcept {
+                using layout = packed_layout<E>;
+                constexpr std::size_t k = layout::scan_lanes;
+                if ((to_unsigned(pred.expected) & ~(to_unsigned(pred.mask) & layout::domain)) != 0) {
+                    return 0;
+                }
+                std::uint64_t const m = layout::replicate(compact_domain(pred.mask));
+                std::uint64_t const e = layout::replicate(compact_domain(pred.expected));
+                constexpr std::uint64_t high = layout::high_bits;
+                constexpr std::uint64_t low = layout::replicate(layout::lane_mask) ^ high;
+
+                std::uint64_t result = 0;
+                for (std::size_t i = 0; i < count; i += k) {
+                    std::size_t const c = count - i < k ? count - i : k;
+                    std::uint64_t const y = (read_bits(words, (first + i) * layout::bits) & m) ^ e;
+                    std::uint64_t matches = ~((((y & low) + low) | y)) & high;
+                    if (c < k) {
+                        matches &= (std::uint64_t(1) << (c * layout::bits)) - 1;
+                    }
+                    result |= compress_lanes<E>(matches) << i;
+                }
+                return result;
+            }
+
+            template<typename E, typename Pred>
+            inline std::uint64_t scan_packed_block(std::uint64_t const* words, std::size_t first, std::size_t count,
+                Pred const& pred) {
+                std::uint64_t result = 0;
+                for (std::size_t i = 0; i < count; ++i) {
+                    result |= static_cast<std::uint64_t>(static_cast<bool>(pred(packed_get<E>(words, first + i)))) << i;
+                }
+                return result;
+            }
+
+        } // namespace impl
+
+
+        template<typename E>
+        class packed_flags_array {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::packed_flags_array requires an enabled enum type.");
+
+            using layout = impl::packed_layout<E>;
+
+            template<bool Const>
+            class iterator_impl;
+
+        public:
+            using value_type = E;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+
+            // number of bits of an element
+            static constexpr size_type bits_per_element = layout::bits;
+
+            // proxy for an element
+            class reference {
+            public:
+                reference(reference const&) = default;
+
+                operator E() const noexcept { return impl::packed_get<E>(words_, index_); }
+
+                reference& operator=(E value) noexcept {
+                    impl::packed_set(words_, index_, value);
+                    return *this;
+                }
+
+                reference& operator=(reference const& other) noexcept {
+                    return *this = static_cast<E>(other);
+                }
+
+                reference& operator|=(E value) noexcept { return *this = static_cast<E>(*this) | value; }
+                reference& operator&=(E value) noexcept { return *this = static_cast<E>(*this) & value; }
+                reference& operator&=(complement<E> value) noexcept { return *this = static_cast<E>(*this) & value; }
+                reference& operator^=(E value) noexcept { return *this = static_cast<E>(*this) ^ value; }
+
+                friend bool operator==(reference const& lhs, E rhs) noexcept { return static_cast<E>(lhs) == rhs; }
+                friend bool operator==(E lhs, reference const& rhs) noexcept { return lhs == static_cast<E>(rhs); }
+                friend bool operator!=(reference const& lhs, E rhs) noexcept { return static_cast<E>(lhs) != rhs; }
+                friend bool operator!=(E lhs, reference const& rhs) noexcept { return lhs != static_cast<E>(rhs); }
+
+            private:
+                friend class packed_flags_array;
+                template<bool>
+                friend class iterator_impl;
+
+                reference(std::uint64_t* words, size_type index) noexcept
+                    : words_(words)
+                    , index_(index)
+                {}
+
+                std::uint64_t* words_;
+                size_type index_;
+            };
+
+            using const_reference = E;
+            using iterator = iterator_impl<false>;
+            using const_iterator = iterator_impl<true>;
+
+            packed_flags_array()
+                : words_(1, 0)
+            {}
+
+            explicit packed_flags_array(size_type n, E value = E{})
+                : packed_flags_array() {
+                resize(n, value);
+            }
+
+            template<typename InputIt>
+            packed_flags_array(InputIt first, InputIt last)
+                : packed_flags_array() {
+                for (; first != last; ++first) {
+                    push_back(*first);
+                }
+            }
+
+            packed_flags_array(std::initializer_list<E> values)
+                : packed_flags_array() {
+                assign(values.begin(), values.size());
+            }
+
+            // element access
+
+            E operator[](size_type i) const noexcept { return impl::packed_get<E>(words_.data(), i); }
+            reference operator[](size_type i) noexcept { return reference(words_.data(), i); }
+
+            E at(size_type i) const {
+                if (i >= size_) {
+                    throw std::out_of_range("boost::flags::packed_flags_array::at: index out of range");
+                }
+                return (*this)[i];
+            }
+
+            reference at(size_type i) {
+                if (i >= size_) {
+                    throw std::out_of_range("boost::flags::packed_flags_array::at: index out of range");
+                }
+                return (*this)[i];
+            }
+
+            // iterators
+
+            iterator begin() noexcept { return iterator(words_.data(), 0); }
+            iterator end() noexcept { return iterator(words_.data(), size_); }
+            const_iterator begin() const noexcept { return const_iterator(words_.data(), 0); }
+            const_iterator end() const noexcept { return const_iterator(words_.data(), size_); }
+            const_iterator cbegin() const noexcept { return begin(); }
+            const_iterator cend() const noexcept { return end(); }
+
+            // capacity
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            bool empty() const noexcept { return size_ == 0; }
+            size_type size() const noexcept { return size_; }
+
+            void reserve(size_type n) {
+                words_.reserve(impl::packed_word_count(n * bits_per_element) + 1);
+            }
+
+            // size of the packed representation in bytes
+            size_type memory_bytes() const noexcept { return words_.size() * sizeof(std::uint64_t); }
+
+            // the packed words (including the padding word)
+            std::uint64_t const* words() const noexcept { return words_.data(); }
+            size_type word_count() const noexcept { return words_.size(); }
+
+            // modifiers
+
+            void resize(size_type n, E value = E{}) {
+                size_type const old = size_;
+                words_.resize(impl::packed_word_count(n * bits_per_element) + 1, 0);
+                size_ = n;
+                if (n > old) {
+                    if (impl::compact_domain(value) != 0) {
+                        for (size_type i = old; i < n; ++i) {
+                            impl::packed_set(words_.data(), i, value);
+                        }
+                    }
+                } else {
+                    clear_unused_bits();
+                }
+            }
+
+            void push_back(E value) {
+                resize(size_ + 1, value);
+            }
+
+            void pop_back() noexcept {
+                --size_;
+                clear_unused_bits();
+                words_.resize(impl::packed_word_count(size_ * bits_per_element) + 1);
+            }
+
+            void clear() noexcept {
+                words_.assign(1, 0);
+                size_ = 0;
+            }
+
+            void swap(packed_flags_array& other) noexcept {
+                words_.swap(other.words_);
+                std::swap(size_, other.size_);
+            }
+
+            // bulk conversions
+
+            // replaces the contents with `values[0, n)`
+            void assign(E const* values, size_type n) {
+                words_.assign(impl::packed_word_count(n * bits_per_element) + 1, 0);
+                size_ = n;
+                impl::packed_pack(words_.data(), 0, values, n);
+            }
+
+            // writes the elements [first, first + count) to `out`
+            void unpack(size_type first, size_type count, E* out) const noexcept {
+                impl::packed_unpack(words_.data(), first, count, out);
+            }
+
+            // overwrites the elements [first, first + count) (first + count <= size()) with `values`
+            void pack(size_type first, E const* values, size_type count) noexcept {
+                impl::packed_pack(words_.data(), first, values, count);
+            }
+
+            friend bool operator==(packed_flags_array const& lhs, packed_flags_array const& rhs) noexcept {
+                return lhs.size_ == rhs.size_ && lhs.words_ == rhs.words_;
+            }
+
+            friend bool operator!=(packed_flags_array const& lhs, packed_flags_array const& rhs) noexcept {
+                return !(lhs == rhs);
+            }
+
+        private:
+            // the bits behind the last element are zero (required by operator== and the padding word)
+            void clear_unused_bits() noexcept {
+                size_type const used = size_ * bits_per_element;
+                size_type k = used / 64;
+                if (used % 64 != 0) {
+                    words_[k] &= (std::uint64_t(1) << (used % 64)) - 1;
+                    ++k;
+                }
+                std::fill(words_.begin() + static_cast<difference_type>(k), words_.end(), 0);
+            }
+
+            std::vector<std::uint64_t> words_;
+            size_type size_ = 0;
+        };
+
+
+        template<typename E>
+        template<bool Const>
+        class packed_flags_array<E>::iterator_impl {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = E;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = typename std::conditional<Const, E, typename packed_flags_array<E>::reference>::type;
+
+            iterator_impl() noexcept = default;
+
+            // conversion iterator -> const_iterator
+            template<bool C = Const, typename std::enable_if<C, int>::type = 0>
+            iterator_impl(iterator_impl<false> const& other) noexcept
+                : words_(other.words_)
+                , index_(other.index_)
+            {}
+
+            reference operator*() const noexcept {
+                if constexpr (Const) {
+                    return impl::packed_get<E>(words_, index_);
+                } else {
+                    return reference(words_, index_);
+                }
+            }
+
+            reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+            iterator_impl& operator++() noexcept { ++index_; return *this; }
+            iterator_impl operator++(int) noexcept { iterator_impl tmp = *this; ++index_; return tmp; }
+            iterator_impl& operator--() noexcept { --index_; return *this; }
+            iterator_impl operator--(int) noexcept { iterator_impl tmp = *this; --index_; return tmp; }
+
+            iterator_impl& operator+=(difference_type n) noexcept { index_ += static_cast<size_type>(n); return *this; }
+            iterator_impl& operator-=(difference_type n) noexcept { index_ -= static_cast<size_type>(n); return *this; }
+
+            friend iterator_impl operator+(iterator_impl it, difference_type n) noexcept { return it += n; }
+            friend iterator_impl operator+(difference_type n, iterator_impl it) noexcept { return it += n; }
+            friend iterator_impl operator-(iterator_impl it, difference_type n) noexcept { return it -= n; }
+
+            friend difference_type operator-(iterator_impl const& lhs, iterator_impl const& rhs) noexcept {
+                return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+            }
+
+            friend bool operator==(iterator_impl const& lhs, iterator_impl const& rhs) noexcept { return lhs.index_ == rhs.index_; }
+            friend bool operator!=(iterator_impl const& lhs, iterator_impl const& rhs) noexcept { return lhs.index_ != rhs.index_; }
+            friend bool operator<(iterator_impl const& lhs, iterator_impl const& rhs) noexcept { return lhs.index_ < rhs.index_; }
+            friend bool operator>(iterator_impl const& lhs, iterator_impl const& rhs) noexcept { return lhs.index_ > rhs.index_; }
+            friend bool operator<=(iterator_impl const& lhs, iterator_impl const& rhs) noexcept { return lhs.index_ <= rhs.index_; }
+            friend bool operator>=(iterator_impl const& lhs, iterator_impl const& rhs) noexcept { return lhs.index_ >= rhs.index_; }
+
+        private:
+            friend class packed_flags_array<E>;
+            template<bool>
+            friend class iterator_impl;
+
+            using words_type = typename std::conditional<Const, std::uint64_t const*, std::uint64_t*>::type;
+
+            iterator_impl(words_type words, size_type index) noexcept
+                : words_(words)
+                , index_(index)
+            {}
+
+            words_type words_ = nullptr;
+            size_type index_ = 0;
+        };
+
+
+        namespace impl {
+
+            // passes each 64-element bitmask of the matches of `pred` to `sink(block_index, bits)`
+            template<typename E, typename Pred, typename Sink>
+            inline void scan_packed_blocks(packed_flags_array<E> const& values, Pred const& pred, Sink&& sink) {
+                std::size_t const n = values.size();
+                for (std::size_t block = 0; block * 64 < n; ++block) {
+                    std::size_t const first = block * 64;
+                    std::size_t const count = n - first < 64 ? n - first : 64;
+                    sink(block, scan_packed_block<E>(values.words(), first, count, pred));
+                }
+            }
+
+        } // namespace impl
+
+
+// scan_packed : writes the indices of all elements satisfying `pred` to `selection`
+//               (which must provide space for `values.size()` indices) and returns the number of matches
+        template<typename E, typename Pred, typename Index>
+        std::size_t scan_packed(packed_flags_array<E> const& values, Pred pred, Index* selection) {
+            static_assert(std::is_integral<Index>::value, "boost::flags::scan_packed requires an integral index type.");
+
+            std::size_t count = 0;
+            impl::scan_packed_blocks(values, pred, [&](std::size_t block, std::uint64_t bits) {
+                while (bits) {
+                    selection[count++] = static_cast<Index>(block * 64 + static_cast<std::size_t>(impl::countr_zero(bits)));
+                    bits &= bits - 1;
+                }
+            });
+            return count;
+        }
+
+// scan_packed_bitmap : sets bit `i % 64` of `bitmap[i / 64]` iff element `i` satisfies `pred`
+//                      (`bitmap` must provide space for `(values.size() + 63) / 64` words) and returns the number of matches
+        template<typename E, typename Pred>
+        std::size_t scan_packed_bitmap(packed_flags_array<E> const& values, Pred pred, std::uint64_t* bitmap) {
+            std::size_t count = 0;
+            impl::scan_packed_blocks(values, pred, [&](std::size_t block, std::uint64_t bits) {
+                bitmap[block] = bits;
+                count += static_cast<std::size_t>(impl::popcount(bits));
+            });
+            return count;
+        }
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_PACKED_ARRAY_HPP_INCLUDED
@@ -0,0 +1,456 @@
+#ifndef BOOST_FLAGS_PACKED_WORD_HPP_INCLUDED
+#define BOOST_FLAGS_PACKED_WORD_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// several enabled enums and small unsigned integers packed into a single word
+//
+//      packed_word<field<E1, 0>, field<E2, 8>, uint_field<12>>
+//
+// field<E, Offset> occupies the bits of the domain of E (cf. <boost/flags/domain.hpp>) shifted by
+// Offset, uint_field<Bits, Offset> the Bits bits from Offset. Without an Offset a field is placed
+// behind the preceding fields. The fields must not overlap and must fit into 64 bits, which is checked
+// statically; the word is the smallest unsigned integer type holding all fields.
+//
+// the operators of a field only modify its slice of the word. atomic_packed_word updates several
+// fields with a single compare-exchange of the whole word, single fields with fetch_or / fetch_and / fetch_xor.
+
+#include <boost/flags/domain.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+namespace boost {
+    namespace flags {
+
+        // offset of a field placed behind the preceding fields
+        inline constexpr std::size_t auto_offset = static_cast<std::size_t>(-1);
+
+        namespace impl {
+
+            constexpr std::size_t constexpr_bit_width(std::uint64_t v) noexcept {
+                std::size_t n = 0;
+                for (; v; v >>= 1) {
+                    ++n;
+                }
+                return n;
+            }
+
+            template<std::size_t Bits>
+            using uint_least_bits_t =
+                typename std::conditional<(Bits <= 8), std::uint8_t,
+                typename std::conditional<(Bits <= 16), std::uint16_t,
+                typename std::conditional<(Bits <= 32), std::uint32_t, std::uint64_t>::type>::type>::type;
+
+        } // namespace impl
+
+
+        // an enabled enum stored at bit `Offset`
+        template<typename E, std::size_t Offset = auto_offset>
+        struct field {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::field requires an enabled enum type.");
+
+            using value_type = E;
+            static constexpr std::size_t offset = Offset;
+            static constexpr std::uint64_t value_mask = impl::domain_helper<E>::value;
+            static constexpr std::size_t width = impl::constexpr_bit_width(value_mask);
+
+            // bits outside of the domain are dropped
+            static constexpr std::uint64_t encode(E value) noexcept {
+                return static_cast<std::uint64_t>(impl::to_unsigned(value)) & value_mask;
+            }
+
+            static constexpr E decode(std::uint64_t bits) noexcept {
+                return impl::from_unsigned<E>(static_cast<impl::unsigned_underlying_t<E>>(bits));
+            }
+        };
+
+        // an unsigned integer of `Bits` bits stored at bit `Offset`
+        template<std::size_t Bits, std::size_t Offset = auto_offset>
+        struct uint_field {
+            static_assert(Bits > 0 && Bits <= 64, "boost::flags::uint_field requires 1 to 64 bits.");
+
+            using value_type = impl::uint_least_bits_t<Bits>;
+            static constexpr std::size_t offset = Offset;
+            static constexpr std::uint64_t value_mask = Bits == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << Bits) - 1;
+            static constexpr std::size_t width = Bits;
+
+            // precondition: value < 2^Bits
+            static constexpr std::uint64_t encode(value_type value) noexcept {
+                BOOST_FLAGS_ASSERT(static_cast<std::uint64_t>(value) <= value_mask && "value does not fit into the uint_field");
+                return static_cast<std::uint64_t>(value) & value_mask;
+            }
+
+            static constexpr value_type decode(std::uint64_t bits) noexcept {
+                return static_cast<value_type>(bits);
+            }
+        };
+
+
+        namespace impl {
+
+            template<typename... Fields>
+            struct packed_word_layout {
+                static constexpr std::size_t count = sizeof...(Fields);
+
+                static constexpr std::array<std::size_t, count> compute_offsets() noexcept {
+                    std::size_t const requested[] = { Fields::offset... };
+                    std::size_t const widths[] = { Fields::width... };
+                    std::array<std::size_t, count> result{};
+                    std::size_t next = 0;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        result[i] = requested[i] == auto_offset ? next : requested[i];
+                        if (result[i] + widths[i] > next) {
+                            next = result[i] + widths[i];
+                        }
+                    }
+                    return result;
+                }
+
+                static constexpr std::array<std::size_t, count> offsets = compute_offsets();
+
+                // end of the highest field
+                static constexpr std::size_t compute_bits() noexcept {
+                    std::size_t const widths[] = { Fields::width... };
+                    std::size_t result = 0;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        if (offsets[i] + widths[i] > result) {
+                            result = offsets[i] + widths[i];
+                        }
+                    }
+                    return result;
+                }
+
+                static constexpr std::size_t bits = compute_bits();
+
+                // masks of the fields within the word (0 if a field doesn't fit, which is reported separately)
+                static constexpr std::array<std::uint64_t, count> compute_masks() noexcept {
+                    std::uint64_t const value_masks[] = { Fields::value_mask... };
+                    std::array<std::uint64_t, count> result{};
+                    for (std::size_t i = 0; i < count; ++i) {
+                        result[i] = bits <= 64 ? value_masks[i] << offsets[i] : 0;
+                    }
+                    return result;
+                }
+
+                static constexpr std::array<std::uint64_t, count> masks = compute_masks();
+
+                static constexpr bool compute_disjoint() noexcept {
+                    for (std::size_t i = 0; i < count; ++i) {
+                        for (std::size_t j = i + 1; j < count; ++j) {
+                            if ((masks[i] & masks[j]) != 0) {
+                                return false;
+                            }
+                        }
+                    }
+                    return true;
+                }
+
+                static constexpr bool disjoint = compute_disjoint();
+            };
+
+            // index of the only field with value_type T
+            template<typename T, typename... Fields>
+            constexpr std::size_t field_index() noexcept {
+                bool const matches[] = { std::is_same<T, typename Fields::value_type>::value... };
+                std::size_t result = sizeof...(Fields);
+                for (std::size_t i = 0; i < sizeof...(Fields); ++i) {
+                    if (matches[i]) {
+                        result = result == sizeof...(Fields) ? i : sizeof...(Fields) + 1;
+                    }
+                }
+                return result;
+            }
+
+        } // namespace impl
+
+
+        template<typename... Fields>
+        class packed_word {
+            static_assert(sizeof...(Fields) > 0, "boost::flags::packed_word requires at least one field.");
+
+            using layout = impl::packed_word_layout<Fields...>;
+
+            static_assert(layout::bits <= 64, "boost::flags::packed_word: the fields don't fit into 64 bits.");
+            static_assert(layout::disjoint, "boost::flags::packed_word: the fields overlap.");
+
+        public:
+            using word_type = impl::uint_least_bits_t<layout::bits>;
+
+            template<std::size_t I>
+            using field_type = typename std::tuple_element<I, std::tuple<Fields...>>::type;
+
+            template<std::size_t I>
+            using value_type = typename field_type<I>::value_type;
+
+            template<std::size_t I>
+            static constexpr std::size_t offset() noexcept { return layout::offsets[I]; }
+
+            // the bits of field I within the word
+            template<std::size_t I>
+            static constexpr word_type mask() noexcept { return static_cast<word_type>(layout::masks[I]); }
+
+            template<std::size_t I>
+            class reference;
+
+            constexpr packed_word() noexcept = default;
+
+            constexpr explicit packed_word(typename Fields::value_type... values) noexcept
+                : bits_(make_bits(std::index_sequence_for<Fields...>{}, values...))
+            {}
+
+            // typed access by index
+
+            template<std::size_t I>
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr value_type<I> get() const noexcept {
+                return field_type<I>::decode((static_cast<std::uint64_t>(bits_) >> offset<I>()) & field_type<I>::value_mask);
+            }
+
+            // replaces field I, the other fields are unchanged
+            template<std::size_t I>
+            constexpr packed_word& set(value_type<I> value) noexcept {
+                bits_ = static_cast<word_type>((bits_ & ~mask<I>()) | place<I>(field_type<I>::encode(value)));
+                return *this;
+            }
+
+            template<std::size_t I>
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr reference<I> ref() noexcept {
+                return reference<I>(bits_);
+            }
+
+            // typed access by value type (which must occur in exactly one field)
+
+            template<typename T>
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr T get() const noexcept {
+                return get<index_of<T>()>();
+            }
+
+            template<typename T>
+            constexpr packed_word& set(T value) noexcept {
+                return set<index_of<T>()>(value);
+            }
+
+            template<typename T>
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr auto ref() noexcept {
+                return ref<index_of<T>()>();
+            }
+
+            // raw access (e.g. for std::atomic or serialization)
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr word_type to_bits() const noexcept { return bits_; }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                static constexpr packed_word from_bits(word_type bits) noexcept {
+                packed_word result;
+                result.bits_ = bits;
+                return result;
+            }
+
+            friend constexpr bool operator==(packed_word const& lhs, packed_word const& rhs) noexcept {
+                return lhs.bits_ == rhs.bits_;
+            }
+
+            friend constexpr bool operator!=(packed_word const& lhs, packed_word const& rhs) noexcept {
+                return lhs.bits_ != rhs.bits_;
+            }
+
+        private:
+            template<std::size_t I>
+            static constexpr word_type place(std::uint64_t encoded) noexcept {
+                return static_cast<word_type>(encoded << offset<I>());
+            }
+
+            template<typename T>
+            static constexpr std::size_t index_of() noexcept {
+                constexpr std::size_t index = impl::field_index<T, Fields...>();
+                static_assert(index < sizeof...(Fields),
+                    "boost::flags::packed_word: the type must occur in exactly one field.");
+                return index;
+            }
+
+            template<std::size_t... Is>
+            static constexpr word_type make_bits(std::index_sequence<Is...>, typename Fields::value_type... values) noexcept {
+                return static_cast<word_type>((place<Is>(Fields::encode(values)) | ... | word_type(0)));
+            }
+
+            template<typename... Fs>
+            friend class atomic_packed_word;
+
+            word_type bits_ = 0;
+        };
+
+
+        // proxy for a single field, the operators only modify its slice of the word
+        template<typename... Fields>
+        template<std::size_t I>
+        class packed_word<Fields...>::reference {
+            using value_t = value_type<I>;
+            using field_t = field_type<I>;
+            // only enum fields compare with their values (integers compare after conversion)
+            struct no_compare {};
+            using compare_type = typename std::conditional<std::is_enum<value_t>::value, value_t, no_compare>::type;
+
+        public:
+            constexpr operator value_t() const noexcept {
+                return field_t::decode((static_cast<std::uint64_t>(*word_) >> offset<I>()) & field_t::value_mask);
+            }
+
+            constexpr reference& operator=(value_t value) noexcept {
+                *word_ = static_cast<word_type>((*word_ & ~mask<I>()) | place<I>(field_t::encode(value)));
+                return *this;
+            }
+
+            constexpr reference& operator=(reference const& other) noexcept {
+                return *this = static_cast<value_t>(other);
+            }
+
+            template<typename T = value_t, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+            constexpr reference& operator|=(T value) noexcept {
+                *word_ = static_cast<word_type>(*word_ | place<I>(field_t::encode(value)));
+                return *this;
+            }
+
+            template<typename T = value_t, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+            constexpr reference& operator&=(T value) noexcept {
+                *word_ = static_cast<word_type>(*word_ & (~mask<I>() | place<I>(field_t::encode(value))));
+                return *this;
+            }
+
+            template<typename T = value_t, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+            constexpr reference& operator&=(complement<T> value) noexcept {
+                *word_ = static_cast<word_type>(*word_ & (~mask<I>() | (place<I>(impl::to_unsigned(value)) & mask<I>())));
+                return *this;
+            }
+
+            template<typename T = value_t, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+            constexpr reference& operator^=(T value) noexcept {
+                *word_ = static_cast<word_type>(*word_ ^ place<I>(field_t::encode(value)));
+                return *this;
+            }
+
+            friend constexpr bool operator==(reference const& lhs, compare_type rhs) noexcept { return static_cast<value_t>(lhs) == rhs; }
+            friend constexpr bool operator==(compare_type lhs, reference const& rhs) noexcept { return lhs == static_cast<value_t>(rhs); }
+            friend constexpr bool operator!=(reference const& lhs, compare_type rhs) noexcept { return static_cast<value_t>(lhs) != rhs; }
+            friend constexpr bool operator!=(compare_type lhs, reference const& rhs) noexcept { return lhs != static_cast<value_t>(rhs); }
+
+        private:
+            constexpr explicit reference(word_type& word) noexcept : word_(&word) {}
+
+            friend class packed_word;
+
+            word_type* word_;
+        };
+
+
+        // a packed_word with atomic operations
+        template<typename... Fields>
+        class atomic_packed_word {
+        public:
+            using value_type = packed_word<Fields...>;
+            using word_type = typename value_type::word_type;
+
+            static constexpr bool is_always_lock_free = std::atomic<word_type>::is_always_lock_free;
+
+            atomic_packed_word() noexcept = default;
+
+            explicit atomic_packed_word(value_type value) noexcept
+                : bits_(value.to_bits())
+            {}
+
+            atomic_packed_word(atomic_packed_word const&) = delete;
+            atomic_packed_word& operator=(atomic_packed_word const&) = delete;
+
+            bool is_lock_free() const noexcept { return bits_.is_lock_free(); }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+                return value_type::from_bits(bits_.load(order));
+            }
+
+            void store(value_type value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                bits_.store(value.to_bits(), order);
+            }
+
+            value_type exchange(value_type value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                return value_type::from_bits(bits_.exchange(value.to_bits(), order));
+            }
+
+            // all fields are compared and exchanged together
+            bool compare_exchange_weak(value_type& expected, value_type desired,
+                std::memory_order success = std::memory_order_seq_cst,
+                std::memory_order failure = std::memory_order_seq_cst) noexcept {
+                return bits_.compare_exchange_weak(expected.bits_, desired.bits_, success, failure);
+            }
+
+            bool compare_exchange_strong(value_type& expected, value_type desired,
+                std::memory_order success = std::memory_order_seq_cst,
+                std::memory_order failure = std::memory_order_seq_cst) noexcept {
+                return bits_.compare_exchange_strong(expected.bits_, desired.bits_, success, failure);
+            }
+
+            // applies `f(value_type&)` in a compare-exchange loop (f may be called several times),
+            // returns the previous value
+            template<typename F>
+            value_type update(F f, std::memory_order order = std::memory_order_seq_cst) noexcept(noexcept(f(std::declval<value_type&>()))) {
+                value_type expected = load(std::memory_order_relaxed);
+                value_type desired;
+                do {
+                    desired = expected;
+                    f(desired);
+                } while (!bits_.compare_exchange_weak(expected.bits_, desired.bits_, order, std::memory_order_relaxed));
+                return expected;
+            }
+
+            // operations on a single enum field, returning the previous value (all fields)
+
+            template<std::size_t I>
+            value_type fetch_or(typename value_type::template value_type<I> value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                static_assert(std::is_enum<decltype(value)>::value, "boost::flags::atomic_packed_word::fetch_or requires an enum field.");
+                return value_type::from_bits(bits_.fetch_or(place<I>(value), order));
+            }
+
+            template<std::size_t I>
+            value_type fetch_and(typename value_type::template value_type<I> value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                static_assert(std::is_enum<decltype(value)>::value, "boost::flags::atomic_packed_word::fetch_and requires an enum field.");
+                return value_type::from_bits(bits_.fetch_and(
+                    static_cast<word_type>(~value_type::template mask<I>() | place<I>(value)), order));
+            }
+
+            template<std::size_t I>
+            value_type fetch_and(complement<typename value_type::template value_type<I>> value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                return value_type::from_bits(bits_.fetch_and(static_cast<word_type>(~value_type::template mask<I>()
+                    | (value_type::template place<I>(impl::to_unsigned(value)) & value_type::template mask<I>())), order));
+            }
+
+            template<std::size_t I>
+            value_type fetch_xor(typename value_type::template value_type<I> value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                static_assert(std::is_enum<decltype(value)>::value, "boost::flags::atomic_packed_word::fetch_xor requires an enum field.");
+                return value_type::from_bits(bits_.fetch_xor(place<I>(value), order));
+            }
+
+        private:
+            template<std::size_t I>
+            static word_type place(typename value_type::template value_type<I> value) noexcept {
+                return value_type::template place<I>(value_type::template field_type<I>::encode(value));
+            }
+
+            std::atomic<word_type> bits_{ 0 };
+        };
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_PACKED_WORD_HPP_INCLUDED
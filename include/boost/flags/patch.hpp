@@ -0,0 +1,260 @@
+#ifndef BOOST_FLAGS_PATCH_HPP_INCLUDED
+#define BOOST_FLAGS_PATCH_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// composable modifications of flags
+//
+// a flag_patch sets, clears and toggles bits: applied to v it yields ((v & ~clear) | set) ^ toggle.
+// the masks are kept pairwise disjoint, so the composition of patches is again a patch and
+// a sequence of modifications (e.g. layers of a configuration) is applied in a single step.
+// apply_patch applies a patch to arrays of values (cf. <boost/flags/execution.hpp>).
+
+#include <boost/flags/execution.hpp>
+
+#include <cstring>
+
+namespace boost {
+    namespace flags {
+
+        namespace impl {
+            template<typename E>
+            struct patch_access;
+        } // namespace impl
+
+        template<typename E>
+        class flag_patch {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::flag_patch requires an enabled enum type.");
+
+            using bits_type = impl::unsigned_underlying_t<E>;
+
+        public:
+            using value_type = E;
+
+            // the identity
+            constexpr flag_patch() noexcept = default;
+
+            // the patch ((v & ~clear) | set) ^ toggle, the arguments may overlap
+            constexpr flag_patch(E set, E clear, E toggle) noexcept
+                : flag_patch(normalized(impl::to_unsigned(set), impl::to_unsigned(clear), impl::to_unsigned(toggle)))
+            {}
+
+            // the pairwise disjoint masks
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr E set_mask() const noexcept { return impl::from_unsigned<E>(set_); }
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr E clear_mask() const noexcept { return impl::from_unsigned<E>(clear_); }
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr E toggle_mask() const noexcept { return impl::from_unsigned<E>(toggle_); }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr bool is_identity() const noexcept { return (set_ | clear_ | toggle_) == 0; }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr E apply(E value) const noexcept {
+                return impl::from_unsigned<E>(static_cast<bits_type>(((impl::to_unsigned(value) & ~clear_) | set_) ^ toggle_));
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr E operator()(E value) const noexcept { return apply(value); }
+
+            // the patch applying *this and then `next`
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr flag_patch then(flag_patch const& next) const noexcept {
+                // bits forced by `next` take its values, the other bits forced by *this are toggled by `next`
+                bits_type const forced = static_cast<bits_type>(set_ | clear_);
+                bits_type const next_forced = static_cast<bits_type>(next.set_ | next.clear_);
+                bits_type const all_forced = static_cast<bits_type>(forced | next_forced);
+                bits_type const set = static_cast<bits_type>(next.set_ | ((set_ ^ next.toggle_) & forced & ~next_forced));
+                return flag_patch(set, static_cast<bits_type>(all_forced & ~set),
+                    static_cast<bits_type>((toggle_ ^ next.toggle_) & ~all_forced));
+            }
+
+            // builders: *this followed by a single modification (cf. the corresponding utility functions)
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr flag_patch set(E bits) const noexcept { return then(flag_patch(bits, E{}, E{})); }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr flag_patch clear(E bits) const noexcept { return then(flag_patch(E{}, bits, E{})); }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr flag_patch toggle(E bits) const noexcept { return then(flag_patch(E{}, E{}, bits)); }
+
+            // all bits of the value are replaced
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr flag_patch assign(E value) const noexcept {
+                return then(flag_patch(value, impl::from_unsigned<E>(static_cast<bits_type>(~bits_type(0))), E{}));
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr flag_patch modify(E modification, bool set_bits) const noexcept {
+                return set_bits ? set(modification) : clear(modification);
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr flag_patch add_if(E modification, bool add) const noexcept {
+                return add ? set(modification) : *this;
+            }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr flag_patch remove_if(E modification, bool remove) const noexcept {
+                return remove ? clear(modification) : *this;
+            }
+
+            // patches are equal iff they have the same effect on all values
+            friend constexpr bool operator==(flag_patch const& lhs, flag_patch const& rhs) noexcept {
+                return lhs.set_ == rhs.set_ && lhs.clear_ == rhs.clear_ && lhs.toggle_ == rhs.toggle_;
+            }
+
+            friend constexpr bool operator!=(flag_patch const& lhs, flag_patch const& rhs) noexcept {
+                return !(lhs == rhs);
+            }
+
+        private:
+            // disjoint masks
+            constexpr flag_patch(bits_type set, bits_type clear, bits_type toggle) noexcept
+                : set_(set), clear_(clear), toggle_(toggle)
+            {}
+
+            static constexpr flag_patch normalized(bits_type set, bits_type clear, bits_type toggle) noexcept {
+                // a bit in set or clear is forced to a value (toggled if also in toggle)
+                bits_type const forced = static_cast<bits_type>(set | clear);
+                bits_type const value = static_cast<bits_type>((set ^ toggle) & forced);
+                return flag_patch(value, static_cast<bits_type>(forced & ~value), static_cast<bits_type>(toggle & ~forced));
+            }
+
+            template<typename>
+            friend struct impl::patch_access;
+
+            bits_type set_ = 0;
+            bits_type clear_ = 0;
+            bits_type toggle_ = 0;
+        };
+
+// compose : the patch applying `first` and then `second`, i.e. compose(p2, p1)(v) == p2(p1(v))
+        template<typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            constexpr flag_patch<E> compose(flag_patch<E> const& second, flag_patch<E> const& first) noexcept {
+            return first.then(second);
+        }
+
+
+        namespace impl {
+
+            template<typename E>
+            struct patch_access {
+                using U = unsigned_underlying_t<E>;
+                static U set(flag_patch<E> const& p) noexcept { return p.set_; }
+                static U clear(flag_patch<E> const& p) noexcept { return p.clear_; }
+                static U toggle(flag_patch<E> const& p) noexcept { return p.toggle_; }
+            };
+
+            // the mask replicated into all lanes of a 64-bit word
+            template<typename U>
+            constexpr std::uint64_t broadcast_lanes(U mask) noexcept {
+                std::uint64_t result = 0;
+                for (std::size_t i = 0; i < 8 / sizeof(U); ++i) {
+                    result |= static_cast<std::uint64_t>(mask) << (i * 8 * sizeof(U));
+                }
+                return result;
+            }
+
+            template<typename E>
+            inline void apply_patch_scalar(E* values, std::size_t n, flag_patch<E> const& patch) noexcept {
+                using U = unsigned_underlying_t<E>;
+                U const set = patch_access<E>::set(patch);
+                U const keep = static_cast<U>(~patch_access<E>::clear(patch));
+                U const toggle = patch_access<E>::toggle(patch);
+                for (std::size_t i = 0; i < n; ++i) {
+                    values[i] = from_unsigned<E>(static_cast<U>(((to_unsigned(values[i]) & keep) | set) ^ toggle));
+                }
+            }
+
+            template<typename E>
+            inline void apply_patch_simd(E* values, std::size_t n, flag_patch<E> const& patch) noexcept {
+                using U = unsigned_underlying_t<E>;
+                std::uint64_t const set = broadcast_lanes<U>(patch_access<E>::set(patch));
+                std::uint64_t const clear = broadcast_lanes<U>(patch_access<E>::clear(patch));
+                std::uint64_t const toggle = broadcast_lanes<U>(patch_access<E>::toggle(patch));
+
+                std::size_t i = 0;
+
+#if BOOST_FLAGS_HAS_AVX2
+                constexpr std::size_t lanes = 32 / sizeof(E);
+                __m256i const s = _mm256_set1_epi64x(static_cast<long long>(set));
+                __m256i const c = _mm256_set1_epi64x(static_cast<long long>(clear));
+                __m256i const t = _mm256_set1_epi64x(static_cast<long long>(toggle));
+                for (; i + lanes <= n; i += lanes) {
+                    __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i));
+                    __m256i const r = _mm256_xor_si256(_mm256_or_si256(_mm256_andnot_si256(c, v), s), t);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), r);
+                }
+#else // BOOST_FLAGS_HAS_AVX2
+                // 64-bit SWAR
+                constexpr std::size_t lanes = 8 / sizeof(E);
+                for (; i + lanes <= n; i += lanes) {
+                    std::uint64_t w;
+                    std::memcpy(&w, values + i, sizeof(w));
+                    w = ((w & ~clear) | set) ^ toggle;
+                    std::memcpy(values + i, &w, sizeof(w));
+                }
+#endif // BOOST_FLAGS_HAS_AVX2
+
+                apply_patch_scalar(values + i, n - i, patch);
+            }
+
+            template<typename E>
+            inline void apply_patch_dispatch(execution::scalar_t, E* values, std::size_t n, flag_patch<E> const& patch) {
+                apply_patch_scalar(values, n, patch);
+            }
+
+            template<typename E>
+            inline void apply_patch_dispatch(execution::simd_t, E* values, std::size_t n, flag_patch<E> const& patch) {
+                apply_patch_simd(values, n, patch);
+            }
+
+            template<typename Executor, typename E>
+            inline void apply_patch_dispatch(execution::parallel_t<Executor> const& policy, E* values, std::size_t n, flag_patch<E> const& patch) {
+                parallel_chunks(policy, n, [&](std::size_t, std::size_t first, std::size_t last) {
+                    apply_patch_simd(values + first, last - first, patch);
+                });
+            }
+
+        } // namespace impl
+
+
+// apply_patch : replaces all values v by patch(v)
+        template<typename Policy, typename E>
+        void apply_patch(Policy const& policy, E* values, std::size_t n, flag_patch<E> const& patch) {
+            if (patch.is_identity()) {
+                return;
+            }
+            impl::apply_patch_dispatch(policy, values, n, patch);
+        }
+
+
+        // overloads for contiguous ranges and without policy (uses execution::simd)
+
+        template<typename Policy, typename Range, typename E>
+        auto apply_patch(Policy const& policy, Range&& values, flag_patch<E> const& patch)
+            -> decltype(void(impl::range_data(values))) {
+            apply_patch(policy, impl::range_data(values), impl::range_size(values), patch);
+        }
+
+        template<typename Range, typename E>
+        auto apply_patch(Range&& values, flag_patch<E> const& patch)
+            -> decltype(void(impl::range_data(values))) {
+            apply_patch(execution::simd, impl::range_data(values), impl::range_size(values), patch);
+        }
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_PATCH_HPP_INCLUDED
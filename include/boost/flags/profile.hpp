@@ -0,0 +1,266 @@
+#ifndef BOOST_FLAGS_PROFILE_HPP_INCLUDED
+#define BOOST_FLAGS_PROFILE_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// per-call-site branch profiling of the flag tests `any`, `none`, `intersect`, `disjoint` and BOOST_FLAGS_AND
+//
+// defining BOOST_FLAGS_PROFILE as 1 (for all translation units) adds a defaulted std::source_location
+// parameter to the tests, which count their outcomes per call site in thread-local tables. otherwise
+// the tests are unchanged.
+// the counters are written as binary report (write_report), which can be read (read_report) and printed
+// (dump_report, cf. tools/flags_profile_dump.cpp)
+//
+// report format (all integers little-endian):
+//      "BFLP", u32 version, u32 #strings, #strings * (u16 size, chars),
+//      u32 #sites, #sites * (u32 file, u32 function, u32 line, u32 column, u64 true, u64 false)
+// where file and function are indices into the strings
+
+#include <boost/flags/macros.hpp>
+#include <boost/flags/detail/binary_io.hpp>
+
+#if !(__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
+#error <boost/flags/profile.hpp> requires C++20 (std::source_location)
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <source_location>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+        namespace profile {
+
+            // counters of a call site
+            struct site_record {
+                std::string file;
+                std::string function;
+                std::uint32_t line = 0;
+                std::uint32_t column = 0;
+                std::uint64_t true_count = 0;
+                std::uint64_t false_count = 0;
+
+                std::uint64_t total() const noexcept { return true_count + false_count; }
+            };
+
+            namespace impl {
+
+                // call sites are identified by the addresses of their file name and the position, the
+                // same file may have different addresses in different translation units: they are
+                // merged in `registry` (which uses the names)
+                struct site_key {
+                    char const* file;
+                    std::uint_least32_t line;
+                    std::uint_least32_t column;
+
+                    bool operator==(site_key const&) const = default;
+                };
+
+                struct site_key_hash {
+                    std::size_t operator()(site_key const& k) const noexcept {
+                        return std::hash<void const*>{}(k.file) ^ (std::size_t(k.line) * 0x9E3779B97F4A7C15ull) ^ k.column;
+                    }
+                };
+
+                struct site_counters {
+                    char const* function = nullptr;
+                    std::uint64_t true_count = 0;
+                    std::uint64_t false_count = 0;
+                };
+
+                using site_table = std::unordered_map<site_key, site_counters, site_key_hash>;
+
+                // counters of finished (resp. flushed) threads
+                class registry {
+                public:
+                    static registry& instance() {
+                        static registry r;
+                        return r;
+                    }
+
+                    void merge(site_table const& table) {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        for (auto const& [key, counters] : table) {
+                            site_record& r = sites_[std::make_tuple(std::string(key.file), key.line, key.column)];
+                            if (r.file.empty()) {
+                                r.file = key.file;
+                                r.function = counters.function;
+                                r.line = key.line;
+                                r.column = key.column;
+                            }
+                            r.true_count += counters.true_count;
+                            r.false_count += counters.false_count;
+                        }
+                    }
+
+                    std::vector<site_record> records() {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        std::vector<site_record> result;
+                        result.reserve(sites_.size());
+                        for (auto const& site : sites_) {
+                            result.push_back(site.second);
+                        }
+                        return result;
+                    }
+
+                    void clear() {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        sites_.clear();
+                    }
+
+                private:
+                    std::mutex mutex_;
+                    std::map<std::tuple<std::string, std::uint32_t, std::uint32_t>, site_record> sites_;
+                };
+
+                // the counters of the current thread, merged into the registry at thread exit
+                struct thread_table {
+                    site_table table;
+
+                    ~thread_table() {
+                        registry::instance().merge(table);
+                    }
+                };
+
+                inline site_table& current_table() {
+                    // the registry is constructed before, and thus destroyed after, all thread tables
+                    registry::instance();
+                    thread_local thread_table t;
+                    return t.table;
+                }
+
+                inline void record(std::source_location const& location, bool result) noexcept {
+                    site_counters& c = current_table()[site_key{ location.file_name(), location.line(), location.column() }];
+                    c.function = location.function_name();
+                    ++(result ? c.true_count : c.false_count);
+                }
+
+                // called by the flag tests (BOOST_FLAGS_PROFILE_TEST), constant expressions are not counted
+                constexpr bool test(bool result, std::source_location const& location) noexcept {
+                    if (!std::is_constant_evaluated()) {
+                        record(location, result);
+                    }
+                    return result;
+                }
+
+
+                inline constexpr char magic[4] = { 'B', 'F', 'L', 'P' };
+                inline constexpr std::uint32_t version = 1;
+
+            } // namespace impl
+
+
+            // merges the counters of the current thread into the counters of the finished threads
+            // (counters of other running threads are not included in reports before they flush or exit)
+            inline void flush_thread() {
+                impl::site_table& table = impl::current_table();
+                impl::registry::instance().merge(table);
+                table.clear();
+            }
+
+            // counters of all finished threads and the current thread
+            inline std::vector<site_record> snapshot() {
+                flush_thread();
+                return impl::registry::instance().records();
+            }
+
+            // resets the counters of all finished threads and the current thread
+            inline void reset() {
+                impl::current_table().clear();
+                impl::registry::instance().clear();
+            }
+
+            inline void write_report(std::ostream& out, std::vector<site_record> const& records) {
+                flags::impl::string_table strings;
+                std::vector<std::uint32_t> site_strings;
+                for (site_record const& r : records) {
+                    site_strings.push_back(strings.index(r.file));
+                    site_strings.push_back(strings.index(r.function));
+                }
+
+                flags::impl::write_header(out, impl::magic, impl::version);
+                strings.write(out);
+                flags::impl::write_u32(out, static_cast<std::uint32_t>(records.size()));
+                for (std::size_t i = 0; i < records.size(); ++i) {
+                    flags::impl::write_u32(out, site_strings[2 * i]);
+                    flags::impl::write_u32(out, site_strings[2 * i + 1]);
+                    flags::impl::write_u32(out, records[i].line);
+                    flags::impl::write_u32(out, records[i].column);
+                    flags::impl::write_u64(out, records[i].true_count);
+                    flags::impl::write_u64(out, records[i].false_count);
+                }
+            }
+
+            // writes the counters of all finished threads and the current thread
+            inline void write_report(std::ostream& out) {
+                write_report(out, snapshot());
+            }
+
+            inline bool write_report(char const* path) {
+                std::ofstream out(path, std::ios::binary);
+                write_report(out);
+                return static_cast<bool>(out);
+            }
+
+            // throws std::runtime_error for malformed reports
+            inline std::vector<site_record> read_report(std::istream& in) {
+                constexpr char const* what = "boost::flags::profile::read_report";
+                flags::impl::read_header(in, impl::magic, impl::version, what);
+                std::vector<std::string> const strings = flags::impl::read_string_table(in, what);
+                std::uint32_t const n = flags::impl::read_uint<std::uint32_t>(in, what);
+                std::vector<site_record> records;
+                records.reserve(flags::impl::initial_capacity(n));
+                for (std::uint32_t i = 0; i < n; ++i) {
+                    site_record r;
+                    r.file = flags::impl::string_at(strings, flags::impl::read_uint<std::uint32_t>(in, what), what);
+                    r.function = flags::impl::string_at(strings, flags::impl::read_uint<std::uint32_t>(in, what), what);
+                    r.line = flags::impl::read_uint<std::uint32_t>(in, what);
+                    r.column = flags::impl::read_uint<std::uint32_t>(in, what);
+                    r.true_count = flags::impl::read_uint<std::uint64_t>(in, what);
+                    r.false_count = flags::impl::read_uint<std::uint64_t>(in, what);
+                    records.push_back(std::move(r));
+                }
+                return records;
+            }
+
+            // prints the call sites ordered by their number of evaluations, with a hint for sites
+            // that are at least 90% biased
+            inline void dump_report(std::ostream& out, std::vector<site_record> records) {
+                std::stable_sort(records.begin(), records.end(), [](site_record const& a, site_record const& b) {
+                    return a.total() > b.total();
+                });
+                out << "       total     true%  hint      site\n";
+                for (site_record const& r : records) {
+                    double const ratio = r.total() ? double(r.true_count) / double(r.total()) : 0.0;
+                    char percent[16];
+                    std::snprintf(percent, sizeof(percent), "%7.2f%%", 100.0 * ratio);
+                    char total[24];
+                    std::snprintf(total, sizeof(total), "%12llu", static_cast<unsigned long long>(r.total()));
+                    char const* hint = ratio >= 0.9 ? "likely  " : (ratio <= 0.1 ? "unlikely" : "        ");
+                    out << total << "  " << percent << "  " << hint << "  "
+                        << r.file << ':' << r.line << ':' << r.column << "  " << r.function << '\n';
+                }
+            }
+
+        } // namespace profile
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_PROFILE_HPP_INCLUDED
@@ -0,0 +1,273 @@
+#ifndef BOOST_FLAGS_REDUCE_HPP_INCLUDED
+#define BOOST_FLAGS_REDUCE_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// bitwise reductions and per-bit histograms over arrays of flags
+
+#include <boost/flags/detail/positional_popcount.hpp>
+#include <boost/flags/execution.hpp>
+
+#include <array>
+#include <cstring>
+
+namespace boost {
+    namespace flags {
+
+        // number of bits of the underlying type of E (i.e. size of the histograms)
+        template<typename E>
+        struct histogram_size : std::integral_constant<std::size_t, sizeof(enum_type_t<E>) * 8> {};
+
+        template<typename E>
+        using bit_histogram_t = std::array<std::uint64_t, histogram_size<E>::value>;
+
+        namespace impl {
+
+            struct or_op {
+                template<typename U>
+                static constexpr U identity() noexcept { return U(0); }
+
+                template<typename U>
+                constexpr U operator()(U a, U b) const noexcept { return static_cast<U>(a | b); }
+
+#if BOOST_FLAGS_HAS_AVX2
+                __m256i operator()(__m256i a, __m256i b) const noexcept { return _mm256_or_si256(a, b); }
+#endif // BOOST_FLAGS_HAS_AVX2
+            };
+
+            struct and_op {
+                template<typename U>
+                static constexpr U identity() noexcept { return static_cast<U>(~U(0)); }
+
+                template<typename U>
+                constexpr U operator()(U a, U b) const noexcept { return static_cast<U>(a & b); }
+
+#if BOOST_FLAGS_HAS_AVX2
+                __m256i operator()(__m256i a, __m256i b) const noexcept { return _mm256_and_si256(a, b); }
+#endif // BOOST_FLAGS_HAS_AVX2
+            };
+
+            struct xor_op {
+                template<typename U>
+                static constexpr U identity() noexcept { return U(0); }
+
+                template<typename U>
+                constexpr U operator()(U a, U b) const noexcept { return static_cast<U>(a ^ b); }
+
+#if BOOST_FLAGS_HAS_AVX2
+                __m256i operator()(__m256i a, __m256i b) const noexcept { return _mm256_xor_si256(a, b); }
+#endif // BOOST_FLAGS_HAS_AVX2
+            };
+
+
+            template<typename Op, typename E>
+            inline unsigned_underlying_t<E> reduce_scalar(E const* values, std::size_t n, Op op) noexcept {
+                using U = unsigned_underlying_t<E>;
+                U result = Op::template identity<U>();
+                for (std::size_t i = 0; i < n; ++i) {
+                    result = op(result, to_unsigned(values[i]));
+                }
+                return result;
+            }
+
+            // the operations are lane-wise, so the values are combined as wide words and
+            // the lanes of the wide accumulator are folded at the end
+            template<typename Op, typename E>
+            inline unsigned_underlying_t<E> reduce_simd(E const* values, std::size_t n, Op op) noexcept {
+                using U = unsigned_underlying_t<E>;
+                U result = Op::template identity<U>();
+                std::size_t i = 0;
+
+#if BOOST_FLAGS_HAS_AVX2
+                constexpr std::size_t lanes = 32 / sizeof(E);
+                if (n >= 4 * lanes) {
+                    // the identities consist of all-zero or all-one bytes
+                    __m256i const identity = _mm256_set1_epi8(static_cast<char>(Op::template identity<U>()));
+                    __m256i acc0 = identity, acc1 = identity, acc2 = identity, acc3 = identity;
+                    for (; i + 4 * lanes <= n; i += 4 * lanes) {
+                        acc0 = op(acc0, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i)));
+                        acc1 = op(acc1, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i + lanes)));
+                        acc2 = op(acc2, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i + 2 * lanes)));
+                        acc3 = op(acc3, _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i + 3 * lanes)));
+                    }
+                    U folded[lanes];
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(folded), op(op(acc0, acc1), op(acc2, acc3)));
+                    for (U v : folded) {
+                        result = op(result, v);
+                    }
+                }
+#else // BOOST_FLAGS_HAS_AVX2
+                // 64-bit SWAR with independent accumulators
+                constexpr std::size_t lanes = 8 / sizeof(E);
+                if (lanes > 1 && n >= 4 * lanes) {
+                    std::uint64_t const identity = Op::template identity<U>() ? ~std::uint64_t(0) : 0;
+                    std::uint64_t acc[4] = { identity, identity, identity, identity };
+                    for (; i + 4 * lanes <= n; i += 4 * lanes) {
+                        for (std::size_t k = 0; k < 4; ++k) {
+                            std::uint64_t w;
+                            std::memcpy(&w, values + i + k * lanes, sizeof(w));
+                            acc[k] = op(acc[k], w);
+                        }
+                    }
+                    U folded[lanes];
+                    std::uint64_t const w = op(op(acc[0], acc[1]), op(acc[2], acc[3]));
+                    std::memcpy(folded, &w, sizeof(w));
+                    for (U v : folded) {
+                        result = op(result, v);
+                    }
+                }
+#endif // BOOST_FLAGS_HAS_AVX2
+
+                return op(result, reduce_scalar(values + i, n - i, op));
+            }
+
+            template<typename Op, typename Executor, typename E>
+            inline unsigned_underlying_t<E> reduce_parallel(execution::parallel_t<Executor> const& policy, E const* values, std::size_t n, Op op) {
+                using U = unsigned_underlying_t<E>;
+                std::vector<U> partials(parallel_tasks(policy, n), Op::template identity<U>());
+                parallel_chunks(policy, n, [&](std::size_t task, std::size_t first, std::size_t last) {
+                    partials[task] = reduce_simd(values + first, last - first, op);
+                });
+                U result = Op::template identity<U>();
+                for (U v : partials) {
+                    result = op(result, v);
+                }
+                return result;
+            }
+
+            template<typename Op, typename E>
+            inline unsigned_underlying_t<E> reduce_dispatch(execution::scalar_t, E const* values, std::size_t n, Op op) {
+                return reduce_scalar(values, n, op);
+            }
+
+            template<typename Op, typename E>
+            inline unsigned_underlying_t<E> reduce_dispatch(execution::simd_t, E const* values, std::size_t n, Op op) {
+                return reduce_simd(values, n, op);
+            }
+
+            template<typename Op, typename Executor, typename E>
+            inline unsigned_underlying_t<E> reduce_dispatch(execution::parallel_t<Executor> const& policy, E const* values, std::size_t n, Op op) {
+                return reduce_parallel(policy, values, n, op);
+            }
+
+
+            template<typename E>
+            inline void bit_histogram_dispatch(execution::scalar_t, bit_histogram_t<E>& counters, E const* values, std::size_t n) {
+                positional_popcount_scalar(counters, values, n);
+            }
+
+            template<typename E>
+            inline void bit_histogram_dispatch(execution::simd_t, bit_histogram_t<E>& counters, E const* values, std::size_t n) {
+                positional_popcount<simd_word>(counters, values, n);
+            }
+
+            template<typename Executor, typename E>
+            inline void bit_histogram_dispatch(execution::parallel_t<Executor> const& policy, bit_histogram_t<E>& counters, E const* values, std::size_t n) {
+                std::vector<bit_histogram_t<E>> partials(parallel_tasks(policy, n), bit_histogram_t<E>{});
+                parallel_chunks(policy, n, [&](std::size_t task, std::size_t first, std::size_t last) {
+                    positional_popcount<simd_word>(partials[task], values + first, last - first);
+                });
+                for (auto const& partial : partials) {
+                    for (std::size_t b = 0; b < counters.size(); ++b) {
+                        counters[b] += partial[b];
+                    }
+                }
+            }
+
+        } // namespace impl
+
+
+// reduce_or : bitwise or of all values (empty ranges result in an empty value)
+        template<typename Policy, typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            enum_type_t<E> reduce_or(Policy const& policy, E const* values, std::size_t n) {
+            static_assert(is_flags<E>::value, "boost::flags::reduce_or requires an enabled enum type.");
+            return impl::from_unsigned<E>(impl::reduce_dispatch(policy, values, n, impl::or_op{}));
+        }
+
+// reduce_and : bitwise and of all values (empty ranges result in a value with all bits set)
+        template<typename Policy, typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            enum_type_t<E> reduce_and(Policy const& policy, E const* values, std::size_t n) {
+            static_assert(is_flags<E>::value, "boost::flags::reduce_and requires an enabled enum type.");
+            return impl::from_unsigned<E>(impl::reduce_dispatch(policy, values, n, impl::and_op{}));
+        }
+
+// reduce_xor : bitwise exclusive or of all values (empty ranges result in an empty value)
+        template<typename Policy, typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            enum_type_t<E> reduce_xor(Policy const& policy, E const* values, std::size_t n) {
+            static_assert(is_flags<E>::value, "boost::flags::reduce_xor requires an enabled enum type.");
+            return impl::from_unsigned<E>(impl::reduce_dispatch(policy, values, n, impl::xor_op{}));
+        }
+
+// bit_histogram : for every bit of the underlying type the number of values having that bit set
+        template<typename Policy, typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            bit_histogram_t<E> bit_histogram(Policy const& policy, E const* values, std::size_t n) {
+            static_assert(is_flags<E>::value, "boost::flags::bit_histogram requires an enabled enum type.");
+            bit_histogram_t<E> counters{};
+            impl::bit_histogram_dispatch(policy, counters, values, n);
+            return counters;
+        }
+
+
+        // overloads for contiguous ranges and without policy (uses execution::simd)
+
+        template<typename Policy, typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto reduce_or(Policy const& policy, Range const& values) -> enum_type_t<impl::range_value_t<Range>> {
+            return reduce_or(policy, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto reduce_or(Range const& values) -> enum_type_t<impl::range_value_t<Range>> {
+            return reduce_or(execution::simd, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Policy, typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto reduce_and(Policy const& policy, Range const& values) -> enum_type_t<impl::range_value_t<Range>> {
+            return reduce_and(policy, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto reduce_and(Range const& values) -> enum_type_t<impl::range_value_t<Range>> {
+            return reduce_and(execution::simd, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Policy, typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto reduce_xor(Policy const& policy, Range const& values) -> enum_type_t<impl::range_value_t<Range>> {
+            return reduce_xor(policy, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto reduce_xor(Range const& values) -> enum_type_t<impl::range_value_t<Range>> {
+            return reduce_xor(execution::simd, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Policy, typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto bit_histogram(Policy const& policy, Range const& values) -> bit_histogram_t<impl::range_value_t<Range>> {
+            return bit_histogram(policy, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto bit_histogram(Range const& values) -> bit_histogram_t<impl::range_value_t<Range>> {
+            return bit_histogram(execution::simd, impl::range_data(values), impl::range_size(values));
+        }
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_REDUCE_HPP_INCLUDED
@@ -0,0 +1,202 @@
+#ifndef BOOST_FLAGS_SCAN_HPP_INCLUDED
+#define BOOST_FLAGS_SCAN_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// scanning arrays-of-structs containing a flags member
+
+#include <boost/flags/detail/bits.hpp>
+
+namespace boost {
+    namespace flags {
+
+        // fused mask-compare predicate: tests `(value & mask) == expected` in one step
+        template<typename E>
+        struct mask_compare {
+            static_assert(is_flags<E>::value && std::is_enum<E>::value, "boost::flags::mask_compare is only allowed on enabled enum types.");
+
+            E mask;
+            E expected;
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr bool operator()(E value) const noexcept {
+                return (impl::to_unsigned(value) & impl::to_unsigned(mask)) == impl::to_unsigned(expected);
+            }
+        };
+
+// match : predicate testing that the bits of `mask` in a value are equal to `expected`
+        template<typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            constexpr mask_compare<E> match(E mask, E expected) noexcept {
+            return { mask, expected };
+        }
+
+// match_all : predicate testing that all bits of `mask` are set
+        template<typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            constexpr mask_compare<E> match_all(E mask) noexcept {
+            return { mask, mask };
+        }
+
+// match_none : predicate testing that no bit of `mask` is set
+        template<typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            constexpr mask_compare<E> match_none(E mask) noexcept {
+            return { mask, static_cast<E>(0) };
+        }
+
+
+        // distance (in bytes) the scans prefetch ahead of the end of the current block of 64 records
+#if !defined(BOOST_FLAGS_SCAN_PREFETCH_DISTANCE)
+# define BOOST_FLAGS_SCAN_PREFETCH_DISTANCE 1024
+#endif // !defined(BOOST_FLAGS_SCAN_PREFETCH_DISTANCE)
+
+        namespace impl {
+
+            template<typename T>
+            struct is_mask_compare : std::false_type {};
+
+            template<typename E>
+            struct is_mask_compare<mask_compare<E>> : std::true_type {};
+
+            template<auto Member>
+            struct member_traits;
+
+            template<typename Rec, typename E, E Rec::* Member>
+            struct member_traits<Member> {
+                using record_type = Rec;
+                using value_type = E;
+            };
+
+            // prefetches the flags members of the records in [first, last) at cache-line granularity
+            template<auto Member, typename Rec>
+            inline void prefetch_members(Rec const* first, Rec const* last) noexcept {
+                constexpr std::size_t step = sizeof(Rec) >= 64 ? 1 : 64 / sizeof(Rec);
+                for (; first < last; first += (static_cast<std::size_t>(last - first) > step ? step : static_cast<std::size_t>(last - first))) {
+                    BOOST_FLAGS_PREFETCH(&(first->*Member));
+                }
+            }
+
+#if BOOST_FLAGS_HAS_AVX2
+            // gathers 8 strided 32-bit flag words and applies the fused mask-compare
+            template<auto Member, typename Rec, typename E>
+            inline std::uint64_t scan_block_gather(Rec const* base, std::size_t count, mask_compare<E> const& pred) noexcept {
+                char const* first = reinterpret_cast<char const*>(&(base->*Member));
+                __m256i const offsets = _mm256_mullo_epi32(
+                    _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                    _mm256_set1_epi32(static_cast<int>(sizeof(Rec))));
+                __m256i const mask = _mm256_set1_epi32(static_cast<int>(to_unsigned(pred.mask)));
+                __m256i const expected = _mm256_set1_epi32(static_cast<int>(to_unsigned(pred.expected)));
+
+                std::uint64_t result = 0;
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    __m256i const values = _mm256_i32gather_epi32(
+                        reinterpret_cast<int const*>(first + i * sizeof(Rec)), offsets, 1);
+                    __m256i const eq = _mm256_cmpeq_epi32(_mm256_and_si256(values, mask), expected);
+                    result |= static_cast<std::uint64_t>(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(eq)))) << i;
+                }
+                for (; i < count; ++i) {
+                    result |= static_cast<std::uint64_t>(pred(base[i].*Member)) << i;
+                }
+                return result;
+            }
+#endif // BOOST_FLAGS_HAS_AVX2
+
+            // evaluates `pred` on up to 64 records and returns the matches as bitmask
+            template<auto Member, typename Rec, typename Pred>
+            inline std::uint64_t scan_block(Rec const* base, std::size_t count, Pred const& pred) noexcept {
+#if BOOST_FLAGS_HAS_AVX2
+                using value_type = typename member_traits<Member>::value_type;
+                if constexpr (is_mask_compare<Pred>::value && sizeof(value_type) == 4
+                    && sizeof(Rec) <= 0x7fffffff / 8) {
+                    return scan_block_gather<Member>(base, count, pred);
+                }
+                else
+#endif // BOOST_FLAGS_HAS_AVX2
+                {
+                    std::uint64_t result = 0;
+                    for (std::size_t i = 0; i < count; ++i) {
+                        result |= static_cast<std::uint64_t>(static_cast<bool>(pred(base[i].*Member))) << i;
+                    }
+                    return result;
+                }
+            }
+
+            // drives the blockwise scan and passes each 64-record bitmask to `sink(block_index, bits)`
+            template<auto Member, typename Rec, typename Pred, typename Sink>
+            inline void scan_blocks(Rec const* records, std::size_t n, Pred const& pred, Sink&& sink) {
+                constexpr std::size_t ahead = BOOST_FLAGS_SCAN_PREFETCH_DISTANCE / sizeof(Rec) + 1;
+                Rec const* const last = records + n;
+                for (std::size_t block = 0; block * 64 < n; ++block) {
+                    std::size_t const first = block * 64;
+                    std::size_t const count = n - first < 64 ? n - first : 64;
+                    Rec const* const base = records + first;
+
+                    // prefetch the next block's worth of records `ahead` positions ahead of the end of the current block
+                    // (the windows of consecutive blocks are adjacent, the current block is already being loaded)
+                    Rec const* const end = base + count;
+                    Rec const* const pf_first = static_cast<std::size_t>(last - end) > ahead ? end + ahead : last;
+                    Rec const* const pf_last = static_cast<std::size_t>(last - pf_first) > count ? pf_first + count : last;
+                    prefetch_members<Member>(pf_first, pf_last);
+
+                    sink(block, scan_block<Member>(base, count, pred));
+                }
+            }
+
+        } // namespace impl
+
+
+// scan_member : writes the indices of all records whose member `Member` satisfies `pred` to `selection`
+//               (which must provide space for `n` indices) and returns the number of matches
+        template<auto Member, typename Rec, typename Pred, typename Index>
+        std::size_t scan_member(Rec const* records, std::size_t n, Pred pred, Index* selection) {
+            static_assert(std::is_integral<Index>::value, "boost::flags::scan_member requires an integral index type.");
+            static_assert(is_flags<typename impl::member_traits<Member>::value_type>::value,
+                "boost::flags::scan_member requires a member of enabled enum type.");
+
+            std::size_t count = 0;
+            impl::scan_blocks<Member>(records, n, pred, [&](std::size_t block, std::uint64_t bits) {
+                // one iteration per match, blocks without matches cost a single test
+                while (bits) {
+                    selection[count++] = static_cast<Index>(block * 64 + static_cast<std::size_t>(impl::countr_zero(bits)));
+                    bits &= bits - 1;
+                }
+            });
+            return count;
+        }
+
+        template<auto Member, typename Range, typename Pred, typename Index>
+        std::size_t scan_member(Range const& records, Pred pred, Index* selection) {
+            return scan_member<Member>(impl::range_data(records), impl::range_size(records), pred, selection);
+        }
+
+// scan_member_bitmap : sets bit `i % 64` of `bitmap[i / 64]` iff record `i` satisfies `pred`
+//                      (`bitmap` must provide space for `(n + 63) / 64` words) and returns the number of matches
+        template<auto Member, typename Rec, typename Pred>
+        std::size_t scan_member_bitmap(Rec const* records, std::size_t n, Pred pred, std::uint64_t* bitmap) {
+            static_assert(is_flags<typename impl::member_traits<Member>::value_type>::value,
+                "boost::flags::scan_member_bitmap requires a member of enabled enum type.");
+
+            std::size_t count = 0;
+            impl::scan_blocks<Member>(records, n, pred, [&](std::size_t block, std::uint64_t bits) {
+                bitmap[block] = bits;
+                count += static_cast<std::size_t>(impl::popcount(bits));
+            });
+            return count;
+        }
+
+        template<auto Member, typename Range, typename Pred>
+        std::size_t scan_member_bitmap(Range const& records, Pred pred, std::uint64_t* bitmap) {
+            return scan_member_bitmap<Member>(impl::range_data(records), impl::range_size(records), pred, bitmap);
+        }
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_SCAN_HPP_INCLUDED
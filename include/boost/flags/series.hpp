@@ -0,0 +1,421 @@
+#ifndef BOOST_FLAGS_SERIES_HPP_INCLUDED
+#define BOOST_FLAGS_SERIES_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// compressed storage of time series of flags (consecutive values are expected to be nearly identical)
+//
+// the values are split into blocks of `checkpoint_interval` values, each block is decoded independently:
+//   varint #values, varint first value, varint mask of the non-empty bit planes,
+//   for each non-empty bit plane of the deltas (value ^ previous value): varint #ones, followed by
+//   either the varint gaps between the ones or, if not larger, the plane as bitmap
+//
+// stream layout (little-endian, cf. boost/flags/detail/binary_io.hpp):
+//   header: 'BFTS', u32 version, u32 sizeof(E), u32 checkpoint_interval
+//   blocks: u32 #bytes, encoded block
+//   index:  u64 offset (from the start of the header) per block
+//   trailer: u64 #values, u64 offset of the index
+
+#include <boost/flags/detail/bits.hpp>
+#include <boost/flags/detail/binary_io.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+        namespace impl {
+            namespace series {
+
+                inline constexpr char magic[4] = { 'B', 'F', 'T', 'S' };
+                inline constexpr std::uint32_t version = 1;
+
+                inline void write_varint(std::vector<unsigned char>& out, std::uint64_t v) {
+                    while (v >= 0x80) {
+                        out.push_back(static_cast<unsigned char>(v | 0x80));
+                        v >>= 7;
+                    }
+                    out.push_back(static_cast<unsigned char>(v));
+                }
+
+                // bounds-checked reading of an encoded block
+                struct block_input {
+                    unsigned char const* p;
+                    unsigned char const* end;
+
+                    [[noreturn]] static void malformed() {
+                        throw std::runtime_error("boost::flags::series_reader: malformed block");
+                    }
+
+                    std::uint64_t varint() {
+                        std::uint64_t v = 0;
+                        for (unsigned shift = 0; shift < 64; shift += 7) {
+                            if (p == end) {
+                                malformed();
+                            }
+                            unsigned char const b = *p++;
+                            v |= std::uint64_t(b & 0x7f) << shift;
+                            if ((b & 0x80) == 0) {
+                                return v;
+                            }
+                        }
+                        malformed();
+                    }
+
+                    unsigned char const* bytes(std::size_t n) {
+                        if (static_cast<std::size_t>(end - p) < n) {
+                            malformed();
+                        }
+                        unsigned char const* result = p;
+                        p += n;
+                        return result;
+                    }
+                };
+
+                // the number of bytes of the bitmap of a plane of the deltas 1 .. n-1
+                inline std::size_t bitmap_size(std::size_t n) noexcept {
+                    return n < 2 ? 0 : (n - 1 + 7) / 8;
+                }
+
+                template<typename U>
+                void encode_block(U const* values, std::size_t n, std::vector<std::vector<std::uint32_t>>& planes,
+                    std::vector<unsigned char>& out) {
+                    for (auto& plane : planes) {
+                        plane.clear();
+                    }
+                    std::uint64_t plane_mask = 0;
+                    for (std::size_t i = 1; i < n; ++i) {
+                        std::uint64_t delta = static_cast<std::uint64_t>(values[i] ^ values[i - 1]);
+                        plane_mask |= delta;
+                        while (delta != 0) {
+                            planes[static_cast<std::size_t>(countr_zero(delta))].push_back(static_cast<std::uint32_t>(i));
+                            delta &= delta - 1;
+                        }
+                    }
+
+                    out.clear();
+                    write_varint(out, n);
+                    write_varint(out, n == 0 ? 0 : static_cast<std::uint64_t>(values[0]));
+                    write_varint(out, plane_mask);
+                    std::size_t const bitmap_bytes = bitmap_size(n);
+                    for (std::uint64_t m = plane_mask; m != 0; m &= m - 1) {
+                        std::vector<std::uint32_t> const& plane = planes[static_cast<std::size_t>(countr_zero(m))];
+                        write_varint(out, plane.size());
+                        if (plane.size() >= bitmap_bytes) {
+                            std::size_t const first = out.size();
+                            out.resize(first + bitmap_bytes, 0);
+                            for (std::uint32_t i : plane) {
+                                out[first + (i - 1) / 8] |= static_cast<unsigned char>(1u << ((i - 1) % 8));
+                            }
+                        } else {
+                            std::uint32_t previous = 0;
+                            for (std::uint32_t i : plane) {
+                                write_varint(out, i - previous);
+                                previous = i;
+                            }
+                        }
+                    }
+                }
+
+                // decodes the block into `values`, which holds the expected number of values
+                template<typename U>
+                void decode_block(block_input in, U* values, std::size_t n) {
+                    if (in.varint() != n) {
+                        block_input::malformed();
+                    }
+                    std::uint64_t const first = in.varint();
+                    std::uint64_t const plane_mask = in.varint();
+                    if (n == 0) {
+                        return;
+                    }
+                    if (((first | plane_mask) & ~std::uint64_t(static_cast<U>(~U(0)))) != 0) {
+                        block_input::malformed();
+                    }
+
+                    // the deltas are collected in values[1 .. n-1]
+                    values[0] = static_cast<U>(first);
+                    std::memset(static_cast<void*>(values + 1), 0, (n - 1) * sizeof(U));
+                    std::size_t const bitmap_bytes = bitmap_size(n);
+                    for (std::uint64_t m = plane_mask; m != 0; m &= m - 1) {
+                        U const bit = static_cast<U>(U(1) << countr_zero(m));
+                        std::uint64_t const ones = in.varint();
+                        if (ones >= n) {
+                            block_input::malformed();
+                        }
+                        if (ones >= bitmap_bytes) {
+                            unsigned char const* bitmap = in.bytes(bitmap_bytes);
+                            for (std::size_t j = 0; j < bitmap_bytes; ++j) {
+                                for (unsigned b = bitmap[j]; b != 0; b &= b - 1) {
+                                    std::size_t const i = 8 * j + static_cast<std::size_t>(countr_zero(b)) + 1;
+                                    if (i >= n) {
+                                        block_input::malformed();
+                                    }
+                                    values[i] |= bit;
+                                }
+                            }
+                        } else {
+                            std::uint64_t i = 0;
+                            for (std::uint64_t k = 0; k < ones; ++k) {
+                                i += in.varint();
+                                if (i == 0 || i >= n) {
+                                    block_input::malformed();
+                                }
+                                values[i] |= bit;
+                            }
+                        }
+                    }
+
+                    // prefix xor
+                    U v = values[0];
+                    for (std::size_t i = 1; i < n; ++i) {
+                        v = static_cast<U>(v ^ values[i]);
+                        values[i] = v;
+                    }
+                }
+
+            } // namespace series
+        } // namespace impl
+
+
+        // writes a compressed series of values to a stream, the index is written by close() (resp. the destructor)
+        template<typename E>
+        class series_writer {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::series_writer requires an enabled enum type.");
+            using U = impl::unsigned_underlying_t<E>;
+
+        public:
+            explicit series_writer(std::ostream& out, std::size_t checkpoint_interval = 4096)
+                : out_(out)
+                , interval_(checkpoint_interval)
+                , planes_(8 * sizeof(U))
+            {
+                BOOST_FLAGS_ASSERT(checkpoint_interval > 0 && checkpoint_interval <= 0xffffffffu);
+                impl::write_header(out_, impl::series::magic, impl::series::version);
+                impl::write_u32(out_, static_cast<std::uint32_t>(sizeof(E)));
+                impl::write_u32(out_, static_cast<std::uint32_t>(interval_));
+                position_ = 16;
+                pending_.reserve(interval_);
+            }
+
+            series_writer(series_writer const&) = delete;
+            series_writer& operator=(series_writer const&) = delete;
+
+            ~series_writer() {
+                close();
+            }
+
+            void push(E value) {
+                BOOST_FLAGS_ASSERT(!closed_);
+                pending_.push_back(impl::to_unsigned(value));
+                ++size_;
+                if (pending_.size() == interval_) {
+                    write_block();
+                }
+            }
+
+            void write(E const* values, std::size_t n) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    push(values[i]);
+                }
+            }
+
+            template<typename Range>
+            auto write(Range const& values) -> decltype(void(impl::range_data(values))) {
+                write(impl::range_data(values), impl::range_size(values));
+            }
+
+            // the number of written values
+            std::uint64_t size() const noexcept { return size_; }
+
+            // writes the pending values and the index, further calls have no effect
+            void close() {
+                if (closed_) {
+                    return;
+                }
+                closed_ = true;
+                if (!pending_.empty()) {
+                    write_block();
+                }
+                std::uint64_t const index = position_;
+                for (std::uint64_t offset : offsets_) {
+                    impl::write_u64(out_, offset);
+                }
+                impl::write_u64(out_, size_);
+                impl::write_u64(out_, index);
+            }
+
+        private:
+            void write_block() {
+                impl::series::encode_block(pending_.data(), pending_.size(), planes_, block_);
+                offsets_.push_back(position_);
+                impl::write_u32(out_, static_cast<std::uint32_t>(block_.size()));
+                out_.write(reinterpret_cast<char const*>(block_.data()), static_cast<std::streamsize>(block_.size()));
+                position_ += 4 + block_.size();
+                pending_.clear();
+            }
+
+            std::ostream& out_;
+            std::size_t interval_;
+            std::vector<U> pending_;
+            std::vector<std::vector<std::uint32_t>> planes_;
+            std::vector<unsigned char> block_;
+            std::vector<std::uint64_t> offsets_;
+            std::uint64_t position_ = 0;
+            std::uint64_t size_ = 0;
+            bool closed_ = false;
+        };
+
+
+        // random access to a compressed series, the stream must be seekable and the series must extend to its end
+        // throws std::runtime_error for malformed series
+        template<typename E>
+        class series_reader {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::series_reader requires an enabled enum type.");
+            using U = impl::unsigned_underlying_t<E>;
+
+            static constexpr char const* what = "boost::flags::series_reader";
+
+        public:
+            explicit series_reader(std::istream& in)
+                : in_(in)
+            {
+                std::streamoff const base = in_.tellg();
+                if (base < 0) {
+                    throw std::runtime_error(std::string(what) + ": stream is not seekable");
+                }
+                base_ = static_cast<std::uint64_t>(base);
+                impl::read_header(in_, impl::series::magic, impl::series::version, what);
+                if (impl::read_uint<std::uint32_t>(in_, what) != sizeof(E)) {
+                    throw std::runtime_error(std::string(what) + ": value size mismatch");
+                }
+                interval_ = impl::read_uint<std::uint32_t>(in_, what);
+                if (interval_ == 0) {
+                    throw std::runtime_error(std::string(what) + ": invalid checkpoint interval");
+                }
+
+                in_.seekg(0, std::ios::end);
+                std::streamoff const end = in_.tellg();
+                if (end < 0 || static_cast<std::uint64_t>(end) < base_ + 32) {
+                    throw std::runtime_error(std::string(what) + ": unexpected end of input");
+                }
+                std::uint64_t const length = static_cast<std::uint64_t>(end) - base_;
+                seek(length - 16);
+                size_ = impl::read_uint<std::uint64_t>(in_, what);
+                index_ = impl::read_uint<std::uint64_t>(in_, what);
+                std::uint64_t const blocks = size_ / interval_ + (size_ % interval_ != 0);
+                if (index_ < 16 || index_ > length - 16 || (length - 16 - index_) / 8 != blocks || (length - 16 - index_) % 8 != 0) {
+                    throw std::runtime_error(std::string(what) + ": invalid index");
+                }
+                seek(index_);
+                offsets_.resize(static_cast<std::size_t>(blocks));
+                for (std::uint64_t& offset : offsets_) {
+                    offset = impl::read_uint<std::uint64_t>(in_, what);
+                    if (offset < 16 || offset >= index_) {
+                        throw std::runtime_error(std::string(what) + ": invalid index");
+                    }
+                }
+            }
+
+            series_reader(series_reader const&) = delete;
+            series_reader& operator=(series_reader const&) = delete;
+
+            std::uint64_t size() const noexcept { return size_; }
+
+            std::size_t checkpoint_interval() const noexcept { return interval_; }
+
+            // throws std::out_of_range if i >= size()
+            E at(std::uint64_t i) {
+                if (i >= size_) {
+                    throw std::out_of_range("boost::flags::series_reader::at: index out of range");
+                }
+                load_block(static_cast<std::size_t>(i / interval_));
+                return impl::from_unsigned<E>(block_[static_cast<std::size_t>(i % interval_)]);
+            }
+
+            // decodes the values [first, first + n), throws std::out_of_range if first + n > size()
+            void read(std::uint64_t first, E* values, std::size_t n) {
+                if (first > size_ || n > size_ - first) {
+                    throw std::out_of_range("boost::flags::series_reader::read: range out of range");
+                }
+                while (n != 0) {
+                    load_block(static_cast<std::size_t>(first / interval_));
+                    std::size_t const offset = static_cast<std::size_t>(first % interval_);
+                    std::size_t const count = std::min(n, block_.size() - offset);
+                    for (std::size_t i = 0; i < count; ++i) {
+                        values[i] = impl::from_unsigned<E>(block_[offset + i]);
+                    }
+                    values += count;
+                    first += count;
+                    n -= count;
+                }
+            }
+
+            template<typename Range>
+            auto read(std::uint64_t first, Range&& values) -> decltype(void(impl::range_data(values))) {
+                read(first, impl::range_data(values), impl::range_size(values));
+            }
+
+            std::vector<E> read_all() {
+                std::vector<E> values(static_cast<std::size_t>(size_));
+                read(0, values.data(), values.size());
+                return values;
+            }
+
+        private:
+            void seek(std::uint64_t offset) {
+                in_.clear();
+                if (!in_.seekg(static_cast<std::streamoff>(base_ + offset))) {
+                    throw std::runtime_error(std::string(what) + ": unexpected end of input");
+                }
+            }
+
+            void load_block(std::size_t b) {
+                if (b == current_) {
+                    return;
+                }
+                current_ = static_cast<std::size_t>(-1);
+                seek(offsets_[b]);
+                // the block extends to the next block, resp. to the index
+                std::uint64_t const end = b + 1 < offsets_.size() ? offsets_[b + 1] : index_;
+                std::uint32_t const length = impl::read_uint<std::uint32_t>(in_, what);
+                if (end < offsets_[b] + 4 || length > end - offsets_[b] - 4) {
+                    impl::series::block_input::malformed();
+                }
+                bytes_.resize(length);
+                if (!in_.read(reinterpret_cast<char*>(bytes_.data()), static_cast<std::streamsize>(bytes_.size()))) {
+                    throw std::runtime_error(std::string(what) + ": unexpected end of input");
+                }
+                std::uint64_t const first = std::uint64_t(b) * interval_;
+                block_.resize(static_cast<std::size_t>(std::min<std::uint64_t>(interval_, size_ - first)));
+                impl::series::decode_block(impl::series::block_input{ bytes_.data(), bytes_.data() + bytes_.size() },
+                    block_.data(), block_.size());
+                current_ = b;
+            }
+
+            std::istream& in_;
+            std::uint64_t base_ = 0;
+            std::size_t interval_ = 0;
+            std::uint64_t size_ = 0;
+            std::uint64_t index_ = 0;
+            std::vector<std::uint64_t> offsets_;
+            std::vector<unsigned char> bytes_;
+            std::vector<U> block_;
+            std::size_t current_ = static_cast<std::size_t>(-1);
+        };
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_SERIES_HPP_INCLUDED
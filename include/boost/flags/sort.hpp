@@ -0,0 +1,183 @@
+#ifndef BOOST_FLAGS_SORT_HPP_INCLUDED
+#define BOOST_FLAGS_SORT_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// stable radix sort and grouping of ranges by a flags key
+//
+// only the domain bits of the key are sorted (cf. domain.hpp): the keys are compacted to
+// domain_bits_v<E> bits and sorted with LSD radix passes of at most `radix_digit_bits` bits,
+// thus small domains are sorted by a single counting sort into 2^domain_bits_v<E> buckets
+
+#include <boost/flags/domain.hpp>
+
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace flags {
+
+        // a maximal subrange with equal keys
+        template<typename E, typename It>
+        struct flags_group {
+            E value;
+            It first;
+            It last;
+        };
+
+        namespace impl {
+
+            struct identity_projection {
+                template<typename T>
+                constexpr T&& operator()(T&& t) const noexcept {
+                    return std::forward<T>(t);
+                }
+            };
+
+            template<typename It, typename Proj>
+            using projected_flags_t = enum_type_t<typename std::decay<
+                decltype(std::invoke(std::declval<Proj&>(), *std::declval<It&>()))>::type>;
+
+            // compacted key, whose unsigned order is the order of total_order (for values inside the domain)
+            template<typename E>
+            inline std::uint64_t radix_key(E value) noexcept {
+                using underlying = typename std::underlying_type<enum_type_t<E>>::type;
+                std::uint64_t key = compact_domain(value);
+                if constexpr (std::is_signed<underlying>::value) {
+                    constexpr auto sign = static_cast<unsigned_underlying_t<E>>(unsigned_underlying_t<E>(1) << (sizeof(underlying) * 8 - 1));
+                    if constexpr ((domain_helper<enum_type_t<E>>::value & sign) != 0) {
+                        key ^= std::uint64_t(1) << (domain_bits_v<E> - 1);
+                    }
+                }
+                return key;
+            }
+
+            constexpr std::size_t radix_digit_bits = 11;
+
+            struct radix_entry {
+                std::uint64_t key;
+                std::size_t index;
+            };
+
+            // stable LSD radix sort of the entries by key, `bits` is the number of significant key bits
+            inline void radix_sort_entries(std::vector<radix_entry>& entries, std::size_t bits) {
+                std::size_t const passes = bits == 0 ? 0 : (bits + radix_digit_bits - 1) / radix_digit_bits;
+                if (passes == 0 || entries.size() < 2) {
+                    return;
+                }
+                std::size_t const digit_bits = (bits + passes - 1) / passes;
+                std::size_t const buckets = std::size_t(1) << digit_bits;
+                std::uint64_t const digit_mask = buckets - 1;
+
+                std::vector<radix_entry> buffer(entries.size());
+                std::vector<std::size_t> offsets(buckets);
+                for (std::size_t pass = 0; pass < passes; ++pass) {
+                    std::size_t const shift = pass * digit_bits;
+                    std::fill(offsets.begin(), offsets.end(), 0);
+                    for (auto const& e : entries) {
+                        ++offsets[(e.key >> shift) & digit_mask];
+                    }
+                    // all keys share this digit
+                    if (offsets[(entries.front().key >> shift) & digit_mask] == entries.size()) {
+                        continue;
+                    }
+                    std::size_t sum = 0;
+                    for (auto& offset : offsets) {
+                        std::size_t const count = offset;
+                        offset = sum;
+                        sum += count;
+                    }
+                    for (auto const& e : entries) {
+                        buffer[offsets[(e.key >> shift) & digit_mask]++] = e;
+                    }
+                    entries.swap(buffer);
+                }
+            }
+
+            template<typename It, typename Proj>
+            std::vector<radix_entry> sorted_entries(It first, It last, Proj& proj) {
+                using E = projected_flags_t<It, Proj>;
+                std::vector<radix_entry> entries;
+                entries.reserve(static_cast<std::size_t>(std::distance(first, last)));
+                std::size_t index = 0;
+                for (It it = first; it != last; ++it, ++index) {
+                    entries.push_back({ radix_key(static_cast<E>(std::invoke(proj, *it))), index });
+                }
+                radix_sort_entries(entries, domain_bits_v<E>);
+                return entries;
+            }
+
+            // moves the elements into the order given by `entries`
+            template<typename It>
+            void apply_order(It first, std::vector<radix_entry> const& entries) {
+                using value_type = typename std::iterator_traits<It>::value_type;
+                std::vector<value_type> buffer;
+                buffer.reserve(entries.size());
+                for (auto const& e : entries) {
+                    buffer.push_back(std::move(first[static_cast<std::ptrdiff_t>(e.index)]));
+                }
+                std::move(buffer.begin(), buffer.end(), first);
+            }
+
+        } // namespace impl
+
+
+        // stable sort of [first, last) by the flags `proj(element)` (ordered as total_order)
+        // bits outside the domain of the flags are ignored
+        template<typename RandomIt, typename Proj = impl::identity_projection>
+        void radix_sort_by_flags(RandomIt first, RandomIt last, Proj proj = {}) {
+            static_assert(is_flags<impl::projected_flags_t<RandomIt, Proj>>::value,
+                "boost::flags::radix_sort_by_flags requires a projection to an enabled enum type.");
+            auto const entries = impl::sorted_entries(first, last, proj);
+            impl::apply_order(first, entries);
+        }
+
+        template<typename Range, typename Proj = impl::identity_projection>
+        auto radix_sort_by_flags(Range& range, Proj proj = {}) -> decltype(std::begin(range), void()) {
+            radix_sort_by_flags(std::begin(range), std::end(range), std::move(proj));
+        }
+
+
+        // stable sort of [first, last) by the flags `proj(element)` and returns the groups of equal flags
+        // (in ascending order)
+        template<typename RandomIt, typename Proj = impl::identity_projection>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            std::vector<flags_group<impl::projected_flags_t<RandomIt, Proj>, RandomIt>>
+            group_by_flags(RandomIt first, RandomIt last, Proj proj = {}) {
+            using E = impl::projected_flags_t<RandomIt, Proj>;
+            static_assert(is_flags<E>::value, "boost::flags::group_by_flags requires a projection to an enabled enum type.");
+
+            auto const entries = impl::sorted_entries(first, last, proj);
+            impl::apply_order(first, entries);
+
+            std::vector<flags_group<E, RandomIt>> groups;
+            for (std::size_t i = 0; i < entries.size();) {
+                std::size_t j = i + 1;
+                while (j < entries.size() && entries[j].key == entries[i].key) {
+                    ++j;
+                }
+                RandomIt const group_first = first + static_cast<std::ptrdiff_t>(i);
+                groups.push_back({ static_cast<E>(std::invoke(proj, *group_first)), group_first, first + static_cast<std::ptrdiff_t>(j) });
+                i = j;
+            }
+            return groups;
+        }
+
+        template<typename Range, typename Proj = impl::identity_projection>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto group_by_flags(Range& range, Proj proj = {})
+            -> decltype(group_by_flags(std::begin(range), std::end(range), std::move(proj))) {
+            return group_by_flags(std::begin(range), std::end(range), std::move(proj));
+        }
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_SORT_HPP_INCLUDED
@@ -0,0 +1,236 @@
+#ifndef BOOST_FLAGS_TAGGED_PTR_HPP_INCLUDED
+#define BOOST_FLAGS_TAGGED_PTR_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// pointer with a flags tag stored in its unused low bits
+//
+// a T* aligned to `Align` (default: alignof(T)) has log2(Align) zero low bits, they hold the tag
+// if the domain of E (cf. <boost/flags/domain.hpp>) fits into them, which is checked statically.
+// T may be incomplete when tagged_ptr<T, E> is named (e.g. for the links of node structures),
+// the check takes place when the members are used.
+//
+// atomic_tagged_ptr modifies the pointer and the tag with single (lock-free) atomic operations
+
+#include <boost/flags/domain.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+    namespace flags {
+
+        template<typename T, typename E, std::size_t Align = 0>
+        class tagged_ptr {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::tagged_ptr requires an enabled enum type.");
+
+        public:
+            using element_type = T;
+            using pointer = T*;
+            using tag_type = E;
+
+            // alignment of the stored pointers, log2(alignment()) low bits are available for the tag
+            static constexpr std::size_t alignment() noexcept {
+                return Align != 0 ? Align : alignof(T);
+            }
+
+            // mask of the tag bits within the stored word
+            static constexpr std::uintptr_t tag_mask() noexcept {
+                static_assert((alignment() & (alignment() - 1)) == 0,
+                    "boost::flags::tagged_ptr: the alignment must be a power of 2.");
+                static_assert((impl::domain_helper<E>::value & ~std::uint64_t(alignment() - 1)) == 0,
+                    "boost::flags::tagged_ptr: the domain of E does not fit into the low bits of an aligned T*.");
+                return static_cast<std::uintptr_t>(impl::domain_helper<E>::value);
+            }
+
+            constexpr tagged_ptr() noexcept = default;
+
+            constexpr tagged_ptr(std::nullptr_t) noexcept {}
+
+            explicit tagged_ptr(T* ptr, E tag = E{}) noexcept
+                : bits_(from_pointer(ptr) | from_tag(tag))
+            {}
+
+            // pointer
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                T* get() const noexcept {
+                return reinterpret_cast<T*>(bits_ & ~tag_mask());
+            }
+
+            T& operator*() const noexcept { return *get(); }
+            T* operator->() const noexcept { return get(); }
+
+            // true iff the pointer is not null (independent of the tag)
+            explicit operator bool() const noexcept { return (bits_ & ~tag_mask()) != 0; }
+
+            // replaces the pointer, keeps the tag
+            void set_pointer(T* ptr) noexcept {
+                bits_ = from_pointer(ptr) | (bits_ & tag_mask());
+            }
+
+            // tag
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                E tag() const noexcept {
+                return to_tag(bits_);
+            }
+
+            // replaces the tag, keeps the pointer
+            void set_tag(E tag) noexcept {
+                bits_ = (bits_ & ~tag_mask()) | from_tag(tag);
+            }
+
+            void reset(T* ptr = nullptr, E tag = E{}) noexcept {
+                bits_ = from_pointer(ptr) | from_tag(tag);
+            }
+
+            // the compound operators modify the tag (values are restricted to the domain of E)
+            tagged_ptr& operator|=(E tag) noexcept {
+                bits_ |= from_tag(tag);
+                return *this;
+            }
+
+            tagged_ptr& operator&=(E tag) noexcept {
+                bits_ &= ~tag_mask() | from_tag(tag);
+                return *this;
+            }
+
+            tagged_ptr& operator&=(complement<E> tag) noexcept {
+                bits_ &= ~tag_mask() | (impl::to_unsigned(tag) & tag_mask());
+                return *this;
+            }
+
+            tagged_ptr& operator^=(E tag) noexcept {
+                bits_ ^= from_tag(tag);
+                return *this;
+            }
+
+            // sets / clears the bits of `modification` in the tag (cf. boost::flags::modify_inplace)
+            tagged_ptr& modify_tag(E modification, bool set) noexcept {
+                bits_ = set ? (bits_ | from_tag(modification)) : (bits_ & ~from_tag(modification));
+                return *this;
+            }
+
+            // raw access (e.g. for std::atomic or hashing)
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                std::uintptr_t to_bits() const noexcept { return bits_; }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                static tagged_ptr from_bits(std::uintptr_t bits) noexcept {
+                tagged_ptr result;
+                result.bits_ = bits;
+                return result;
+            }
+
+            friend bool operator==(tagged_ptr const& lhs, tagged_ptr const& rhs) noexcept {
+                return lhs.bits_ == rhs.bits_;
+            }
+
+            friend bool operator!=(tagged_ptr const& lhs, tagged_ptr const& rhs) noexcept {
+                return lhs.bits_ != rhs.bits_;
+            }
+
+        private:
+            using bits_type = std::uintptr_t;
+
+            static bits_type from_pointer(T* ptr) noexcept {
+                bits_type const bits = reinterpret_cast<bits_type>(ptr);
+                BOOST_FLAGS_ASSERT((bits & bits_type(alignment() - 1)) == 0);
+                return bits;
+            }
+
+            static bits_type from_tag(E tag) noexcept {
+                return static_cast<bits_type>(impl::to_unsigned(tag)) & tag_mask();
+            }
+
+            static E to_tag(bits_type bits) noexcept {
+                return impl::from_unsigned<E>(static_cast<impl::unsigned_underlying_t<E>>(bits & tag_mask()));
+            }
+
+            template<typename, typename, std::size_t>
+            friend class atomic_tagged_ptr;
+
+            bits_type bits_ = 0;
+        };
+
+
+        // a tagged_ptr with atomic operations, the tag operations are single fetch_or / fetch_and / fetch_xor
+        template<typename T, typename E, std::size_t Align = 0>
+        class atomic_tagged_ptr {
+        public:
+            using value_type = tagged_ptr<T, E, Align>;
+
+            static constexpr bool is_always_lock_free = std::atomic<std::uintptr_t>::is_always_lock_free;
+
+            atomic_tagged_ptr() noexcept = default;
+
+            explicit atomic_tagged_ptr(value_type value) noexcept
+                : bits_(value.to_bits())
+            {}
+
+            atomic_tagged_ptr(atomic_tagged_ptr const&) = delete;
+            atomic_tagged_ptr& operator=(atomic_tagged_ptr const&) = delete;
+
+            bool is_lock_free() const noexcept { return bits_.is_lock_free(); }
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                value_type load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+                return value_type::from_bits(bits_.load(order));
+            }
+
+            void store(value_type value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                bits_.store(value.to_bits(), order);
+            }
+
+            value_type exchange(value_type value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                return value_type::from_bits(bits_.exchange(value.to_bits(), order));
+            }
+
+            // pointer and tag are compared and exchanged together
+            bool compare_exchange_weak(value_type& expected, value_type desired,
+                std::memory_order success = std::memory_order_seq_cst,
+                std::memory_order failure = std::memory_order_seq_cst) noexcept {
+                return bits_.compare_exchange_weak(expected.bits_, desired.bits_, success, failure);
+            }
+
+            bool compare_exchange_strong(value_type& expected, value_type desired,
+                std::memory_order success = std::memory_order_seq_cst,
+                std::memory_order failure = std::memory_order_seq_cst) noexcept {
+                return bits_.compare_exchange_strong(expected.bits_, desired.bits_, success, failure);
+            }
+
+            // tag operations, returning the previous value (pointer and tag)
+
+            value_type fetch_or_tag(E tag, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                return value_type::from_bits(bits_.fetch_or(value_type::from_tag(tag), order));
+            }
+
+            value_type fetch_and_tag(E tag, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                return value_type::from_bits(bits_.fetch_and(~value_type::tag_mask() | value_type::from_tag(tag), order));
+            }
+
+            value_type fetch_and_tag(complement<E> tag, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                return value_type::from_bits(bits_.fetch_and(
+                    ~value_type::tag_mask() | (impl::to_unsigned(tag) & value_type::tag_mask()), order));
+            }
+
+            value_type fetch_xor_tag(E tag, std::memory_order order = std::memory_order_seq_cst) noexcept {
+                return value_type::from_bits(bits_.fetch_xor(value_type::from_tag(tag), order));
+            }
+
+        private:
+            std::atomic<std::uintptr_t> bits_{ 0 };
+        };
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_TAGGED_PTR_HPP_INCLUDED
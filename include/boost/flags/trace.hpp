@@ -0,0 +1,425 @@
+#ifndef BOOST_FLAGS_TRACE_HPP_INCLUDED
+#define BOOST_FLAGS_TRACE_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// tracing of flag changes: `traced_flags<E>` records every `=`, `|=`, `&=`, `^=` and `modify_inplace`
+// as event (timestamp, object, old value, new value, call site) in a ring buffer of the current thread
+//
+// the ring buffers are thread-local (a single writer, no locks or atomics on the fast path) and keep
+// the last BOOST_FLAGS_TRACE_CAPACITY events of their thread; at thread exit (or flush_thread) the
+// events are moved to a global list. the events are written as binary trace (write_trace), which can be
+// read (read_trace) and printed (dump_trace).
+// defining BOOST_FLAGS_TRACE as 0 removes the recording, `traced_flags<E>` then only wraps an `E`.
+//
+// trace format (all integers little-endian):
+//      "BFLT", u32 version, u32 #strings, #strings * (u16 size, chars),
+//      u32 #sites, #sites * (u32 file, u32 function, u32 line, u32 column),
+//      u64 #events, #events * (u64 timestamp, u64 object, u64 old, u64 new, u32 site, u32 thread)
+// where file and function are indices into the strings and site is an index into the sites
+
+#include <boost/flags.hpp>
+#include <boost/flags/detail/binary_io.hpp>
+
+#if !(__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L))
+#error <boost/flags/trace.hpp> requires C++20 (std::source_location)
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <source_location>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+// recording of the events, can be switched off (e.g. for release builds)
+#if !defined(BOOST_FLAGS_TRACE)
+# define BOOST_FLAGS_TRACE 1
+#endif // !defined(BOOST_FLAGS_TRACE)
+
+// number of events kept per thread, must be a power of 2
+#if !defined(BOOST_FLAGS_TRACE_CAPACITY)
+# define BOOST_FLAGS_TRACE_CAPACITY 4096
+#endif // !defined(BOOST_FLAGS_TRACE_CAPACITY)
+
+// timestamp of the events (an expression convertible to std::uint64_t), defaults to nanoseconds of steady_clock
+#if !defined(BOOST_FLAGS_TRACE_TIMESTAMP)
+# define BOOST_FLAGS_TRACE_TIMESTAMP() static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>( \
+    std::chrono::steady_clock::now().time_since_epoch()).count())
+#endif // !defined(BOOST_FLAGS_TRACE_TIMESTAMP)
+
+
+namespace boost {
+    namespace flags {
+        namespace trace {
+
+            inline constexpr bool enabled = BOOST_FLAGS_TRACE != 0;
+            inline constexpr std::size_t capacity = BOOST_FLAGS_TRACE_CAPACITY;
+
+            static_assert(capacity != 0 && (capacity & (capacity - 1)) == 0,
+                "BOOST_FLAGS_TRACE_CAPACITY must be a power of 2.");
+
+            // a recorded change, values are zero-extended to 64 bits
+            struct event_record {
+                std::uint64_t timestamp = 0;
+                std::uint64_t object = 0;   // address of the traced_flags
+                std::uint64_t old_value = 0;
+                std::uint64_t new_value = 0;
+                std::string file;
+                std::string function;
+                std::uint32_t line = 0;
+                std::uint32_t column = 0;
+                std::uint32_t thread = 0;   // numbered in order of the first event of the thread
+
+                // the bits that flipped
+                std::uint64_t changed() const noexcept { return old_value ^ new_value; }
+            };
+
+            // an argument together with the call site: the defaulted source_location of the converting
+            // constructor is evaluated where the argument is passed
+            template<typename T>
+            struct located {
+                T value;
+                std::source_location site;
+
+                constexpr located(T v, std::source_location s = std::source_location::current()) noexcept
+                    : value(v)
+                    , site(s)
+                {}
+            };
+
+            namespace impl {
+
+                // the strings of std::source_location have static storage duration, events keep the
+                // location and are only converted to event_record when they are collected
+                struct event {
+                    std::uint64_t timestamp;
+                    void const* object;
+                    std::uint64_t old_value;
+                    std::uint64_t new_value;
+                    std::source_location site;
+                };
+
+                struct thread_events {
+                    std::uint32_t thread;
+                    std::vector<event> events;
+                };
+
+                // events of finished (resp. flushed) threads
+                class registry {
+                public:
+                    static registry& instance() {
+                        static registry r;
+                        return r;
+                    }
+
+                    std::uint32_t next_thread() {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        return next_thread_++;
+                    }
+
+                    void retire(thread_events&& events) {
+                        if (!events.events.empty()) {
+                            std::lock_guard<std::mutex> lock(mutex_);
+                            retired_.push_back(std::move(events));
+                        }
+                    }
+
+                    std::vector<thread_events> retired() {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        return retired_;
+                    }
+
+                    void clear() {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        retired_.clear();
+                    }
+
+                private:
+                    std::mutex mutex_;
+                    std::uint32_t next_thread_ = 0;
+                    std::vector<thread_events> retired_;
+                };
+
+                // the ring buffer of the current thread, retired at thread exit
+                class ring {
+                public:
+                    ring()
+                        : thread_(registry::instance().next_thread())
+                        , events_(new event[capacity])
+                    {}
+
+                    ~ring() {
+                        registry::instance().retire(take());
+                    }
+
+                    BOOST_FLAGS_ATTRIBUTE_FORCEINLINE void push(event const& e) noexcept {
+                        events_[count_++ & (capacity - 1)] = e;
+                    }
+
+                    // the buffered events in order of recording, the buffer is emptied
+                    thread_events take() {
+                        thread_events result{ thread_, {} };
+                        std::uint64_t const n = std::min<std::uint64_t>(count_, capacity);
+                        result.events.reserve(static_cast<std::size_t>(n));
+                        for (std::uint64_t i = count_ - n; i != count_; ++i) {
+                            result.events.push_back(events_[i & (capacity - 1)]);
+                        }
+                        count_ = 0;
+                        return result;
+                    }
+
+                    void clear() noexcept { count_ = 0; }
+
+                private:
+                    std::uint32_t thread_;
+                    std::uint64_t count_ = 0;
+                    std::unique_ptr<event[]> events_;
+                };
+
+                inline ring& current_ring() {
+                    // the registry is constructed before, and thus destroyed after, all rings
+                    registry::instance();
+                    thread_local ring r;
+                    return r;
+                }
+
+                inline void record(void const* object, std::uint64_t old_value, std::uint64_t new_value,
+                    std::source_location const& site) noexcept {
+                    current_ring().push(event{ BOOST_FLAGS_TRACE_TIMESTAMP(), object, old_value, new_value, site });
+                }
+
+                inline constexpr char magic[4] = { 'B', 'F', 'L', 'T' };
+                inline constexpr std::uint32_t version = 1;
+
+            } // namespace impl
+
+
+            // moves the events of the current thread to the events of the finished threads
+            // (events of other running threads are not included in traces before they flush or exit)
+            inline void flush_thread() {
+                impl::registry::instance().retire(impl::current_ring().take());
+            }
+
+            // events of all finished threads and the current thread, ordered by timestamp
+            inline std::vector<event_record> snapshot() {
+                flush_thread();
+                std::vector<event_record> records;
+                for (impl::thread_events const& t : impl::registry::instance().retired()) {
+                    for (impl::event const& e : t.events) {
+                        event_record r;
+                        r.timestamp = e.timestamp;
+                        r.object = reinterpret_cast<std::uintptr_t>(e.object);
+                        r.old_value = e.old_value;
+                        r.new_value = e.new_value;
+                        r.file = e.site.file_name();
+                        r.function = e.site.function_name();
+                        r.line = e.site.line();
+                        r.column = e.site.column();
+                        r.thread = t.thread;
+                        records.push_back(std::move(r));
+                    }
+                }
+                std::stable_sort(records.begin(), records.end(), [](event_record const& a, event_record const& b) {
+                    return a.timestamp < b.timestamp;
+                });
+                return records;
+            }
+
+            // discards the events of all finished threads and the current thread
+            inline void reset() {
+                impl::current_ring().clear();
+                impl::registry::instance().clear();
+            }
+
+            inline void write_trace(std::ostream& out, std::vector<event_record> const& records) {
+                flags::impl::string_table strings;
+                std::map<std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t>, std::uint32_t> site_indices;
+                std::vector<std::tuple<std::uint32_t, std::uint32_t, std::uint32_t, std::uint32_t>> sites;
+                std::vector<std::uint32_t> event_sites;
+                for (event_record const& r : records) {
+                    auto const site = std::make_tuple(strings.index(r.file), strings.index(r.function), r.line, r.column);
+                    auto const result = site_indices.emplace(site, static_cast<std::uint32_t>(sites.size()));
+                    if (result.second) {
+                        sites.push_back(site);
+                    }
+                    event_sites.push_back(result.first->second);
+                }
+
+                flags::impl::write_header(out, impl::magic, impl::version);
+                strings.write(out);
+                flags::impl::write_u32(out, static_cast<std::uint32_t>(sites.size()));
+                for (auto const& [file, function, line, column] : sites) {
+                    flags::impl::write_u32(out, file);
+                    flags::impl::write_u32(out, function);
+                    flags::impl::write_u32(out, line);
+                    flags::impl::write_u32(out, column);
+                }
+                flags::impl::write_u64(out, records.size());
+                for (std::size_t i = 0; i < records.size(); ++i) {
+                    flags::impl::write_u64(out, records[i].timestamp);
+                    flags::impl::write_u64(out, records[i].object);
+                    flags::impl::write_u64(out, records[i].old_value);
+                    flags::impl::write_u64(out, records[i].new_value);
+                    flags::impl::write_u32(out, event_sites[i]);
+                    flags::impl::write_u32(out, records[i].thread);
+                }
+            }
+
+            // writes the events of all finished threads and the current thread
+            inline void write_trace(std::ostream& out) {
+                write_trace(out, snapshot());
+            }
+
+            inline bool write_trace(char const* path) {
+                std::ofstream out(path, std::ios::binary);
+                write_trace(out);
+                return static_cast<bool>(out);
+            }
+
+            // throws std::runtime_error for malformed traces
+            inline std::vector<event_record> read_trace(std::istream& in) {
+                constexpr char const* what = "boost::flags::trace::read_trace";
+                flags::impl::read_header(in, impl::magic, impl::version, what);
+                std::vector<std::string> const strings = flags::impl::read_string_table(in, what);
+                std::uint32_t const site_count = flags::impl::read_uint<std::uint32_t>(in, what);
+                std::vector<event_record> sites;
+                sites.reserve(flags::impl::initial_capacity(site_count));
+                for (std::uint32_t i = 0; i < site_count; ++i) {
+                    event_record s;
+                    s.file = flags::impl::string_at(strings, flags::impl::read_uint<std::uint32_t>(in, what), what);
+                    s.function = flags::impl::string_at(strings, flags::impl::read_uint<std::uint32_t>(in, what), what);
+                    s.line = flags::impl::read_uint<std::uint32_t>(in, what);
+                    s.column = flags::impl::read_uint<std::uint32_t>(in, what);
+                    sites.push_back(std::move(s));
+                }
+                std::uint64_t const n = flags::impl::read_uint<std::uint64_t>(in, what);
+                std::vector<event_record> records;
+                records.reserve(flags::impl::initial_capacity(n));
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    std::uint64_t const timestamp = flags::impl::read_uint<std::uint64_t>(in, what);
+                    std::uint64_t const object = flags::impl::read_uint<std::uint64_t>(in, what);
+                    std::uint64_t const old_value = flags::impl::read_uint<std::uint64_t>(in, what);
+                    std::uint64_t const new_value = flags::impl::read_uint<std::uint64_t>(in, what);
+                    std::uint32_t const site = flags::impl::read_uint<std::uint32_t>(in, what);
+                    if (site >= sites.size()) {
+                        throw std::runtime_error(std::string(what) + ": invalid site index");
+                    }
+                    event_record r = sites[site];
+                    r.timestamp = timestamp;
+                    r.object = object;
+                    r.old_value = old_value;
+                    r.new_value = new_value;
+                    r.thread = flags::impl::read_uint<std::uint32_t>(in, what);
+                    records.push_back(std::move(r));
+                }
+                return records;
+            }
+
+            // prints one line per event
+            inline void dump_trace(std::ostream& out, std::vector<event_record> const& records) {
+                out << "           timestamp  thread            object                 old                 new  site\n";
+                for (event_record const& r : records) {
+                    char line[128];
+                    std::snprintf(line, sizeof(line), "%20llu  %6u  %16llx  %18llx  %18llx  ",
+                        static_cast<unsigned long long>(r.timestamp), static_cast<unsigned>(r.thread),
+                        static_cast<unsigned long long>(r.object),
+                        static_cast<unsigned long long>(r.old_value), static_cast<unsigned long long>(r.new_value));
+                    out << line << r.file << ':' << r.line << ':' << r.column << "  " << r.function << '\n';
+                }
+            }
+
+        } // namespace trace
+
+
+// traced_flags : a value of an enabled enumeration whose changes are recorded (cf. boost::flags::trace)
+        template<typename E>
+        class traced_flags {
+            static_assert(std::is_enum<E>::value && is_flags<E>::value,
+                "boost::flags::traced_flags requires an enabled enum type.");
+
+        public:
+            using value_type = E;
+
+            constexpr traced_flags() noexcept = default;
+            constexpr explicit traced_flags(E value) noexcept
+                : value_(value)
+            {}
+
+            BOOST_FLAGS_ATTRIBUTE_NODISCARD
+                constexpr E value() const noexcept { return value_; }
+            constexpr operator E() const noexcept { return value_; }
+
+            friend constexpr bool operator==(traced_flags const& lhs, E rhs) noexcept {
+                return lhs.value_ == rhs;
+            }
+
+            // copies are not recorded, assignments of values are
+            constexpr traced_flags& operator=(trace::located<E> rhs) noexcept {
+                return assign(rhs.value, rhs.site);
+            }
+
+            constexpr traced_flags& operator|=(trace::located<E> rhs) noexcept {
+                return assign(value_ | rhs.value, rhs.site);
+            }
+
+            constexpr traced_flags& operator&=(trace::located<E> rhs) noexcept {
+                return assign(value_ & rhs.value, rhs.site);
+            }
+
+            // `t &= ~e`
+            constexpr traced_flags& operator&=(trace::located<complement<E>> rhs) noexcept {
+                return assign(value_ & rhs.value, rhs.site);
+            }
+
+            constexpr traced_flags& operator^=(trace::located<E> rhs) noexcept {
+                return assign(value_ ^ rhs.value, rhs.site);
+            }
+
+            // sets / clears the bits of `modification` (cf. boost::flags::modify_inplace)
+            constexpr traced_flags& modify_inplace(E modification, bool set,
+                std::source_location site = std::source_location::current()) noexcept {
+                return assign(boost::flags::modify(value_, modification, set), site);
+            }
+
+        private:
+            constexpr traced_flags& assign(E value, [[maybe_unused]] std::source_location const& site) noexcept {
+#if BOOST_FLAGS_TRACE
+                if (!std::is_constant_evaluated()) {
+                    trace::impl::record(this,
+                        static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<std::underlying_type_t<E>>>(value_)),
+                        static_cast<std::uint64_t>(static_cast<std::make_unsigned_t<std::underlying_type_t<E>>>(value)),
+                        site);
+                }
+#endif // BOOST_FLAGS_TRACE
+                value_ = value;
+                return *this;
+            }
+
+            E value_{};
+        };
+
+        template<typename E>
+        constexpr traced_flags<E>& modify_inplace(traced_flags<E>& value, E modification, bool set,
+            std::source_location site = std::source_location::current()) noexcept {
+            return value.modify_inplace(modification, set, site);
+        }
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_TRACE_HPP_INCLUDED
@@ -0,0 +1,173 @@
+#ifndef BOOST_FLAGS_VALIDATE_HPP_INCLUDED
+#define BOOST_FLAGS_VALIDATE_HPP_INCLUDED
+
+//  Copyright 2024, 2025 Tobias Loew
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt
+
+// bulk validation of values against the domain (e.g. for values read from files or the network):
+// the counterpart of options::check_assert / check_trap (validate) and options::check_mask (sanitize)
+
+#include <boost/flags/domain.hpp>
+#include <boost/flags/reduce.hpp>
+
+#include <cstring>
+#include <type_traits>
+
+namespace boost {
+    namespace flags {
+        namespace impl {
+
+            template<typename E>
+            inline std::size_t sanitize_scalar(E* values, std::size_t n) noexcept {
+                using U = unsigned_underlying_t<E>;
+                constexpr U mask = domain_helper<enum_type_t<E>>::value;
+                std::size_t changed = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    U const v = to_unsigned(values[i]);
+                    changed += (v & ~mask) != 0;
+                    values[i] = from_unsigned<E>(static_cast<U>(v & mask));
+                }
+                return changed;
+            }
+
+            // high bit of every lane of size L in a 64-bit word
+            template<std::size_t L>
+            constexpr std::uint64_t lane_high_bits() noexcept {
+                std::uint64_t result = 0;
+                for (std::size_t i = 0; i < 8 / L; ++i) {
+                    result |= std::uint64_t(0x80) << (i * 8 * L + 8 * (L - 1));
+                }
+                return result;
+            }
+
+            // the values are masked as wide words, the changed values are the lanes in which the masking
+            // cleared a bit: ((x & low) + low) | x has the high bit of a lane set iff the lane is non-zero
+            template<typename E>
+            inline std::size_t sanitize_simd(E* values, std::size_t n) noexcept {
+                using U = unsigned_underlying_t<E>;
+                constexpr U mask = domain_helper<enum_type_t<E>>::value;
+                constexpr std::uint64_t high = lane_high_bits<sizeof(E)>();
+                constexpr std::uint64_t low = ~high;
+                std::uint64_t wide_mask = 0;
+                for (std::size_t i = 0; i < 8 / sizeof(E); ++i) {
+                    wide_mask |= static_cast<std::uint64_t>(mask) << (i * 8 * sizeof(E));
+                }
+
+                std::size_t changed = 0;
+                std::size_t i = 0;
+
+#if BOOST_FLAGS_HAS_AVX2
+                constexpr std::size_t lanes = 32 / sizeof(E);
+                __m256i const m = _mm256_set1_epi64x(static_cast<long long>(wide_mask));
+                __m256i const h = _mm256_set1_epi64x(static_cast<long long>(high));
+                __m256i const l = _mm256_set1_epi64x(static_cast<long long>(low));
+                for (; i + lanes <= n; i += lanes) {
+                    __m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i));
+                    __m256i const masked = _mm256_and_si256(v, m);
+                    __m256i const cleared = _mm256_andnot_si256(m, v);
+                    __m256i const nonzero = _mm256_and_si256(h,
+                        _mm256_or_si256(_mm256_add_epi64(_mm256_and_si256(cleared, l), l), cleared));
+                    changed += static_cast<std::size_t>(popcount(static_cast<std::uint32_t>(_mm256_movemask_epi8(nonzero))));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), masked);
+                }
+#else // BOOST_FLAGS_HAS_AVX2
+                // 64-bit SWAR
+                constexpr std::size_t lanes = 8 / sizeof(E);
+                for (; i + lanes <= n; i += lanes) {
+                    std::uint64_t w;
+                    std::memcpy(&w, values + i, sizeof(w));
+                    std::uint64_t const cleared = w & ~wide_mask;
+                    changed += static_cast<std::size_t>(popcount((((cleared & low) + low) | cleared) & high));
+                    w &= wide_mask;
+                    std::memcpy(values + i, &w, sizeof(w));
+                }
+#endif // BOOST_FLAGS_HAS_AVX2
+
+                return changed + sanitize_scalar(values + i, n - i);
+            }
+
+            template<typename E>
+            inline std::size_t sanitize_dispatch(execution::scalar_t, E* values, std::size_t n) {
+                return sanitize_scalar(values, n);
+            }
+
+            template<typename E>
+            inline std::size_t sanitize_dispatch(execution::simd_t, E* values, std::size_t n) {
+                return sanitize_simd(values, n);
+            }
+
+            template<typename Executor, typename E>
+            inline std::size_t sanitize_dispatch(execution::parallel_t<Executor> const& policy, E* values, std::size_t n) {
+                std::vector<std::size_t> partials(parallel_tasks(policy, n), 0);
+                parallel_chunks(policy, n, [&](std::size_t task, std::size_t first, std::size_t last) {
+                    partials[task] = sanitize_simd(values + first, last - first);
+                });
+                std::size_t changed = 0;
+                for (std::size_t c : partials) {
+                    changed += c;
+                }
+                return changed;
+            }
+
+        } // namespace impl
+
+
+// validate : true iff all values only contain bits of the domain (cf. <boost/flags/domain.hpp>)
+        template<typename Policy, typename E>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            bool validate(Policy const& policy, E const* values, std::size_t n) {
+            static_assert(is_flags<E>::value, "boost::flags::validate requires an enabled enum type.");
+            // a single pass without early exit: the bitwise or of all values is checked
+            return (impl::reduce_dispatch(policy, values, n, impl::or_op{}) &
+                ~impl::domain_helper<enum_type_t<E>>::value) == 0;
+        }
+
+// sanitize : clears all bits outside of the domain, returns the number of changed values
+        template<typename Policy, typename E>
+        std::size_t sanitize(Policy const& policy, E* values, std::size_t n) {
+            static_assert(is_flags<E>::value, "boost::flags::sanitize requires an enabled enum type.");
+            return impl::sanitize_dispatch(policy, values, n);
+        }
+
+
+        namespace impl {
+
+            // `T` for contiguous ranges of enabled enums
+            template<typename Range, typename T>
+            using flags_range_t = typename std::enable_if<is_flags<range_value_t<Range>>::value, T>::type;
+
+        } // namespace impl
+
+
+        // overloads for contiguous ranges and without policy (uses execution::simd)
+
+        template<typename Policy, typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto validate(Policy const& policy, Range const& values) -> impl::flags_range_t<Range, bool> {
+            return validate(policy, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Range>
+        BOOST_FLAGS_ATTRIBUTE_NODISCARD
+            auto validate(Range const& values) -> impl::flags_range_t<Range, bool> {
+            return validate(execution::simd, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Policy, typename Range>
+        auto sanitize(Policy const& policy, Range&& values) -> impl::flags_range_t<Range, std::size_t> {
+            return sanitize(policy, impl::range_data(values), impl::range_size(values));
+        }
+
+        template<typename Range>
+        auto sanitize(Range&& values) -> impl::flags_range_t<Range, std::size_t> {
+            return sanitize(execution::simd, impl::range_data(values), impl::range_size(values));
+        }
+
+    } // namespace flags
+} // namespace boost
+
+#endif  // BOOST_FLAGS_VALIDATE_HPP_INCLUDED
@@ -0,0 +1,39 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// module interface unit of Boost.Flags (requires C++20)
+//
+//   #include <boost/flags/macros.hpp>   // BOOST_FLAGS_ENABLE, BOOST_FLAGS, BOOST_FLAGS_AND, ...
+//   import boost.flags;
+//
+// the declarations of <boost/flags.hpp> are exported within `extern "C++"`, so they stay attached to the
+// global module: translation units including <boost/flags.hpp> and translation units importing boost.flags
+// can be mixed in one program.
+// a single translation unit should either include <boost/flags.hpp> or import boost.flags, not both.
+// enums enabled inside a named module must be exported together with their enabling macro
+// (`export { BOOST_FLAGS(E) }` or within an `export namespace`), otherwise `boost_flags_enable` is not found.
+// configuration macros (e.g. BOOST_FLAGS_HAS_CONCEPTS) must be the same for building
+// the module and for all its importers.
+
+module;
+
+// the standard library headers and the macros have to be in the global module fragment,
+// their include guards keep them out of the module purview
+#include <boost/flags/macros.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#if BOOST_FLAGS_HAS_PARTIAL_ORDERING
+#include <compare>
+#endif
+
+export module boost.flags;
+
+export extern "C++" {
+#include <boost/flags.hpp>
+}
@@ -0,0 +1,75 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// paired functions for the assembly equivalence test (cf. compare_asm.cmake) of options::assume_domain:
+// every function `flags_<name>` masks or range-checks a value with assumed domain, its counterpart
+// `raw_<name>` is the same operation without the masking / range check.
+// for optimized builds both must compile to the same instruction sequence, i.e. the masking and the
+// range checks are removed.
+//
+// the file is only compiled to an object file, the functions are `extern "C"` to get plain symbol names
+
+#include <boost/flags.hpp>
+
+#include <cstdint>
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+    flags_enum : std::uint32_t {
+    bit_0 = boost::flags::nth_bit(0),
+    bit_1 = boost::flags::nth_bit(1),
+    bit_2 = boost::flags::nth_bit(2),
+    bit_3 = boost::flags::nth_bit(3),
+};
+
+BOOST_FLAGS(flags_enum, BOOST_FLAGS_ASSUME_DOMAIN)
+
+constexpr flags_enum boost_flags_domain(flags_enum) {
+    return flags_enum::bit_0 | flags_enum::bit_1 | flags_enum::bit_2 | flags_enum::bit_3;
+}
+
+using raw = std::uint32_t;
+
+// table indexed by the values of flags_enum
+extern "C" int const lookup_table[16];
+
+
+extern "C" {
+
+    // masking with the domain
+
+    raw flags_mask(flags_enum a) { return boost::flags::get_underlying(a) & 0xfu; }
+    raw raw_mask(raw a) { return a; }
+
+    raw flags_from_underlying_mask(raw a) { return boost::flags::get_underlying(boost::flags::from_underlying<flags_enum>(a)) & 0xfu; }
+    raw raw_from_underlying_mask(raw a) { return a; }
+
+    raw flags_high_bits(flags_enum a) { return boost::flags::get_underlying(a) >> 4; }
+    raw raw_high_bits(raw) { return 0; }
+
+    // range checks
+
+    bool flags_in_range(flags_enum a) { return boost::flags::get_underlying(a) < 16u; }
+    bool raw_in_range(raw) { return true; }
+
+    int flags_lookup(flags_enum a) {
+        raw const i = boost::flags::get_underlying(a);
+        return i < 16u ? lookup_table[i] : -1;
+    }
+    int raw_lookup(raw i) { return lookup_table[i]; }
+
+    int flags_lookup_or(flags_enum a, flags_enum b) {
+        raw const i = boost::flags::get_underlying(a | b);
+        return i < 16u ? lookup_table[i] : -1;
+    }
+    int raw_lookup_or(raw a, raw b) { return lookup_table[a | b]; }
+
+} // extern "C"
@@ -0,0 +1,149 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// paired functions for the assembly equivalence test (cf. compare_asm.cmake):
+// every function `flags_<name>` uses Boost.Flags, its counterpart `raw_<name>` performs the same
+// operation with built-in operators on the underlying integers.
+// for optimized builds both must compile to the same instruction sequence.
+//
+// the file is only compiled to an object file, the functions are `extern "C"` to get plain symbol names
+
+#include <boost/flags.hpp>
+
+#include <cstdint>
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+    flags_enum : std::uint32_t {
+    bit_0 = boost::flags::nth_bit(0),
+    bit_1 = boost::flags::nth_bit(1),
+    bit_2 = boost::flags::nth_bit(2),
+    bit_3 = boost::flags::nth_bit(3),
+};
+
+BOOST_FLAGS_ENABLE_LOGICAL_AND_PRE_INCREMENT(flags_enum)
+
+using raw = std::uint32_t;
+using flags_complement = boost::flags::complement<flags_enum>;
+
+// built-in equivalents of modify and modify_inplace: the scheduling of their (independent) instructions
+// depends on whether the conditional expression is inlined from a function or written at the call site,
+// so the reference is written as function as well
+inline raw raw_modify_impl(raw a, raw b, bool set) { return set ? (a | b) : (a & ~b); }
+inline raw& raw_modify_inplace_impl(raw& a, raw b, bool set) { return (a = set ? (a | b) : (a & ~b)), a; }
+
+
+extern "C" {
+
+    // binary operators
+
+    flags_enum flags_or(flags_enum a, flags_enum b) { return a | b; }
+    raw raw_or(raw a, raw b) { return a | b; }
+
+    flags_enum flags_and(flags_enum a, flags_enum b) { return a & b; }
+    raw raw_and(raw a, raw b) { return a & b; }
+
+    flags_enum flags_xor(flags_enum a, flags_enum b) { return a ^ b; }
+    raw raw_xor(raw a, raw b) { return a ^ b; }
+
+    flags_enum flags_and_not(flags_enum a, flags_enum b) { return a & ~b; }
+    raw raw_and_not(raw a, raw b) { return a & ~b; }
+
+    flags_complement flags_or_not(flags_enum a, flags_enum b) { return a | ~b; }
+    raw raw_or_not(raw a, raw b) { return a | ~b; }
+
+    // complement
+
+    flags_complement flags_complement_of(flags_enum a) { return ~a; }
+    raw raw_complement_of(raw a) { return ~a; }
+
+    flags_enum flags_double_complement(flags_enum a) { return ~~a; }
+    raw raw_double_complement(raw a) { return ~~a; }
+
+    // compound assignment
+
+    void flags_or_assign(flags_enum& a, flags_enum b) { a |= b; }
+    void raw_or_assign(raw& a, raw b) { a |= b; }
+
+    void flags_and_assign(flags_enum& a, flags_enum b) { a &= b; }
+    void raw_and_assign(raw& a, raw b) { a &= b; }
+
+    void flags_xor_assign(flags_enum& a, flags_enum b) { a ^= b; }
+    void raw_xor_assign(raw& a, raw b) { a ^= b; }
+
+    void flags_and_not_assign(flags_enum& a, flags_enum b) { a &= ~b; }
+    void raw_and_not_assign(raw& a, raw b) { a &= ~b; }
+
+    // tests
+
+    bool flags_logical_not(flags_enum a) { return !a; }
+    bool raw_logical_not(raw a) { return !a; }
+
+    bool flags_equal(flags_enum a, flags_enum b) { return a == b; }
+    bool raw_equal(raw a, raw b) { return a == b; }
+
+    bool flags_not_equal(flags_enum a, flags_enum b) { return a != b; }
+    bool raw_not_equal(raw a, raw b) { return a != b; }
+
+    bool flags_equal_null(flags_enum a) { return a == BOOST_FLAGS_NULL; }
+    bool raw_equal_null(raw a) { return a == 0; }
+
+    bool flags_pseudo_and(flags_enum a, flags_enum b) { return a BOOST_FLAGS_AND b; }
+    bool raw_pseudo_and(raw a, raw b) { return (a & b) != 0; }
+
+    bool flags_logical_and(flags_enum a, flags_enum b) { return a && b; }
+    bool raw_logical_and(raw a, raw b) { return (a & b) != 0; }
+
+    bool flags_pre_increment(flags_enum a, flags_enum b) { return static_cast<bool>(++a & b); }
+    bool raw_pre_increment(raw a, raw b) { return (a & b) != 0; }
+
+    // utilities
+
+    bool flags_any(flags_enum a) { return boost::flags::any(a); }
+    bool raw_any(raw a) { return a != 0; }
+
+    bool flags_none(flags_enum a) { return boost::flags::none(a); }
+    bool raw_none(raw a) { return a == 0; }
+
+    bool flags_intersect(flags_enum a, flags_enum b) { return boost::flags::intersect(a, b); }
+    bool raw_intersect(raw a, raw b) { return (a & b) != 0; }
+
+    bool flags_disjoint(flags_enum a, flags_enum b) { return boost::flags::disjoint(a, b); }
+    bool raw_disjoint(raw a, raw b) { return (a & b) == 0; }
+
+    bool flags_subseteq(flags_enum a, flags_enum b) { return boost::flags::subseteq(a, b); }
+    bool raw_subseteq(raw a, raw b) { return (a & b) == a; }
+
+    bool flags_subset(flags_enum a, flags_enum b) { return boost::flags::subset(a, b); }
+    bool raw_subset(raw a, raw b) { return (a & b) == a && a != b; }
+
+    flags_enum flags_make_if(flags_enum a, bool set) { return boost::flags::make_if(a, set); }
+    raw raw_make_if(raw a, bool set) { return set ? a : 0; }
+
+    flags_enum flags_add_if(flags_enum a, flags_enum b, bool set) { return boost::flags::add_if(a, b, set); }
+    raw raw_add_if(raw a, raw b, bool set) { return set ? (a | b) : a; }
+
+    flags_enum flags_remove_if(flags_enum a, flags_enum b, bool set) { return boost::flags::remove_if(a, b, set); }
+    raw raw_remove_if(raw a, raw b, bool set) { return set ? (a & ~b) : a; }
+
+    flags_enum flags_modify(flags_enum a, flags_enum b, bool set) { return boost::flags::modify(a, b, set); }
+    raw raw_modify(raw a, raw b, bool set) { return raw_modify_impl(a, b, set); }
+
+    void flags_modify_inplace(flags_enum& a, flags_enum b, bool set) { boost::flags::modify_inplace(a, b, set); }
+    void raw_modify_inplace(raw& a, raw b, bool set) { raw_modify_inplace_impl(a, b, set); }
+
+    raw flags_get_underlying(flags_enum a) { return boost::flags::get_underlying(a); }
+    raw raw_get_underlying(raw a) { return a; }
+
+    flags_enum flags_from_underlying(raw a) { return boost::flags::from_underlying<flags_enum>(a); }
+    raw raw_from_underlying(raw a) { return a; }
+
+} // extern "C"
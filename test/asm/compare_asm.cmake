@@ -0,0 +1,127 @@
+# Boost.Flags assembly equivalence test
+#
+# Copyright 2024, 2025 Tobias Loew
+#
+# Distributed under the Boost Software License, Version 1.0.
+# See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt
+#
+# Compiles SOURCE with COMPILER at -O2 (scoped and unscoped), disassembles the object with OBJDUMP
+# and compares the instruction sequence of every function `flags_<name>` with the one of `raw_<name>`.
+#
+# usage: cmake -DCOMPILER=<c++ compiler> -DOBJDUMP=<objdump> -DSOURCE=<file> -DINCLUDE_DIR=<dir>
+#              -DWORK_DIR=<dir> [-DSTANDARD=<c++ standard>] -P compare_asm.cmake
+
+cmake_minimum_required(VERSION 3.5...3.16)
+
+foreach(var COMPILER OBJDUMP SOURCE INCLUDE_DIR WORK_DIR)
+    if (NOT DEFINED ${var})
+        message(FATAL_ERROR "compare_asm.cmake: ${var} not defined")
+    endif()
+endforeach()
+if (NOT STANDARD)
+    set(STANDARD 17)
+endif()
+
+file(MAKE_DIRECTORY ${WORK_DIR})
+
+# reads the disassembly of `object` into the variables asm_<function> and
+# appends the names of all functions to `functions`
+function(disassemble object)
+    execute_process(COMMAND ${OBJDUMP} -d --no-show-raw-insn ${object}
+        OUTPUT_VARIABLE listing
+        RESULT_VARIABLE result)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${OBJDUMP} failed for ${object}")
+    endif()
+
+    string(REPLACE ";" "\\;" listing "${listing}")
+    string(REPLACE "\n" ";" lines "${listing}")
+
+    set(names)
+    set(current)
+    foreach(line IN LISTS lines)
+        if (line MATCHES "^[0-9a-f]+ <([A-Za-z0-9_]+)>:$")
+            set(current ${CMAKE_MATCH_1})
+            list(APPEND names ${current})
+            set(asm_${current})
+        elseif (current AND line MATCHES "^ *[0-9a-f]+:[ \t]+(.*)$")
+            set(insn "${CMAKE_MATCH_1}")
+            # jump targets: keep only the offset within the function
+            string(REGEX REPLACE "[0-9a-f]+ <[A-Za-z0-9_]+(\\+0x[0-9a-f]+)?>" "<\\1>" insn "${insn}")
+            string(REGEX REPLACE "[ \t]+" " " insn "${insn}")
+            string(STRIP "${insn}" insn)
+            list(APPEND asm_${current} "${insn}")
+        elseif (line STREQUAL "")
+            set(current)
+        endif()
+    endforeach()
+
+    foreach(name IN LISTS names)
+        # remove the alignment padding at the end of the function
+        set(code ${asm_${name}})
+        list(LENGTH code n)
+        while (n GREATER 0)
+            math(EXPR last "${n} - 1")
+            list(GET code ${last} insn)
+            if (insn MATCHES "nop|^xchg %ax,%ax$|^int3$|^\\(bad\\)$")
+                list(REMOVE_AT code ${last})
+                set(n ${last})
+            else()
+                break()
+            endif()
+        endwhile()
+        set(asm_${name} "${code}" PARENT_SCOPE)
+    endforeach()
+    set(functions ${names} PARENT_SCOPE)
+endfunction()
+
+set(failures 0)
+set(compared 0)
+
+get_filename_component(source_name ${SOURCE} NAME_WE)
+
+foreach(variant scoped unscoped)
+    set(object ${WORK_DIR}/${source_name}_${variant}.o)
+    set(defines)
+    if (variant STREQUAL "unscoped")
+        set(defines -DTEST_COMPILE_UNSCOPED)
+    endif()
+
+    execute_process(COMMAND ${COMPILER} -std=c++${STANDARD} -O2 -fno-asynchronous-unwind-tables
+            ${defines} -I${INCLUDE_DIR} -c ${SOURCE} -o ${object}
+        RESULT_VARIABLE result
+        ERROR_VARIABLE errors)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "compiling ${SOURCE} with ${COMPILER} failed:\n${errors}")
+    endif()
+
+    disassemble(${object})
+
+    foreach(name IN LISTS functions)
+        if (name MATCHES "^flags_(.+)$")
+            set(raw_name raw_${CMAKE_MATCH_1})
+            if (NOT raw_name IN_LIST functions)
+                message(SEND_ERROR "${variant}: missing counterpart ${raw_name} of ${name}")
+                math(EXPR failures "${failures} + 1")
+            elseif (NOT "${asm_${name}}" STREQUAL "${asm_${raw_name}}")
+                string(REPLACE ";" "\n    " flags_code "${asm_${name}}")
+                string(REPLACE ";" "\n    " raw_code "${asm_${raw_name}}")
+                message(SEND_ERROR "${variant}: ${name} and ${raw_name} differ\n"
+                    "  ${name}:\n    ${flags_code}\n"
+                    "  ${raw_name}:\n    ${raw_code}\n")
+                math(EXPR failures "${failures} + 1")
+            else()
+                math(EXPR compared "${compared} + 1")
+            endif()
+        endif()
+    endforeach()
+endforeach()
+
+if (compared EQUAL 0 AND failures EQUAL 0)
+    message(FATAL_ERROR "no functions found in the disassembly of ${SOURCE}")
+endif()
+if (failures GREATER 0)
+    message(FATAL_ERROR "${failures} function(s) differ from their built-in counterparts")
+endif()
+message(STATUS "${compared} function pairs compiled to identical code (${COMPILER})")
@@ -0,0 +1,30 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// exits with 0 iff the build machine supports the instruction sets enabled by the compiler options,
+// gates the SIMD variants of the tests (cf. CMakeLists.txt and Jamfile.v2)
+
+int main() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    bool supported = true;
+# if defined(__AVX2__)
+    supported = supported && __builtin_cpu_supports("avx2");
+# endif
+# if defined(__BMI2__)
+    supported = supported && __builtin_cpu_supports("bmi2");
+# endif
+# if defined(__AVX512F__)
+    supported = supported && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+        && __builtin_cpu_supports("avx512vl");
+# endif
+    return supported ? 0 : 1;
+#else
+    return 1;
+#endif
+}
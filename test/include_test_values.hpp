@@ -0,0 +1,44 @@
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+
+// reproducible pseudo-random values (64-bit LCG) for the tests of the bulk algorithms and containers
+
+template<typename E>
+class random_values {
+public:
+    using U = typename std::underlying_type<E>::type;
+
+    explicit random_values(std::uint64_t seed = 12345)
+        : state_(seed)
+    {}
+
+    // the next value restricted to the bits of `mask`
+    E operator()(std::uint64_t mask = ~std::uint64_t(0)) {
+        state_ = state_ * 6364136223846793005ull + 1442695040888963407ull;
+        // the low bits of the state have short periods, they are mixed with the high bits
+        return static_cast<E>(static_cast<U>((state_ ^ (state_ >> 29)) & mask));
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+template<typename E>
+std::vector<E> make_values(std::size_t n, std::uint64_t seed = 12345, std::uint64_t mask = ~std::uint64_t(0)) {
+    random_values<E> random(seed);
+    std::vector<E> values(n);
+    for (E& v : values) {
+        v = random(mask);
+    }
+    return values;
+}
@@ -0,0 +1,79 @@
+# Boost.Flags module test
+#
+# Copyright 2024, 2025 Tobias Loew
+#
+# Distributed under the Boost Software License, Version 1.0.
+# See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt
+#
+# Builds the module boost.flags (MODULE_SOURCE), the test module test_module_enums.cppm and the importing
+# test_module.cpp with COMPILER (gcc: -fmodules-ts, clang: prebuilt module files), links and runs the
+# test, once for scoped and once for unscoped enums.
+#
+# usage: cmake -DCOMPILER=<c++ compiler> -DCOMPILER_ID=<GNU|Clang> -DMODULE_SOURCE=<boost_flags.cppm>
+#              -DTEST_DIR=<dir of test_module.cpp> -DINCLUDE_DIR=<dir> -DWORK_DIR=<dir>
+#              [-DBOOST_INCLUDE_DIR=<dir>] [-DSTANDARD=<c++ standard>] -P build_module_test.cmake
+
+cmake_minimum_required(VERSION 3.5...3.16)
+
+foreach(var COMPILER COMPILER_ID MODULE_SOURCE TEST_DIR INCLUDE_DIR WORK_DIR)
+    if (NOT DEFINED ${var})
+        message(FATAL_ERROR "build_module_test.cmake: ${var} not defined")
+    endif()
+endforeach()
+if (NOT STANDARD OR STANDARD LESS 20)
+    set(STANDARD 20)
+endif()
+
+set(includes -I${INCLUDE_DIR})
+if (BOOST_INCLUDE_DIR)
+    list(APPEND includes -I${BOOST_INCLUDE_DIR})
+endif()
+
+# runs the compiler in `dir`, aborts on errors
+function(compile dir)
+    execute_process(COMMAND ${COMPILER} -std=c++${STANDARD} ${ARGN}
+        WORKING_DIRECTORY ${dir}
+        RESULT_VARIABLE result
+        ERROR_VARIABLE errors)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${COMPILER} ${ARGN} failed:\n${errors}")
+    endif()
+endfunction()
+
+foreach(variant scoped unscoped)
+    set(dir ${WORK_DIR}/${variant})
+    file(REMOVE_RECURSE ${dir})
+    file(MAKE_DIRECTORY ${dir})
+    set(defines)
+    if (variant STREQUAL "unscoped")
+        set(defines -DTEST_COMPILE_UNSCOPED)
+    endif()
+
+    if (COMPILER_ID STREQUAL "GNU")
+        # the compiled module interfaces are written to / read from <dir>/gcm.cache
+        set(flags -fmodules-ts ${defines} ${includes})
+        compile(${dir} ${flags} -x c++ -c ${MODULE_SOURCE} -o boost_flags.o)
+        compile(${dir} ${flags} -x c++ -c ${TEST_DIR}/test_module_enums.cppm -o test_module_enums.o)
+        compile(${dir} ${flags} -c ${TEST_DIR}/test_module.cpp -o test_module.o)
+    elseif (COMPILER_ID MATCHES "Clang")
+        set(flags -fprebuilt-module-path=${dir} ${defines} ${includes})
+        compile(${dir} ${flags} -x c++-module --precompile ${MODULE_SOURCE} -o boost.flags.pcm)
+        compile(${dir} ${flags} -c boost.flags.pcm -o boost_flags.o)
+        compile(${dir} ${flags} -x c++-module --precompile ${TEST_DIR}/test_module_enums.cppm -o boost_flags_test_enums.pcm)
+        compile(${dir} ${flags} -c boost_flags_test_enums.pcm -o test_module_enums.o)
+        compile(${dir} ${flags} -c ${TEST_DIR}/test_module.cpp -o test_module.o)
+    else()
+        message(FATAL_ERROR "build_module_test.cmake: unsupported compiler ${COMPILER_ID}")
+    endif()
+    compile(${dir} test_module.o test_module_enums.o boost_flags.o -o test_module)
+
+    execute_process(COMMAND ${dir}/test_module
+        RESULT_VARIABLE result
+        OUTPUT_VARIABLE output
+        ERROR_VARIABLE output)
+    if (NOT result EQUAL 0)
+        message(FATAL_ERROR "${variant}: test_module failed:\n${output}")
+    endif()
+    message(STATUS "${variant}: ${output}")
+endforeach()
@@ -0,0 +1,113 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// Boost.Flags as module: ADL-based enabling and operator lookup across module boundaries
+// (built by build_module_test.cmake)
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/macros.hpp>
+
+import boost.flags;
+import boost_flags_test_enums;
+
+
+// enabled in the importing translation unit
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+    local_enum : unsigned int {
+    x = boost::flags::nth_bit(0), // == 0x01
+    y = boost::flags::nth_bit(1), // == 0x02
+    z = boost::flags::nth_bit(2), // == 0x04
+};
+
+BOOST_FLAGS_ENABLE(local_enum)
+
+namespace local_ns {
+    struct s {
+        enum
+#ifndef TEST_COMPILE_UNSCOPED
+            class
+#endif // TEST_COMPILE_UNSCOPED
+            flags_enum : unsigned char {
+            a = boost::flags::nth_bit(0), // == 0x01
+            b = boost::flags::nth_bit(1), // == 0x02
+        };
+        BOOST_FLAGS_ENABLE_LOCAL(flags_enum)
+    };
+}
+
+
+// lookup from a template in an unrelated namespace (cf. test_adl.cpp)
+namespace another_ns {
+    template<typename T1, typename T2>
+    constexpr auto apply_binary_and_operator(T1 t1, T2 t2) -> decltype(t1 & t2) {
+        return t1 & t2;
+    }
+}
+
+
+void test_traits() {
+    BOOST_TEST_TRAIT_TRUE((boost::flags::is_flags<local_enum>));
+    BOOST_TEST_TRAIT_TRUE((boost::flags::is_flags<local_ns::s::flags_enum>));
+    BOOST_TEST_TRAIT_TRUE((boost::flags::is_flags<module_ns::flags_enum>));
+    BOOST_TEST_TRAIT_TRUE((boost::flags::is_flags<module_ns::widget::state>));
+    BOOST_TEST_TRAIT_TRUE((boost::flags::is_complement<boost::flags::complement<module_ns::flags_enum>>));
+    BOOST_TEST_TRAIT_FALSE((boost::flags::is_flags<int>));
+}
+
+
+void test_local() {
+    local_enum e = local_enum::x | local_enum::y;
+    BOOST_TEST(boost::flags::get_underlying(e) == 3u);
+    BOOST_TEST((e & ~local_enum::x) == local_enum::y);
+    BOOST_TEST(e BOOST_FLAGS_AND local_enum::y);
+    BOOST_TEST(!(e & local_enum::z));
+    BOOST_TEST(e != BOOST_FLAGS_NULL);
+
+    e ^= local_enum::z;
+    BOOST_TEST(boost::flags::get_underlying(e) == 7u);
+
+    local_ns::s::flags_enum f = local_ns::s::flags_enum::a | local_ns::s::flags_enum::b;
+    f &= ~local_ns::s::flags_enum::a;
+    BOOST_TEST(f == local_ns::s::flags_enum::b);
+    BOOST_TEST(another_ns::apply_binary_and_operator(f, local_ns::s::flags_enum::b) == local_ns::s::flags_enum::b);
+}
+
+
+void test_imported() {
+    using module_ns::flags_enum;
+    using module_ns::widget;
+
+    constexpr flags_enum d = module_ns::default_flags();
+    static_assert(boost::flags::get_underlying(d) == 5u, "");
+
+    flags_enum e = d | flags_enum::bit_1;
+    BOOST_TEST(boost::flags::get_underlying(e) == 7u);
+    BOOST_TEST(e && flags_enum::bit_2);
+    BOOST_TEST(!(e && flags_enum::bit_3));
+    BOOST_TEST(boost::flags::subseteq(d, e));
+    BOOST_TEST(boost::flags::total_order(flags_enum::bit_0, flags_enum::bit_1));
+    BOOST_TEST(another_ns::apply_binary_and_operator(e, ~flags_enum::bit_0) == (flags_enum::bit_1 | flags_enum::bit_2));
+
+    widget::state s = widget::state::visible | widget::state::focused;
+    BOOST_TEST(module_ns::clear_focus(s) == widget::state::visible);
+    s |= widget::state::enabled;
+    BOOST_TEST(boost::flags::get_underlying(s) == 7u);
+    BOOST_TEST(boost::flags::make_if(widget::state::focused, false) == BOOST_FLAGS_NULL);
+}
+
+
+int main() {
+    test_traits();
+    test_local();
+    test_imported();
+
+    return boost::report_errors();
+}
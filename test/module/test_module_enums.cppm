@@ -0,0 +1,61 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// module for test_module.cpp: enables enums inside a named module, which are then used
+// by the importing translation unit (cf. build_module_test.cmake)
+
+module;
+
+#include <boost/flags/macros.hpp>
+
+export module boost_flags_test_enums;
+
+import boost.flags;
+
+export namespace module_ns {
+
+    // enabled at namespace scope: `boost_flags_enable` and the operator using-declarations are exported
+    enum
+#ifndef TEST_COMPILE_UNSCOPED
+        class
+#endif // TEST_COMPILE_UNSCOPED
+        flags_enum : unsigned int {
+        bit_0 = boost::flags::nth_bit(0), // == 0x01
+        bit_1 = boost::flags::nth_bit(1), // == 0x02
+        bit_2 = boost::flags::nth_bit(2), // == 0x04
+        bit_3 = boost::flags::nth_bit(3), // == 0x08
+    };
+
+    BOOST_FLAGS(flags_enum, BOOST_FLAGS_LOGICAL_AND)
+
+
+    // enabled at class scope: hidden friends are found by ADL from the importer
+    struct widget {
+        enum
+#ifndef TEST_COMPILE_UNSCOPED
+            class
+#endif // TEST_COMPILE_UNSCOPED
+            state : unsigned char {
+            visible = boost::flags::nth_bit(0), // == 0x01
+            focused = boost::flags::nth_bit(1), // == 0x02
+            enabled = boost::flags::nth_bit(2), // == 0x04
+        };
+
+        BOOST_FLAGS_LOCAL(state)
+    };
+
+
+    // operators used inside the module
+    constexpr flags_enum default_flags() noexcept {
+        return flags_enum::bit_0 | flags_enum::bit_2;
+    }
+
+    constexpr widget::state clear_focus(widget::state s) noexcept {
+        return s & ~widget::state::focused;
+    }
+}
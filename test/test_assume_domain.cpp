@@ -0,0 +1,137 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_assume_domain
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags.hpp>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+};
+
+// enable flags_enum with assumed domain
+BOOST_FLAGS(flags_enum, BOOST_FLAGS_ASSUME_DOMAIN)
+
+constexpr flags_enum boost_flags_domain(flags_enum) {
+    return flags_enum::bit_0 | flags_enum::bit_1 | flags_enum::bit_2;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+no_complement_enum : unsigned char {
+    nc_0 = boost::flags::nth_bit(0), // == 0x01
+    nc_1 = boost::flags::nth_bit(1), // == 0x02
+};
+
+// enable no_complement_enum with assumed domain and disabled complement
+BOOST_FLAGS_ENABLE_EX(no_complement_enum, boost::flags::options::enable |
+    boost::flags::options::disable_complement | boost::flags::options::assume_domain)
+
+constexpr no_complement_enum boost_flags_domain(no_complement_enum) {
+    return no_complement_enum::nc_0 | no_complement_enum::nc_1;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+plain_enum : unsigned char {
+    plain_0 = boost::flags::nth_bit(0), // == 0x01
+    plain_1 = boost::flags::nth_bit(1), // == 0x02
+};
+
+// enable plain_enum with disabled complement, but without assumed domain
+BOOST_FLAGS_ENABLE_DISABLE_COMPLEMENT(plain_enum)
+
+constexpr plain_enum boost_flags_domain(plain_enum) {
+    return plain_enum::plain_0 | plain_enum::plain_1;
+}
+
+
+void test_options() {
+    BOOST_TEST(boost::flags::has_option_assume_domain(boost::flags::options::assume_domain));
+    BOOST_TEST(!boost::flags::has_option_assume_domain(boost::flags::options::enable));
+    BOOST_TEST(!boost::flags::has_option_assume_domain(true));
+
+    BOOST_TEST_TRAIT_TRUE((std::is_base_of<boost::flags::assume_domain, boost::flags::enable<flags_enum>>));
+    BOOST_TEST_TRAIT_TRUE((std::is_base_of<boost::flags::assume_domain, boost::flags::enable<no_complement_enum>>));
+    BOOST_TEST_TRAIT_FALSE((std::is_base_of<boost::flags::assume_domain, boost::flags::enable<plain_enum>>));
+    BOOST_TEST_TRAIT_TRUE((std::is_base_of<boost::flags::disable_complement, boost::flags::enable<no_complement_enum>>));
+}
+
+
+void test_values() {
+    // values within the domain are unchanged
+    for (unsigned int i = 0; i < 8; ++i) {
+        flags_enum e = boost::flags::from_underlying<flags_enum>(i);
+        BOOST_TEST_EQ(boost::flags::get_underlying(e), i);
+    }
+
+    flags_enum e = flags_enum::bit_0 | flags_enum::bit_2;
+    BOOST_TEST_EQ(boost::flags::get_underlying(e), 5u);
+    BOOST_TEST_EQ(boost::flags::get_underlying(e & ~flags_enum::bit_0), 4u);
+
+    // complement values are not assumed to be within the domain
+    BOOST_TEST_EQ(boost::flags::get_underlying(~flags_enum::bit_0), ~1u);
+    BOOST_TEST(boost::flags::from_underlying<boost::flags::complement<flags_enum>>(~1u) == ~flags_enum::bit_0);
+
+    // table lookup
+    int const table[8] = { 0, 1, 1, 2, 1, 2, 2, 3 };
+    BOOST_TEST_EQ(table[boost::flags::get_underlying(e)], 2);
+}
+
+
+void test_disabled_complement() {
+    // operator~ keeps the result within the domain
+    no_complement_enum n = ~no_complement_enum::nc_0;
+    BOOST_TEST(n == no_complement_enum::nc_1);
+    BOOST_TEST_EQ(boost::flags::get_underlying(n), 2u);
+    BOOST_TEST_EQ(boost::flags::get_underlying(~no_complement_enum{}), 3u);
+    BOOST_TEST(~~no_complement_enum::nc_1 == no_complement_enum::nc_1);
+
+    // without assume_domain all bits of the underlying type are complemented
+    BOOST_TEST_EQ(boost::flags::get_underlying(~plain_enum::plain_0), 0xfeu);
+}
+
+
+void test_constexpr() {
+    constexpr flags_enum e = boost::flags::from_underlying<flags_enum>(3u);
+    static_assert(boost::flags::get_underlying(e) == 3u, "");
+    static_assert(boost::flags::get_underlying(~no_complement_enum::nc_0) == 2u, "");
+
+#ifdef TEST_COMPILE_FAIL_ASSUME_DOMAIN
+    // value outside of the domain: not a constant expression
+    constexpr flags_enum outside = boost::flags::from_underlying<flags_enum>(8u);
+    BOOST_TEST(outside == outside);
+#endif // TEST_COMPILE_FAIL_ASSUME_DOMAIN
+}
+
+
+int main() {
+    test_options();
+    test_values();
+    test_disabled_complement();
+    test_constexpr();
+
+    return boost::report_errors();
+}
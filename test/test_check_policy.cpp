@@ -0,0 +1,228 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_check_policy
+#include "include_test.hpp"
+
+// record failed checks instead of terminating
+namespace {
+    int failed_asserts = 0;
+    int traps = 0;
+
+    void record_assert(bool cond) {
+        if (!cond) {
+            ++failed_asserts;
+        }
+    }
+}
+
+#define BOOST_FLAGS_ENABLE_CHECKS 1
+#define BOOST_FLAGS_ASSERT(cond) record_assert(cond)
+#define BOOST_FLAGS_TRAP() void(++traps)
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags.hpp>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+assert_enum : unsigned int {
+    a_0 = boost::flags::nth_bit(0), // == 0x01
+    a_1 = boost::flags::nth_bit(1), // == 0x02
+};
+
+BOOST_FLAGS(assert_enum, BOOST_FLAGS_CHECK_ASSERT)
+
+constexpr assert_enum boost_flags_domain(assert_enum) {
+    return assert_enum::a_0 | assert_enum::a_1;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+mask_enum : unsigned char {
+    m_0 = boost::flags::nth_bit(0), // == 0x01
+    m_1 = boost::flags::nth_bit(1), // == 0x02
+    m_2 = boost::flags::nth_bit(2), // == 0x04
+};
+
+BOOST_FLAGS(mask_enum, BOOST_FLAGS_CHECK_MASK)
+
+constexpr mask_enum boost_flags_domain(mask_enum) {
+    return mask_enum::m_0 | mask_enum::m_1 | mask_enum::m_2;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+trap_enum : unsigned int {
+    t_0 = boost::flags::nth_bit(0), // == 0x01
+    t_1 = boost::flags::nth_bit(1), // == 0x02
+};
+
+// enable trap_enum with disabled complement and trapping
+BOOST_FLAGS_ENABLE_EX(trap_enum, boost::flags::options::enable |
+    boost::flags::options::disable_complement | boost::flags::options::check_trap)
+
+constexpr trap_enum boost_flags_domain(trap_enum) {
+    return trap_enum::t_0 | trap_enum::t_1;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+unchecked_enum : unsigned int {
+    u_0 = boost::flags::nth_bit(0), // == 0x01
+};
+
+BOOST_FLAGS(unchecked_enum)
+
+constexpr unchecked_enum boost_flags_domain(unchecked_enum) {
+    return unchecked_enum::u_0;
+}
+
+
+#ifdef TEST_COMPILE_FAIL_CHECK_POLICY
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+conflicting_enum : unsigned int {
+    c_0 = boost::flags::nth_bit(0), // == 0x01
+};
+
+// more than one check policy
+BOOST_FLAGS(conflicting_enum, BOOST_FLAGS_CHECK_MASK, BOOST_FLAGS_CHECK_TRAP)
+#endif // TEST_COMPILE_FAIL_CHECK_POLICY
+
+
+void test_options() {
+    BOOST_TEST(boost::flags::has_option_check_assert(boost::flags::options::check_assert));
+    BOOST_TEST(boost::flags::has_option_check_mask(boost::flags::options::check_mask));
+    BOOST_TEST(boost::flags::has_option_check_trap(boost::flags::options::check_trap));
+    BOOST_TEST(!boost::flags::has_option_check_trap(boost::flags::options::enable));
+    BOOST_TEST(!boost::flags::has_option_check_mask(true));
+
+    BOOST_TEST_TRAIT_TRUE((std::is_base_of<boost::flags::check_assert, boost::flags::enable<assert_enum>>));
+    BOOST_TEST_TRAIT_TRUE((std::is_base_of<boost::flags::check_mask, boost::flags::enable<mask_enum>>));
+    BOOST_TEST_TRAIT_TRUE((std::is_base_of<boost::flags::check_trap, boost::flags::enable<trap_enum>>));
+    BOOST_TEST_TRAIT_TRUE((std::is_base_of<boost::flags::disable_complement, boost::flags::enable<trap_enum>>));
+    BOOST_TEST_TRAIT_FALSE((std::is_base_of<boost::flags::check_mask, boost::flags::enable<unchecked_enum>>));
+
+#ifdef TEST_COMPILE_FAIL_CHECK_POLICY
+    BOOST_TEST(boost::flags::from_underlying<conflicting_enum>(1u) == conflicting_enum::c_0);
+#endif // TEST_COMPILE_FAIL_CHECK_POLICY
+}
+
+
+void test_assert() {
+    failed_asserts = 0;
+
+    assert_enum e = boost::flags::from_underlying<assert_enum>(3u);
+    e = e & ~assert_enum::a_0;
+    e |= assert_enum::a_0;
+    e ^= assert_enum::a_1;
+    BOOST_TEST(e == assert_enum::a_0);
+    BOOST_TEST_EQ(failed_asserts, 0);
+
+    assert_enum stray = boost::flags::from_underlying<assert_enum>(4u);
+    BOOST_TEST_EQ(failed_asserts, 1);
+
+    // the values are unchanged
+    BOOST_TEST_EQ(boost::flags::get_underlying(stray | assert_enum::a_0), 5u);
+    BOOST_TEST_EQ(failed_asserts, 2);
+
+    // the result of operator& is within the domain
+    BOOST_TEST(!(stray & assert_enum::a_0));
+    BOOST_TEST_EQ(failed_asserts, 2);
+
+    // complements are not checked
+    BOOST_TEST_EQ(boost::flags::get_underlying(~assert_enum::a_0), ~1u);
+    BOOST_TEST_EQ(failed_asserts, 2);
+}
+
+
+void test_mask() {
+    mask_enum e = boost::flags::from_underlying<mask_enum>(0xffu);
+    BOOST_TEST_EQ(boost::flags::get_underlying(e), 7u);
+
+    // complement<mask_enum> contains bits outside of the domain, the results of the operators don't
+    BOOST_TEST_EQ(boost::flags::get_underlying(~mask_enum::m_0), 0xfeu);
+    BOOST_TEST_EQ(boost::flags::get_underlying(e & ~mask_enum::m_0), 6u);
+    BOOST_TEST_EQ(boost::flags::get_underlying(e ^ static_cast<mask_enum>(0x81)), 6u);
+    BOOST_TEST_EQ(boost::flags::get_underlying(mask_enum::m_0 | static_cast<mask_enum>(0x10)), 1u);
+
+    e = mask_enum::m_1;
+    e |= static_cast<mask_enum>(0x20);
+    BOOST_TEST(e == mask_enum::m_1);
+
+    // complements can still be created from arbitrary values
+    BOOST_TEST(boost::flags::from_underlying<boost::flags::complement<mask_enum>>(0xfeu) == ~mask_enum::m_0);
+}
+
+
+void test_trap() {
+    traps = 0;
+
+    trap_enum e = trap_enum::t_0 | trap_enum::t_1;
+    BOOST_TEST_EQ(traps, 0);
+
+    // operator~ stays within the domain for enumerations with disabled complement
+    BOOST_TEST(~trap_enum::t_0 == trap_enum::t_1);
+    BOOST_TEST((e & ~trap_enum::t_0) == trap_enum::t_1);
+    BOOST_TEST((~trap_enum::t_0 | trap_enum::t_0) == (trap_enum::t_0 | trap_enum::t_1));
+    BOOST_TEST_EQ(traps, 0);
+
+    trap_enum stray = boost::flags::from_underlying<trap_enum>(8u);
+    BOOST_TEST_EQ(traps, 1);
+
+    e ^= stray;
+    BOOST_TEST_EQ(traps, 2);
+    BOOST_TEST_EQ(boost::flags::get_underlying(e), 11u);
+}
+
+
+void test_unchecked() {
+    unchecked_enum e = boost::flags::from_underlying<unchecked_enum>(6u);
+    BOOST_TEST_EQ(boost::flags::get_underlying(e | unchecked_enum::u_0), 7u);
+    BOOST_TEST_EQ(failed_asserts + traps, 4);
+}
+
+
+void test_constexpr() {
+    // constant expressions are not checked
+    constexpr mask_enum e = boost::flags::from_underlying<mask_enum>(0x13u);
+    static_assert(boost::flags::get_underlying(e) == 0x13u, "");
+
+    constexpr trap_enum t = boost::flags::from_underlying<trap_enum>(4u) | trap_enum::t_0;
+    static_assert(boost::flags::get_underlying(t) == 5u, "");
+
+    BOOST_TEST_EQ(traps, 2);
+}
+
+
+int main() {
+    test_options();
+    test_assert();
+    test_mask();
+    test_trap();
+    test_unchecked();
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,199 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_column
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/column.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "include_test_post.hpp"
+#include "include_test_values.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_5 = boost::flags::nth_bit(5), // == 0x20
+};
+
+// enable flags_enum
+BOOST_FLAGS(flags_enum)
+
+constexpr flags_enum boost_flags_domain(flags_enum) {
+    return flags_enum::bit_0 | flags_enum::bit_1 | flags_enum::bit_5;
+}
+
+
+// another type with the same name in column files
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+renamed_enum : unsigned int {
+    renamed_0 = boost::flags::nth_bit(0), // == 0x01
+    renamed_1 = boost::flags::nth_bit(1), // == 0x02
+    renamed_5 = boost::flags::nth_bit(5), // == 0x20
+};
+
+// enable renamed_enum
+BOOST_FLAGS(renamed_enum)
+
+constexpr renamed_enum boost_flags_domain(renamed_enum) {
+    return renamed_enum::renamed_0 | renamed_enum::renamed_1 | renamed_enum::renamed_5;
+}
+
+constexpr char const* boost_flags_column_name(renamed_enum) {
+    return "test_column::renamed";
+}
+
+
+// the same name, but a different domain
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+extended_enum : unsigned int {
+    extended_0 = boost::flags::nth_bit(0), // == 0x01
+    extended_1 = boost::flags::nth_bit(1), // == 0x02
+    extended_2 = boost::flags::nth_bit(2), // == 0x04
+};
+
+// enable extended_enum
+BOOST_FLAGS(extended_enum)
+
+constexpr extended_enum boost_flags_domain(extended_enum) {
+    return extended_enum::extended_0 | extended_enum::extended_1 | extended_enum::extended_2;
+}
+
+constexpr char const* boost_flags_column_name(extended_enum) {
+    return "test_column::renamed";
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+byte_enum : unsigned char {
+    byte_0 = boost::flags::nth_bit(0), // == 0x01
+    byte_7 = boost::flags::nth_bit(7), // == 0x80
+};
+
+// enable byte_enum
+BOOST_FLAGS_ENABLE(byte_enum)
+
+
+// column files of the scoped and unscoped variants of the test may be written concurrently
+#ifndef TEST_COMPILE_UNSCOPED
+std::string const prefix = "test_column_";
+#else // TEST_COMPILE_UNSCOPED
+std::string const prefix = "test_column_unscoped_";
+#endif // TEST_COMPILE_UNSCOPED
+
+
+void test_mapping() {
+    std::string const path = prefix + "flags.bfcl";
+    std::vector<flags_enum> const values = make_values<flags_enum>(10000);
+    BOOST_TEST(boost::flags::write_column(path.c_str(), values));
+
+    boost::flags::mapped_flags_column<flags_enum> column(path);
+    BOOST_TEST_EQ(column.size(), values.size());
+    BOOST_TEST(!column.empty());
+    BOOST_TEST(std::equal(column.begin(), column.end(), values.begin(), values.end()));
+    BOOST_TEST(column[1234] == values[1234]);
+    BOOST_TEST(column.at(9999) == values[9999]);
+    BOOST_TEST_THROWS((void)column.at(10000), std::out_of_range);
+    BOOST_TEST_EQ(reinterpret_cast<std::uintptr_t>(column.data()) % alignof(flags_enum), 0u);
+#if defined(__cpp_lib_span)
+    BOOST_TEST_EQ(column.span().size(), values.size());
+#endif // defined(__cpp_lib_span)
+
+    // moving transfers the mapping
+    boost::flags::mapped_flags_column<flags_enum> moved(std::move(column));
+    BOOST_TEST(column.empty());
+    BOOST_TEST_EQ(moved.size(), values.size());
+    column = std::move(moved);
+    BOOST_TEST(column[0] == values[0]);
+
+    // empty columns
+    std::string const empty_path = prefix + "empty.bfcl";
+    BOOST_TEST(boost::flags::write_column(empty_path.c_str(), std::vector<flags_enum>()));
+    boost::flags::mapped_flags_column<flags_enum> empty(empty_path);
+    BOOST_TEST(empty.empty());
+    BOOST_TEST(empty.begin() == empty.end());
+
+    // written to a stream
+    std::string const stream_path = prefix + "stream.bfcl";
+    {
+        std::ofstream out(stream_path, std::ios::binary);
+        boost::flags::write_column(out, values.data(), 10);
+    }
+    boost::flags::mapped_flags_column<flags_enum> const prefix_column(stream_path);
+    BOOST_TEST(std::equal(prefix_column.begin(), prefix_column.end(), values.begin(), values.begin() + 10));
+
+    std::remove(path.c_str());
+    std::remove(empty_path.c_str());
+    std::remove(stream_path.c_str());
+}
+
+
+void test_schema() {
+    std::string const path = prefix + "renamed.bfcl";
+    std::vector<renamed_enum> const values(100, renamed_enum::renamed_1);
+    BOOST_TEST(boost::flags::write_column(path.c_str(), values));
+
+    // the name hook identifies the type
+    BOOST_TEST_EQ(boost::flags::mapped_flags_column<renamed_enum>(path).size(), 100u);
+
+    BOOST_TEST_THROWS(boost::flags::mapped_flags_column<flags_enum>{ path }, std::runtime_error);
+    BOOST_TEST_THROWS(boost::flags::mapped_flags_column<extended_enum>{ path }, std::runtime_error);
+    BOOST_TEST_THROWS(boost::flags::mapped_flags_column<byte_enum>{ path }, std::runtime_error);
+    BOOST_TEST_THROWS(boost::flags::mapped_flags_column<flags_enum>{ prefix + "missing.bfcl" }, std::runtime_error);
+
+    try {
+        boost::flags::mapped_flags_column<extended_enum> column(path);
+        BOOST_ERROR("domain mismatch not detected");
+    }
+    catch (std::runtime_error const& e) {
+        BOOST_TEST(std::string(e.what()).find("domain mismatch") != std::string::npos);
+    }
+
+    // truncated and malformed files
+    std::string const bad_path = prefix + "bad.bfcl";
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::string const bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream(bad_path, std::ios::binary) << bytes.substr(0, bytes.size() - 2);
+    }
+    BOOST_TEST_THROWS(boost::flags::mapped_flags_column<renamed_enum>{ bad_path }, std::runtime_error);
+    std::ofstream(bad_path, std::ios::binary) << "not a column file";
+    BOOST_TEST_THROWS(boost::flags::mapped_flags_column<renamed_enum>{ bad_path }, std::runtime_error);
+
+    std::remove(path.c_str());
+    std::remove(bad_path.c_str());
+}
+
+
+int main() {
+    test_mapping();
+    test_schema();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,171 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_combination
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/combination.hpp>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+byte_enum : unsigned char {
+    byte_0 = boost::flags::nth_bit(0), // == 0x01
+    byte_7 = boost::flags::nth_bit(7), // == 0x80
+};
+
+// enable byte_enum
+BOOST_FLAGS_ENABLE(byte_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+sparse_enum : unsigned int {
+    sparse_1 = boost::flags::nth_bit(1),
+    sparse_4 = boost::flags::nth_bit(4),
+    sparse_9 = boost::flags::nth_bit(9),
+    sparse_20 = boost::flags::nth_bit(20),
+};
+
+// enable sparse_enum
+BOOST_FLAGS_ENABLE(sparse_enum)
+
+// restrict the domain to the four enumerators
+constexpr sparse_enum boost_flags_domain(sparse_enum) {
+    return sparse_enum::sparse_1 | sparse_enum::sparse_4 | sparse_enum::sparse_9 | sparse_enum::sparse_20;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+wide_enum : unsigned int {
+    wide_0 = boost::flags::nth_bit(0), // == 0x01
+};
+
+// enable wide_enum
+BOOST_FLAGS_ENABLE(wide_enum)
+
+
+static_assert(boost::flags::domain_bits_v<byte_enum> == 8, "");
+static_assert(boost::flags::domain_bits_v<sparse_enum> == 4, "");
+static_assert(boost::flags::domain_bits_v<wide_enum> == 32, "");
+static_assert(boost::flags::combination_counter<byte_enum>::is_exact, "");
+static_assert(boost::flags::combination_counter<sparse_enum>::is_exact, "");
+static_assert(!boost::flags::combination_counter<wide_enum>::is_exact, "");
+
+
+void test_direct() {
+    boost::flags::combination_counter<byte_enum> counter;
+    std::map<unsigned, std::uint64_t> expected;
+    std::vector<byte_enum> values;
+    for (unsigned i = 0; i < 5000; ++i) {
+        unsigned const v = (i * i) % 37;
+        values.push_back(static_cast<byte_enum>(v));
+        ++expected[v];
+    }
+    counter.add(values);
+    counter.add(byte_enum::byte_7, 3);
+    expected[0x80] += 3;
+    BOOST_TEST_EQ(counter.size(), 5003u);
+
+    for (auto const& e : expected) {
+        auto const c = counter.estimate(static_cast<byte_enum>(e.first));
+        BOOST_TEST_EQ(c.count, e.second);
+        BOOST_TEST_EQ(c.error, 0u);
+    }
+
+    auto const top = counter.top_k(3);
+    BOOST_TEST_EQ(top.size(), 3u);
+    for (std::size_t i = 0; i < top.size(); ++i) {
+        BOOST_TEST_EQ(top[i].count, expected[static_cast<unsigned>(top[i].value)]);
+        if (i > 0) {
+            BOOST_TEST_GE(top[i - 1].count, top[i].count);
+        }
+    }
+    // all combinations
+    BOOST_TEST_EQ(counter.top_k(1000).size(), expected.size());
+
+    counter.clear();
+    BOOST_TEST_EQ(counter.size(), 0u);
+    BOOST_TEST(counter.top_k(10).empty());
+}
+
+
+void test_sparse_domain() {
+    boost::flags::combination_counter<sparse_enum> counter;
+    counter.add(sparse_enum::sparse_20 | sparse_enum::sparse_1, 10);
+    counter.add(sparse_enum::sparse_9, 5);
+    counter.add(sparse_enum{}, 1);
+
+    auto const top = counter.top_k(5);
+    BOOST_TEST_EQ(top.size(), 3u);
+    if (top.size() == 3) {
+        BOOST_TEST(top[0].value == (sparse_enum::sparse_20 | sparse_enum::sparse_1));
+        BOOST_TEST_EQ(top[0].count, 10u);
+        BOOST_TEST(top[1].value == sparse_enum::sparse_9);
+        BOOST_TEST(top[2].value == sparse_enum{});
+    }
+}
+
+
+void test_sketch() {
+    // a few heavy combinations and many rare ones
+    auto make_stream = [](std::uint32_t seed, std::vector<wide_enum>& values, std::map<unsigned, std::uint64_t>& expected) {
+        for (unsigned i = 0; i < 50000; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            unsigned const v = (i % 4 == 0) ? 0x100u * (1 + i % 5) : seed;
+            values.push_back(static_cast<wide_enum>(v));
+            ++expected[v];
+        }
+    };
+
+    std::map<unsigned, std::uint64_t> expected;
+    std::vector<wide_enum> values_a, values_b;
+    make_stream(1, values_a, expected);
+    make_stream(2, values_b, expected);
+
+    boost::flags::combination_counter<wide_enum> a, b;
+    a.add(values_a);
+    b.add(values_b);
+    a.merge(b);
+    BOOST_TEST_EQ(a.size(), 100000u);
+
+    auto const top = a.top_k(5);
+    BOOST_TEST_EQ(top.size(), 5u);
+    for (auto const& c : top) {
+        std::uint64_t const exact = expected[static_cast<unsigned>(c.value)];
+        BOOST_TEST_GE(exact, 5000u);
+        BOOST_TEST_GE(c.count, exact);
+        BOOST_TEST_LE(c.count - c.error, exact);
+    }
+
+    auto const rare = a.estimate(static_cast<wide_enum>(0x12345u));
+    BOOST_TEST_LE(rare.count - rare.error, expected[0x12345u]);
+}
+
+
+int main() {
+    report_config();
+    test_direct();
+    test_sparse_domain();
+    test_sketch();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,171 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_diff
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/diff.hpp>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_5 = boost::flags::nth_bit(5), // == 0x20
+};
+
+// enable flags_enum
+BOOST_FLAGS(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+byte_enum : unsigned char {
+    byte_0 = boost::flags::nth_bit(0), // == 0x01
+    byte_7 = boost::flags::nth_bit(7), // == 0x80
+};
+
+// enable byte_enum
+BOOST_FLAGS_ENABLE(byte_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+wide_enum : std::uint64_t {
+    wide_0 = boost::flags::nth_bit(0), // == 0x01
+    wide_63 = boost::flags::nth_bit<std::uint64_t>(63),
+};
+
+// enable wide_enum
+BOOST_FLAGS_ENABLE(wide_enum)
+
+
+// the range overloads only accept contiguous ranges of the same enum type
+template<typename... Args>
+struct has_diff {
+    template<typename... Ts>
+    static auto check(int) -> decltype(void(boost::flags::diff(std::declval<Ts const&>()...)), std::true_type{});
+    template<typename...>
+    static std::false_type check(...);
+
+    static constexpr bool value = decltype(check<Args...>(0))::value;
+};
+
+static_assert(has_diff<std::vector<flags_enum>, std::vector<flags_enum>>::value, "");
+static_assert(has_diff<boost::flags::execution::simd_t, std::vector<flags_enum>, std::vector<flags_enum>>::value, "");
+static_assert(has_diff<boost::flags::execution::simd_t, flags_enum const*, flags_enum const*, std::size_t>::value, "");
+static_assert(!has_diff<flags_enum const*, flags_enum const*, std::size_t>::value, "");
+static_assert(!has_diff<std::vector<flags_enum>, std::vector<flags_enum>, std::size_t>::value, "");
+static_assert(!has_diff<std::vector<flags_enum>, std::vector<byte_enum>>::value, "");
+
+
+// random values, every `stride`-th value of the new snapshot is changed in a random bit
+template<typename E>
+void make_snapshots(std::size_t n, std::size_t stride, std::vector<E>& old_values, std::vector<E>& new_values) {
+    using U = typename std::underlying_type<E>::type;
+    old_values.resize(n);
+    new_values.resize(n);
+    std::uint64_t state = 12345;
+    for (std::size_t i = 0; i < n; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        U const u = static_cast<U>(state >> 7);
+        old_values[i] = static_cast<E>(u);
+        U const bit = static_cast<U>(U(1) << ((state >> 3) % (8 * sizeof(U))));
+        new_values[i] = static_cast<E>(stride != 0 && i % stride == 0 ? static_cast<U>(u ^ bit ^ (u & 6)) : u);
+    }
+}
+
+template<typename E>
+void check_snapshots(std::size_t n, std::size_t stride) {
+    using U = typename std::underlying_type<E>::type;
+
+    std::vector<E> old_values, new_values;
+    make_snapshots(n, stride, old_values, new_values);
+
+    boost::flags::flag_diff<E> expected;
+    for (std::size_t i = 0; i < n; ++i) {
+        U const o = static_cast<U>(old_values[i]);
+        U const v = static_cast<U>(new_values[i]);
+        if (o != v) {
+            expected.push_back({ i, static_cast<E>(static_cast<U>(v & ~o)), static_cast<E>(static_cast<U>(o & ~v)) });
+        }
+    }
+
+    // executor running the tasks inline
+    auto inline_executor = [](std::function<void()> task) { task(); };
+
+    BOOST_TEST(boost::flags::diff(old_values, new_values) == expected);
+    BOOST_TEST(boost::flags::diff(boost::flags::execution::scalar, old_values, new_values) == expected);
+    BOOST_TEST(boost::flags::diff(boost::flags::execution::parallel(3), old_values, new_values) == expected);
+    BOOST_TEST(boost::flags::diff(boost::flags::execution::parallel(inline_executor, 5),
+        old_values.data(), new_values.data(), n) == expected);
+
+    std::vector<E> v = old_values;
+    boost::flags::apply_diff(v, expected);
+    BOOST_TEST(v == new_values);
+    boost::flags::revert_diff(v, expected);
+    BOOST_TEST(v == old_values);
+
+    BOOST_TEST(boost::flags::diff(old_values, old_values).empty());
+}
+
+void test_snapshots() {
+    for (std::size_t n : { 0, 1, 5, 31, 32, 100, 257, 1000 }) {
+        for (std::size_t stride : { 0, 1, 3, 64, 999 }) {
+            check_snapshots<flags_enum>(n, stride);
+            check_snapshots<byte_enum>(n, stride);
+            check_snapshots<wide_enum>(n, stride);
+        }
+    }
+}
+
+void test_known_values() {
+    std::vector<flags_enum> old_values(100, flags_enum::bit_0);
+    std::vector<flags_enum> new_values = old_values;
+    new_values[3] = flags_enum::bit_1 | flags_enum::bit_5;
+    new_values[64] = flags_enum{};
+    new_values[99] = flags_enum::bit_0 | flags_enum::bit_1;
+
+    boost::flags::flag_diff<flags_enum> const changes = boost::flags::diff(old_values, new_values);
+    BOOST_TEST_EQ(changes.size(), 3u);
+    BOOST_TEST(changes[0] == (boost::flags::flag_change<flags_enum>{ 3, flags_enum::bit_1 | flags_enum::bit_5, flags_enum::bit_0 }));
+    BOOST_TEST(changes[1] == (boost::flags::flag_change<flags_enum>{ 64, flags_enum{}, flags_enum::bit_0 }));
+    BOOST_TEST(changes[2] == (boost::flags::flag_change<flags_enum>{ 99, flags_enum::bit_1, flags_enum{} }));
+    BOOST_TEST(changes[0] != changes[1]);
+
+    // the changes may be replayed onto another value at the same indices
+    std::vector<flags_enum> other(100, flags_enum::bit_5);
+    boost::flags::apply_diff(other, changes);
+    BOOST_TEST(other[3] == (flags_enum::bit_1 | flags_enum::bit_5));
+    BOOST_TEST(other[64] == flags_enum::bit_5);
+    BOOST_TEST(other[99] == (flags_enum::bit_1 | flags_enum::bit_5));
+}
+
+
+int main() {
+    report_config();
+    test_snapshots();
+    test_known_values();
+
+    return boost::report_errors();
+}
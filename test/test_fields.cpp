@@ -0,0 +1,210 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_fields
+#include "include_test.hpp"
+
+// record failed assertions instead of terminating (a failed assertion in a constant expression doesn't compile)
+namespace {
+    int failed_asserts = 0;
+
+    void record_failed_assert() {
+        ++failed_asserts;
+    }
+}
+
+#define BOOST_FLAGS_ENABLE_CHECKS 1
+#define BOOST_FLAGS_ASSERT(cond) ((cond) ? void(0) : record_failed_assert())
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags.hpp>
+
+#include <type_traits>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+task_flags : unsigned int {
+    ready = boost::flags::nth_bit(0), // == 0x01
+    urgent = boost::flags::nth_bit(1), // == 0x02
+
+    // 3-bit priority (bits 2-4)
+    priority_mask = 0x1c,
+    priority_1 = 0x04,
+    priority_2 = 0x08,
+    priority_3 = 0x0c,
+    priority_7 = 0x1c,
+
+    // 2-bit mode (bits 5-6)
+    mode_mask = 0x60,
+    mode_read = 0x20,
+    mode_write = 0x40,
+    mode_read_write = 0x60,
+};
+
+BOOST_FLAGS(task_flags)
+
+constexpr boost::flags::bit_fields<task_flags, task_flags::priority_mask, task_flags::mode_mask> boost_flags_fields(task_flags) {
+    return {};
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+small_flags : unsigned char {
+    s_0 = boost::flags::nth_bit(0), // == 0x01
+    level_mask = 0xf0,
+    level_15 = 0xf0,
+};
+
+BOOST_FLAGS(small_flags)
+
+constexpr boost::flags::bit_fields<small_flags, small_flags::level_mask> boost_flags_fields(small_flags) {
+    return {};
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+plain_flags : unsigned int {
+    p_0 = boost::flags::nth_bit(0), // == 0x01
+    p_1 = boost::flags::nth_bit(1), // == 0x02
+};
+
+// no fields: the operators are unchecked
+BOOST_FLAGS(plain_flags)
+
+
+#ifdef TEST_COMPILE_FAIL_FIELD_MASK
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+broken_flags : unsigned int {
+    b_0 = boost::flags::nth_bit(0), // == 0x01
+    gap_mask = 0x05, // not contiguous
+};
+
+BOOST_FLAGS(broken_flags)
+
+constexpr boost::flags::bit_fields<broken_flags, broken_flags::gap_mask> boost_flags_fields(broken_flags) {
+    return {};
+}
+
+broken_flags const broken = broken_flags::b_0 | broken_flags::b_0;
+#endif // TEST_COMPILE_FAIL_FIELD_MASK
+
+
+// get_field / set_field are constant expressions
+static_assert(boost::flags::get_field(task_flags::priority_3 | task_flags::ready, task_flags::priority_mask) == 3, "");
+static_assert(boost::flags::get_field(task_flags::mode_write | task_flags::priority_7, task_flags::mode_mask) == 2, "");
+static_assert(boost::flags::set_field(task_flags::urgent | task_flags::priority_7, task_flags::priority_mask, 2) ==
+    (task_flags::urgent | task_flags::priority_2), "");
+static_assert(std::is_same<decltype(boost::flags::get_field(small_flags::s_0, small_flags::level_mask)), unsigned char>::value, "");
+
+// non-conflicting operands
+static_assert((task_flags::priority_2 | task_flags::priority_2) == task_flags::priority_2, "");
+static_assert((task_flags::priority_2 | task_flags::mode_read | task_flags::ready) != task_flags{}, "");
+static_assert((task_flags::priority_2 ^ task_flags::priority_2) == task_flags{}, "");
+
+#ifdef TEST_COMPILE_FAIL_FIELD_CONFLICT
+// two priorities in one field
+constexpr task_flags conflict = task_flags::priority_1 | task_flags::priority_2;
+#endif // TEST_COMPILE_FAIL_FIELD_CONFLICT
+
+
+void test_get_set() {
+    task_flags v = task_flags::ready | task_flags::priority_3 | task_flags::mode_read;
+    BOOST_TEST_EQ(boost::flags::get_field(v, task_flags::priority_mask), 3u);
+    BOOST_TEST_EQ(boost::flags::get_field(v, task_flags::mode_mask), 1u);
+
+    for (unsigned int p = 0; p < 8; ++p) {
+        task_flags const w = boost::flags::set_field(v, task_flags::priority_mask, p);
+        BOOST_TEST_EQ(boost::flags::get_field(w, task_flags::priority_mask), p);
+        // the other bits are unchanged
+        BOOST_TEST((w & ~task_flags::priority_mask) == (v & ~task_flags::priority_mask));
+    }
+
+    BOOST_TEST(&boost::flags::modify_field(v, task_flags::mode_mask, 3) == &v);
+    BOOST_TEST(v == (task_flags::ready | task_flags::priority_3 | task_flags::mode_read_write));
+    boost::flags::modify_field(v, task_flags::priority_mask, 0);
+    BOOST_TEST(v == (task_flags::ready | task_flags::mode_read_write));
+
+    small_flags s = small_flags::s_0;
+    boost::flags::modify_field(s, small_flags::level_mask, 15);
+    BOOST_TEST(s == (small_flags::s_0 | small_flags::level_15));
+    BOOST_TEST_EQ(boost::flags::get_field(s, small_flags::level_mask), 15u);
+
+    BOOST_TEST_EQ(failed_asserts, 0);
+
+    // the value doesn't fit into the field
+    failed_asserts = 0;
+    task_flags const too_large = boost::flags::set_field(task_flags::ready, task_flags::mode_mask, 4);
+    BOOST_TEST_EQ(failed_asserts, 1);
+    BOOST_TEST(too_large == task_flags::ready);
+
+    // the mask isn't contiguous
+    failed_asserts = 0;
+    (void)boost::flags::get_field(v, task_flags::ready | task_flags::priority_2);
+    BOOST_TEST_EQ(failed_asserts, 1);
+    failed_asserts = 0;
+}
+
+
+void test_conflicts() {
+    failed_asserts = 0;
+
+    // flags and different fields combine freely
+    task_flags v = task_flags::priority_2 | task_flags::mode_write | task_flags::urgent;
+    v |= task_flags::ready;
+    v |= task_flags::priority_2;
+    v ^= task_flags::urgent;
+    v = v & ~task_flags::priority_mask;
+    v |= task_flags::priority_7;
+    BOOST_TEST(v == (task_flags::ready | task_flags::priority_7 | task_flags::mode_write));
+    BOOST_TEST_EQ(failed_asserts, 0);
+
+    // different values within a field
+    task_flags const p1 = task_flags::priority_1;
+    task_flags const p2 = task_flags::priority_2;
+    (void)(p1 | p2);
+    BOOST_TEST_EQ(failed_asserts, 1);
+    (void)(p1 ^ (p2 | task_flags::ready));
+    BOOST_TEST_EQ(failed_asserts, 2);
+
+    task_flags m = task_flags::mode_read;
+    m |= task_flags::mode_write;
+    BOOST_TEST_EQ(failed_asserts, 3);
+
+    small_flags s = small_flags::s_0 | small_flags::level_15;
+    s |= static_cast<small_flags>(0x10);
+    BOOST_TEST_EQ(failed_asserts, 4);
+
+    // enums without fields are not checked
+    plain_flags const p = plain_flags::p_0 | plain_flags::p_1;
+    BOOST_TEST(p == (plain_flags::p_0 | plain_flags::p_1));
+    BOOST_TEST_EQ(failed_asserts, 4);
+
+    failed_asserts = 0;
+}
+
+
+int main() {
+    test_get_set();
+    test_conflicts();
+
+    return boost::report_errors();
+}
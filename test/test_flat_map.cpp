@@ -0,0 +1,152 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_flat_map
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/flat_map.hpp>
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned char {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+};
+
+// enable flags_enum
+BOOST_FLAGS_ENABLE(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+domain_enum : unsigned int {
+    dom_a = boost::flags::nth_bit(0), // == 0x01
+    dom_b = boost::flags::nth_bit(1), // == 0x02
+    dom_c = boost::flags::nth_bit(2), // == 0x04
+    dom_x = 0x100, // outside the domain
+};
+
+// enable domain_enum
+BOOST_FLAGS_ENABLE(domain_enum)
+
+constexpr domain_enum boost_flags_domain(domain_enum) {
+    return domain_enum::dom_a | domain_enum::dom_b | domain_enum::dom_c;
+}
+
+
+void test_map() {
+    std::map<flags_enum, int, boost::flags::total_order_t> expected;
+    boost::flags::flat_flag_map<flags_enum, int> map;
+
+    unsigned state = 1;
+    for (int round = 0; round < 4; ++round) {
+        std::vector<std::pair<flags_enum, int>> values;
+        for (int i = 0; i < 100; ++i) {
+            state = state * 1103515245u + 12345u;
+            values.emplace_back(static_cast<flags_enum>((state >> 16) & 0xff), round * 1000 + i);
+        }
+        if (round % 2 == 0) {
+            for (auto const& v : values) {
+                BOOST_TEST_EQ(map.insert(v).second, expected.insert(v).second);
+            }
+        } else {
+            // bulk: existing elements and first occurrences are kept
+            map.insert(values.begin(), values.end());
+            expected.insert(values.begin(), values.end());
+        }
+        BOOST_TEST_EQ(map.size(), expected.size());
+        BOOST_TEST(std::equal(map.begin(), map.end(), expected.begin(), expected.end(),
+            [](auto const& a, auto const& b) { return a.first == b.first && a.second == b.second; }));
+    }
+
+    for (unsigned k = 0; k < 256; ++k) {
+        auto const key = static_cast<flags_enum>(k);
+        auto const it = map.find(key);
+        BOOST_TEST_EQ(it != map.end(), expected.count(key) == 1);
+        if (it != map.end()) {
+            BOOST_TEST_EQ(it->second, expected[key]);
+        }
+    }
+}
+
+
+void test_access() {
+    boost::flags::flat_flag_map<flags_enum, std::string> map{
+        { flags_enum::bit_2, "two" },
+        { flags_enum::bit_0, "zero" },
+        { flags_enum::bit_2, "duplicate" },
+    };
+    BOOST_TEST_EQ(map.size(), 2u);
+    BOOST_TEST_EQ(map.at(flags_enum::bit_2), "two");
+    BOOST_TEST_THROWS((void)map.at(flags_enum::bit_1), std::out_of_range);
+
+    map[flags_enum::bit_1] = "one";
+    BOOST_TEST_EQ(map.size(), 3u);
+    BOOST_TEST_EQ(map.begin()->second, "zero");
+    BOOST_TEST_EQ((map.begin() + 1)->second, "one");
+
+    BOOST_TEST(!map.try_emplace(flags_enum::bit_1, "other").second);
+    BOOST_TEST(!map.insert_or_assign(flags_enum::bit_1, "uno").second);
+    BOOST_TEST_EQ(map.at(flags_enum::bit_1), "uno");
+
+    BOOST_TEST_EQ(map.erase(flags_enum::bit_0), 1u);
+    BOOST_TEST_EQ(map.erase(flags_enum::bit_0), 0u);
+    BOOST_TEST(map.upper_bound(flags_enum::bit_1)->first == flags_enum::bit_2);
+
+    boost::flags::flat_flag_map<flags_enum, std::string> other{ { flags_enum::bit_0 | flags_enum::bit_1, "three" } };
+    map.merge(other);
+    BOOST_TEST_EQ(map.size(), 3u);
+    BOOST_TEST_EQ(map.at(flags_enum::bit_0 | flags_enum::bit_1), "three");
+}
+
+
+// keys with bits outside the domain are ordered by all bits
+void test_outside_domain() {
+    boost::flags::flat_flag_map<domain_enum, int> map;
+    std::vector<std::pair<domain_enum, int>> const values{
+        { domain_enum::dom_x | domain_enum::dom_a, 0 },
+        { domain_enum::dom_a, 1 },
+        { domain_enum::dom_b, 2 },
+        { domain_enum::dom_x, 3 },
+        { domain_enum::dom_c, 4 },
+        { domain_enum::dom_a, 5 },
+    };
+    map.insert(values.begin(), values.end());
+    BOOST_TEST_EQ(map.size(), 5u);
+    BOOST_TEST(std::is_sorted(map.begin(), map.end(),
+        [](auto const& a, auto const& b) { return boost::flags::total_order(a.first, b.first); }));
+    BOOST_TEST_EQ(map.at(domain_enum::dom_x | domain_enum::dom_a), 0);
+    BOOST_TEST_EQ(map.at(domain_enum::dom_a), 1);
+    BOOST_TEST_EQ(map.at(domain_enum::dom_x), 3);
+    BOOST_TEST(map.find(domain_enum::dom_c) != map.end());
+    BOOST_TEST(map.find(domain_enum::dom_x | domain_enum::dom_c) == map.end());
+}
+
+
+int main() {
+    report_config();
+    test_map();
+    test_access();
+    test_outside_domain();
+
+    return boost::report_errors();
+}
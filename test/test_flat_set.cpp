@@ -0,0 +1,169 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_flat_set
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/flat_set.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "include_test_post.hpp"
+#include "include_test_values.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+};
+
+// enable flags_enum
+BOOST_FLAGS_ENABLE(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+signed_enum : int {
+    signed_0 = boost::flags::nth_bit(0), // == 0x01
+};
+
+// enable signed_enum
+BOOST_FLAGS_ENABLE(signed_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+domain_enum : unsigned int {
+    dom_a = boost::flags::nth_bit(0), // == 0x01
+    dom_b = boost::flags::nth_bit(1), // == 0x02
+    dom_c = boost::flags::nth_bit(2), // == 0x04
+    dom_x = 0x100, // outside the domain
+};
+
+// enable domain_enum
+BOOST_FLAGS_ENABLE(domain_enum)
+
+constexpr domain_enum boost_flags_domain(domain_enum) {
+    return domain_enum::dom_a | domain_enum::dom_b | domain_enum::dom_c;
+}
+
+
+template<typename E>
+void check_against_std_set(std::uint32_t mask) {
+    std::set<E, boost::flags::total_order_t> expected;
+    boost::flags::flat_flag_set<E> set;
+
+    // single and bulk insertions
+    for (std::uint32_t round = 0; round < 5; ++round) {
+        auto const values = make_values<E>(300, round, mask);
+        if (round % 2 == 0) {
+            for (E v : values) {
+                auto const result = set.insert(v);
+                bool const inserted = expected.insert(v).second;
+                BOOST_TEST_EQ(result.second, inserted);
+                BOOST_TEST(*result.first == v);
+            }
+        } else {
+            set.insert(values.begin(), values.end());
+            expected.insert(values.begin(), values.end());
+        }
+        BOOST_TEST_EQ(set.size(), expected.size());
+        BOOST_TEST(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+    }
+
+    // lookups of contained and missing values
+    for (E v : make_values<E>(500, 99, mask)) {
+        BOOST_TEST_EQ(set.contains(v), expected.count(v) == 1);
+        auto const lb = set.lower_bound(v);
+        auto const expected_lb = expected.lower_bound(v);
+        BOOST_TEST_EQ(lb == set.end(), expected_lb == expected.end());
+        if (lb != set.end() && expected_lb != expected.end()) {
+            BOOST_TEST(*lb == *expected_lb);
+        }
+        auto const ub = set.upper_bound(v);
+        auto const expected_ub = expected.upper_bound(v);
+        BOOST_TEST_EQ(ub == set.end(), expected_ub == expected.end());
+        if (ub != set.end() && expected_ub != expected.end()) {
+            BOOST_TEST(*ub == *expected_ub);
+        }
+    }
+
+    // erase
+    for (E v : make_values<E>(200, 7, mask)) {
+        BOOST_TEST_EQ(set.erase(v), expected.erase(v));
+    }
+    BOOST_TEST(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+}
+
+
+void test_set() {
+    check_against_std_set<flags_enum>(0xffffffffu);
+    check_against_std_set<flags_enum>(0x7u);
+    check_against_std_set<signed_enum>(0xffffffffu);
+    check_against_std_set<signed_enum>(0x80000003u);
+}
+
+
+// values with bits outside the domain are ordered by all bits
+void test_outside_domain() {
+    boost::flags::flat_flag_set<domain_enum> set;
+    set.insert({ domain_enum::dom_x | domain_enum::dom_a, domain_enum::dom_a, domain_enum::dom_b, domain_enum::dom_x, domain_enum::dom_c });
+    BOOST_TEST(std::is_sorted(set.begin(), set.end(), boost::flags::total_order));
+    BOOST_TEST_EQ(set.size(), 5u);
+    BOOST_TEST(set.contains(domain_enum::dom_a));
+    BOOST_TEST(set.contains(domain_enum::dom_x | domain_enum::dom_a));
+    BOOST_TEST(set.contains(domain_enum::dom_x));
+    BOOST_TEST(set.find(domain_enum::dom_c) != set.end());
+    BOOST_TEST(set.find(domain_enum::dom_x | domain_enum::dom_b) == set.end());
+
+    set.insert({ domain_enum::dom_x | domain_enum::dom_b, domain_enum::dom_x, domain_enum::dom_a | domain_enum::dom_b });
+    BOOST_TEST(std::is_sorted(set.begin(), set.end(), boost::flags::total_order));
+    BOOST_TEST_EQ(set.size(), 7u);
+    BOOST_TEST(set.contains(domain_enum::dom_x | domain_enum::dom_b));
+}
+
+
+void test_basics() {
+    boost::flags::flat_flag_set<flags_enum> set{ flags_enum::bit_2, flags_enum::bit_0, flags_enum::bit_2 };
+    BOOST_TEST_EQ(set.size(), 2u);
+    BOOST_TEST(*set.begin() == flags_enum::bit_0);
+    BOOST_TEST(set.find(flags_enum::bit_1) == set.end());
+    BOOST_TEST_EQ(set.count(flags_enum::bit_2), 1u);
+
+    boost::flags::flat_flag_set<flags_enum> other{ flags_enum::bit_1, flags_enum::bit_2 };
+    set.merge(other);
+    BOOST_TEST_EQ(set.size(), 3u);
+    BOOST_TEST(set == (boost::flags::flat_flag_set<flags_enum>{ flags_enum::bit_0, flags_enum::bit_1, flags_enum::bit_2 }));
+    BOOST_TEST(set != other);
+
+    set.clear();
+    BOOST_TEST(set.empty());
+    BOOST_TEST(set.lower_bound(flags_enum::bit_0) == set.end());
+}
+
+
+int main() {
+    report_config();
+    test_set();
+    test_outside_domain();
+    test_basics();
+
+    return boost::report_errors();
+}
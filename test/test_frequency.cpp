@@ -0,0 +1,201 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_frequency
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/frequency.hpp>
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "include_test_post.hpp"
+#include "include_test_values.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+    bit_31 = boost::flags::nth_bit<unsigned int>(31),
+};
+
+// enable flags_enum
+BOOST_FLAGS_ENABLE(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+short_enum : unsigned short {
+    short_0 = boost::flags::nth_bit(0), // == 0x0001
+    short_15 = boost::flags::nth_bit(15), // == 0x8000
+};
+
+// enable short_enum
+BOOST_FLAGS_ENABLE(short_enum)
+
+
+template<typename E>
+std::array<std::uint64_t, sizeof(E) * 8> naive_counters(std::vector<E> const& values) {
+    std::array<std::uint64_t, sizeof(E) * 8> result{};
+    for (E v : values) {
+        for (std::size_t b = 0; b < result.size(); ++b) {
+            result[b] += (static_cast<std::uint64_t>(v) >> b) & 1;
+        }
+    }
+    return result;
+}
+
+
+template<typename E>
+void test_batches() {
+    for (std::size_t n : { 0, 1, 7, 64, 255, 256, 257, 1000, 4099 }) {
+        auto const values = make_values<E>(n, n);
+        auto const expected = naive_counters(values);
+
+        // one batch
+        boost::flags::flag_frequency<E> all;
+        all.add(values);
+        auto c = all.counters();
+        BOOST_TEST_ALL_EQ(c.begin(), c.end(), expected.begin(), expected.end());
+        BOOST_TEST_EQ(all.size(), n);
+
+        // batches of varying size and single values
+        boost::flags::flag_frequency<E> streamed;
+        std::size_t i = 0;
+        for (std::size_t batch = 1; i < n; batch = batch * 3 + 1) {
+            std::size_t const len = batch < n - i ? batch : n - i;
+            streamed.add(values.data() + i, len);
+            i += len;
+            if (i < n) {
+                streamed.add(values[i++]);
+            }
+        }
+        c = streamed.counters();
+        BOOST_TEST_ALL_EQ(c.begin(), c.end(), expected.begin(), expected.end());
+        BOOST_TEST_EQ(streamed.size(), n);
+
+        streamed.clear();
+        BOOST_TEST_EQ(streamed.size(), 0u);
+        BOOST_TEST_EQ(streamed.counters()[0], 0u);
+    }
+}
+
+
+// single values are buffered until a block is complete, the counts include the buffered values
+template<typename E>
+void test_single_values() {
+    auto const values = make_values<E>(1000, 7);
+    boost::flags::flag_frequency<E> freq;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        freq.add(values[i]);
+        if (i == 12 || i == 500) {
+            std::vector<E> const head(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            auto const expected = naive_counters(head);
+            auto const c = freq.counters();
+            BOOST_TEST_ALL_EQ(c.begin(), c.end(), expected.begin(), expected.end());
+        }
+    }
+    auto const expected = naive_counters(values);
+    auto c = freq.counters();
+    BOOST_TEST_ALL_EQ(c.begin(), c.end(), expected.begin(), expected.end());
+
+    // buffered values are merged as well
+    boost::flags::flag_frequency<E> total;
+    total.add(values.data(), 3);
+    total.merge(freq);
+    freq.clear();
+    total.add(values.data() + 3, 2);
+    freq.add(values.data(), 5);
+    c = total.counters();
+    auto const d = freq.counters();
+    for (std::size_t b = 0; b < c.size(); ++b) {
+        BOOST_TEST_EQ(c[b], expected[b] + d[b]);
+    }
+}
+
+
+void test_count() {
+    std::vector<flags_enum> values(1000, flags_enum::bit_0 | flags_enum::bit_31);
+    values[17] = flags_enum::bit_1;
+
+    boost::flags::flag_frequency<flags_enum> freq;
+    freq.add(values);
+
+    BOOST_TEST_EQ(freq.count(flags_enum::bit_0), 999u);
+    BOOST_TEST_EQ(freq[flags_enum::bit_1], 1u);
+    BOOST_TEST_EQ(freq[flags_enum::bit_2], 0u);
+    BOOST_TEST_EQ(freq[flags_enum::bit_31], 999u);
+
+    std::vector<std::pair<flags_enum, std::uint64_t>> visited;
+    freq.for_each([&](flags_enum flag, std::uint64_t count) { visited.emplace_back(flag, count); });
+    BOOST_TEST_EQ(visited.size(), 3u);
+    if (visited.size() == 3) {
+        BOOST_TEST(visited[0].first == flags_enum::bit_0);
+        BOOST_TEST(visited[1].first == flags_enum::bit_1);
+        BOOST_TEST(visited[2].first == flags_enum::bit_31);
+        BOOST_TEST_EQ(visited[2].second, 999u);
+    }
+}
+
+
+void test_merge() {
+    std::size_t const n = 10000;
+    std::size_t const threads = 4;
+    auto const values = make_values<short_enum>(n, 42);
+    auto const expected = naive_counters(values);
+
+    // per-thread partials
+    std::vector<boost::flags::flag_frequency<short_enum>> partials(threads);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (std::size_t i = t * n / threads; i < (t + 1) * n / threads; i += 100) {
+                partials[t].add(values.data() + i, 100);
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    boost::flags::flag_frequency<short_enum> total;
+    for (auto const& p : partials) {
+        total.merge(p);
+    }
+    auto c = total.counters();
+    BOOST_TEST_ALL_EQ(c.begin(), c.end(), expected.begin(), expected.end());
+    BOOST_TEST_EQ(total.size(), n);
+
+    boost::flags::flag_frequency<short_enum> sum = partials[0];
+    sum += partials[1];
+    BOOST_TEST_EQ(sum.size(), n / 2);
+    BOOST_TEST_EQ(sum[short_enum::short_15], partials[0][short_enum::short_15] + partials[1][short_enum::short_15]);
+}
+
+
+int main() {
+    report_config();
+    test_batches<flags_enum>();
+    test_batches<short_enum>();
+    test_single_values<flags_enum>();
+    test_single_values<short_enum>();
+    test_count();
+    test_merge();
+
+    return boost::report_errors();
+}
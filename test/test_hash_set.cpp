@@ -0,0 +1,105 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_hash_set
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/hash_set.hpp>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+};
+
+// enable flags_enum
+BOOST_FLAGS_ENABLE(flags_enum)
+
+
+void test_against_unordered_set() {
+    std::unordered_set<unsigned int> expected;
+    boost::flags::flag_hash_set<flags_enum> set;
+
+    std::uint32_t state = 17;
+    for (int i = 0; i < 20000; ++i) {
+        state = state * 1664525u + 1013904223u;
+        // dense small values (including 0) and some wide ones
+        unsigned int const v = (i % 3 == 0) ? state : (state >> 20);
+        auto const e = static_cast<flags_enum>(v);
+        switch (state % 4) {
+        case 0:
+            BOOST_TEST_EQ(set.erase(e), expected.erase(v));
+            break;
+        default:
+            BOOST_TEST_EQ(set.insert(e).second, expected.insert(v).second);
+            break;
+        }
+        if (i % 1000 == 0) {
+            BOOST_TEST_EQ(set.size(), expected.size());
+        }
+    }
+
+    BOOST_TEST_EQ(set.size(), expected.size());
+    std::size_t visited = 0;
+    for (flags_enum e : set) {
+        BOOST_TEST_EQ(expected.count(static_cast<unsigned int>(e)), 1u);
+        ++visited;
+    }
+    BOOST_TEST_EQ(visited, expected.size());
+
+    for (unsigned int v = 0; v < 5000; ++v) {
+        BOOST_TEST_EQ(set.contains(static_cast<flags_enum>(v)), expected.count(v) == 1);
+    }
+}
+
+
+void test_basics() {
+    boost::flags::flag_hash_set<flags_enum> set{ flags_enum::bit_0, flags_enum::bit_0 | flags_enum::bit_2, flags_enum{} };
+    BOOST_TEST_EQ(set.size(), 3u);
+    BOOST_TEST(set.contains(flags_enum{}));
+    BOOST_TEST(!set.contains(flags_enum::bit_1));
+    BOOST_TEST(*set.find(flags_enum::bit_0) == flags_enum::bit_0);
+    BOOST_TEST(set.find(flags_enum::bit_1) == set.end());
+
+    auto const result = set.insert(flags_enum::bit_0);
+    BOOST_TEST(!result.second);
+    BOOST_TEST(*result.first == flags_enum::bit_0);
+
+    boost::flags::flag_hash_set<flags_enum> other;
+    other.reserve(100);
+    BOOST_TEST_GE(other.capacity(), 100u);
+    other.insert({ flags_enum{}, flags_enum::bit_0 | flags_enum::bit_2, flags_enum::bit_0 });
+    BOOST_TEST(set == other);
+
+    other.erase(other.find(flags_enum{}));
+    BOOST_TEST(set != other);
+
+    set.clear();
+    BOOST_TEST(set.empty());
+    BOOST_TEST(set.begin() == set.end());
+}
+
+
+int main() {
+    report_config();
+    test_against_unordered_set();
+    test_basics();
+
+    return boost::report_errors();
+}
@@ -15,6 +15,8 @@
 #include <vector>
 #include <algorithm>
 #include <set>
+#include <functional>
+#include <unordered_set>
 
 #include "include_test_post.hpp"
 
@@ -117,6 +119,7 @@ BOOST_FLAGS(macro_5_enum)
 #endif
 
 BOOST_FLAGS_SPECIALIZE_STD_LESS(macro_5_enum)
+BOOST_FLAGS_SPECIALIZE_STD_HASH(macro_5_enum)
 
 
 
@@ -294,6 +297,21 @@ void test_macro_5() {
 		s.insert(v2);
 		s.insert(v12);
 	}
+	{
+		std::unordered_set<macro_5_enum> s;
+		s.insert(v1);
+		s.insert(v2);
+		s.insert(v12);
+		s.insert(v12);
+		BOOST_TEST_EQ(s.size(), 3u);
+		BOOST_TEST_EQ(s.count(v2), 1u);
+
+		// neighbouring values differ in many bits
+		std::hash<macro_5_enum> h;
+		BOOST_TEST_NE(h(v1), h(v12));
+		BOOST_TEST_NE(h(v1) & 0xff, h(v1 | macro_5_enum::bit_1) & 0xff);
+		BOOST_TEST_EQ(std::hash<boost::flags::complement<macro_5_enum>>{}(~v1), std::hash<boost::flags::complement<macro_5_enum>>{}(~v1));
+	}
 }
 
 
@@ -0,0 +1,187 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_optional
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/optional.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned char {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+};
+
+BOOST_FLAGS(flags_enum)
+
+constexpr flags_enum boost_flags_domain(flags_enum) {
+    return flags_enum::bit_0 | flags_enum::bit_1 | flags_enum::bit_2;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+wide_enum : std::uint32_t {
+    w_0 = boost::flags::nth_bit(0), // == 0x01
+    w_30 = boost::flags::nth_bit(30),
+};
+
+BOOST_FLAGS(wide_enum)
+
+constexpr wide_enum boost_flags_domain(wide_enum) {
+    return wide_enum::w_0 | wide_enum::w_30;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+full_enum : unsigned char {
+    f_0 = boost::flags::nth_bit(0), // == 0x01
+};
+
+// enable full_enum, the domain is the whole underlying type
+BOOST_FLAGS(full_enum)
+
+
+using opt_flags = boost::flags::compact_optional<flags_enum>;
+using opt_wide = boost::flags::compact_optional<wide_enum>;
+
+static_assert(sizeof(opt_flags) == sizeof(flags_enum), "");
+static_assert(sizeof(opt_wide) == sizeof(wide_enum), "");
+static_assert(std::is_trivially_copyable<opt_flags>::value, "");
+static_assert(std::is_trivially_copyable<opt_wide>::value, "");
+static_assert(opt_flags::empty_bits == 0xf8, "");
+static_assert(opt_wide::empty_bits == 0xbffffffe, "");
+
+
+// a hot struct with four optional flag fields
+struct record {
+    std::uint32_t id;
+    opt_flags a, b, c, d;
+};
+
+static_assert(sizeof(record) == 8, "");
+static_assert(sizeof(std::optional<flags_enum>) * 4 + sizeof(std::uint32_t) > sizeof(record), "");
+
+
+void test_engaged() {
+    opt_flags o;
+    BOOST_TEST(!o.has_value());
+    BOOST_TEST(!o);
+    BOOST_TEST(o == std::nullopt);
+    BOOST_TEST(std::nullopt == o);
+    BOOST_TEST(o != flags_enum{});
+    BOOST_TEST(o.value_or(flags_enum::bit_2) == flags_enum::bit_2);
+    BOOST_TEST_THROWS((void)o.value(), std::bad_optional_access);
+
+    o = flags_enum::bit_0 | flags_enum::bit_2;
+    BOOST_TEST(o.has_value());
+    BOOST_TEST(static_cast<bool>(o));
+    BOOST_TEST(*o == (flags_enum::bit_0 | flags_enum::bit_2));
+    BOOST_TEST(o.value() == (flags_enum::bit_0 | flags_enum::bit_2));
+    BOOST_TEST(o == (flags_enum::bit_0 | flags_enum::bit_2));
+    BOOST_TEST((flags_enum::bit_0 | flags_enum::bit_2) == o);
+    BOOST_TEST(o != std::nullopt);
+    BOOST_TEST(o != flags_enum::bit_0);
+    BOOST_TEST(boost::flags::any(*o & flags_enum::bit_2));
+
+    // the empty value is engaged
+    o = flags_enum{};
+    BOOST_TEST(o.has_value());
+    BOOST_TEST(o == flags_enum{});
+    BOOST_TEST(o != std::nullopt);
+
+    o.reset();
+    BOOST_TEST(o == std::nullopt);
+    BOOST_TEST(o.emplace(flags_enum::bit_1) == flags_enum::bit_1);
+    BOOST_TEST(o == flags_enum::bit_1);
+    o = std::nullopt;
+    BOOST_TEST(!o);
+
+    opt_flags p(flags_enum::bit_2);
+    swap(o, p);
+    BOOST_TEST(o == flags_enum::bit_2);
+    BOOST_TEST(p == std::nullopt);
+    BOOST_TEST(o != p);
+    p = o;
+    BOOST_TEST(o == p);
+
+    // memcpy is a valid copy
+    opt_flags q;
+    std::memcpy(&q, &o, sizeof(q));
+    BOOST_TEST(q == flags_enum::bit_2);
+
+    opt_wide w(wide_enum::w_30);
+    BOOST_TEST(w == wide_enum::w_30);
+    w.reset();
+    BOOST_TEST(!w.has_value());
+    BOOST_TEST(w.value_or(wide_enum::w_0) == wide_enum::w_0);
+
+#ifdef TEST_COMPILE_FAIL_OPTIONAL
+    // the domain of full_enum covers all bits of unsigned char
+    boost::flags::compact_optional<full_enum> full(full_enum::f_0);
+    BOOST_TEST(full.has_value());
+#endif // TEST_COMPILE_FAIL_OPTIONAL
+}
+
+
+void test_std_optional() {
+    std::optional<flags_enum> s;
+    opt_flags o(s);
+    BOOST_TEST(!o);
+    BOOST_TEST(o.to_optional() == std::nullopt);
+
+    s = flags_enum::bit_1;
+    o = s;
+    BOOST_TEST(o == flags_enum::bit_1);
+    BOOST_TEST(o.to_optional() == s);
+}
+
+
+constexpr opt_flags constexpr_optional() {
+    opt_flags o;
+    o = flags_enum::bit_1;
+    o.emplace(*o | flags_enum::bit_0);
+    return o;
+}
+
+void test_constexpr() {
+    constexpr opt_flags o = constexpr_optional();
+    static_assert(o.has_value(), "");
+    static_assert(*o == (flags_enum::bit_0 | flags_enum::bit_1), "");
+    constexpr opt_flags e = std::nullopt;
+    static_assert(e == std::nullopt, "");
+    static_assert(e.value_or(flags_enum::bit_2) == flags_enum::bit_2, "");
+    BOOST_TEST(o.has_value());
+}
+
+
+int main() {
+    test_engaged();
+    test_std_optional();
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,289 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_packed_array
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/packed_array.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "include_test_post.hpp"
+#include "include_test_values.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+    bit_3 = boost::flags::nth_bit(3), // == 0x08
+    bit_4 = boost::flags::nth_bit(4), // == 0x10
+};
+
+BOOST_FLAGS(flags_enum)
+
+constexpr flags_enum boost_flags_domain(flags_enum) {
+    return flags_enum::bit_0 | flags_enum::bit_1 | flags_enum::bit_2 | flags_enum::bit_3 | flags_enum::bit_4;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+sparse_enum : std::uint16_t {
+    s_0 = boost::flags::nth_bit(0), // == 0x0001
+    s_3 = boost::flags::nth_bit(3), // == 0x0008
+    s_9 = boost::flags::nth_bit(9), // == 0x0200
+    s_15 = boost::flags::nth_bit(15), // == 0x8000
+};
+
+BOOST_FLAGS(sparse_enum)
+
+constexpr sparse_enum boost_flags_domain(sparse_enum) {
+    return sparse_enum::s_0 | sparse_enum::s_3 | sparse_enum::s_9 | sparse_enum::s_15;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+byte_enum : unsigned char {
+    byte_0 = boost::flags::nth_bit(0), // == 0x01
+    byte_7 = boost::flags::nth_bit(7), // == 0x80
+};
+
+// enable byte_enum, the domain is the whole underlying type
+BOOST_FLAGS(byte_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+single_enum : unsigned int {
+    single = boost::flags::nth_bit(2), // == 0x04
+};
+
+BOOST_FLAGS(single_enum)
+
+constexpr single_enum boost_flags_domain(single_enum) {
+    return single_enum::single;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+wide_enum : std::uint64_t {
+    wide_0 = boost::flags::nth_bit(0), // == 0x01
+    wide_63 = boost::flags::nth_bit<std::uint64_t>(63),
+};
+
+BOOST_FLAGS(wide_enum)
+
+constexpr wide_enum boost_flags_domain(wide_enum) {
+    return wide_enum::wide_0 | wide_enum::wide_63;
+}
+
+
+static_assert(boost::flags::packed_flags_array<flags_enum>::bits_per_element == 5, "");
+static_assert(boost::flags::packed_flags_array<sparse_enum>::bits_per_element == 4, "");
+static_assert(boost::flags::packed_flags_array<byte_enum>::bits_per_element == 8, "");
+static_assert(boost::flags::packed_flags_array<single_enum>::bits_per_element == 1, "");
+static_assert(boost::flags::packed_flags_array<wide_enum>::bits_per_element == 2, "");
+
+
+// random values are restricted to the domain
+template<typename E>
+constexpr std::uint64_t domain_bits = static_cast<std::uint64_t>(boost::flags::domain_mask_v<E>);
+
+template<typename E>
+void check_array(std::size_t n) {
+    std::vector<E> const values = make_values<E>(n, n + 1, domain_bits<E>);
+
+    // element-wise
+    boost::flags::packed_flags_array<E> a;
+    for (E v : values) {
+        a.push_back(v);
+    }
+    BOOST_TEST_EQ(a.size(), n);
+    BOOST_TEST(std::equal(values.begin(), values.end(), a.begin(), a.end()));
+    BOOST_TEST_EQ(a.memory_bytes(), ((n * a.bits_per_element + 63) / 64 + 1) * 8);
+
+    // bulk
+    boost::flags::packed_flags_array<E> b;
+    b.assign(values.data(), values.size());
+    BOOST_TEST(a == b);
+    std::vector<E> unpacked(n);
+    b.unpack(0, n, unpacked.data());
+    BOOST_TEST(unpacked == values);
+
+    // unaligned sub-ranges
+    if (n > 20) {
+        std::vector<E> part(n - 13);
+        b.unpack(7, n - 13, part.data());
+        BOOST_TEST(std::equal(part.begin(), part.end(), values.begin() + 7));
+
+        std::vector<E> const other = make_values<E>(n - 13, 99, domain_bits<E>);
+        b.pack(7, other.data(), other.size());
+        std::vector<E> expected = values;
+        std::copy(other.begin(), other.end(), expected.begin() + 7);
+        BOOST_TEST(std::equal(expected.begin(), expected.end(), b.begin(), b.end()));
+        // the neighbours are unchanged
+        BOOST_TEST(b[6] == values[6]);
+        BOOST_TEST(b[n - 6] == values[n - 6]);
+    }
+
+    // resizing clears the removed elements
+    boost::flags::packed_flags_array<E> c(values.begin(), values.end());
+    BOOST_TEST(c == a);
+    if (n > 0) {
+        c.resize(n / 2);
+        c.resize(n);
+        boost::flags::packed_flags_array<E> d(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(n / 2));
+        d.resize(n);
+        BOOST_TEST(c == d);
+        d.pop_back();
+        BOOST_TEST_EQ(d.size(), n - 1);
+    }
+}
+
+void test_arrays() {
+    for (std::size_t n : { 0, 1, 7, 8, 13, 63, 64, 65, 100, 257, 1000 }) {
+        check_array<flags_enum>(n);
+        check_array<sparse_enum>(n);
+        check_array<byte_enum>(n);
+        check_array<single_enum>(n);
+        check_array<wide_enum>(n);
+    }
+}
+
+
+void test_proxies() {
+    boost::flags::packed_flags_array<flags_enum> a(20, flags_enum::bit_1);
+    BOOST_TEST(a[0] == flags_enum::bit_1);
+    BOOST_TEST(a[19] == flags_enum::bit_1);
+
+    a[12] = flags_enum::bit_4 | flags_enum::bit_0;
+    a[13] |= flags_enum::bit_3;
+    a[14] &= ~flags_enum::bit_1;
+    a[15] ^= flags_enum::bit_1 | flags_enum::bit_2;
+    a[16] = a[12];
+    BOOST_TEST(a[12] == (flags_enum::bit_4 | flags_enum::bit_0));
+    BOOST_TEST(a[13] == (flags_enum::bit_1 | flags_enum::bit_3));
+    BOOST_TEST(a[14] == flags_enum{});
+    BOOST_TEST(a[15] == flags_enum::bit_2);
+    BOOST_TEST(a[16] == (flags_enum::bit_4 | flags_enum::bit_0));
+    BOOST_TEST(a[11] == flags_enum::bit_1);
+    BOOST_TEST(a[17] == flags_enum::bit_1);
+
+    // bits outside of the domain are not stored
+    a[3] = static_cast<flags_enum>(0xffu);
+    flags_enum const masked = a[3];
+    BOOST_TEST_EQ(boost::flags::get_underlying(masked), 0x1fu);
+    BOOST_TEST(a[4] == flags_enum::bit_1);
+
+    // iterators
+    auto it = a.begin() + 12;
+    *it = flags_enum::bit_2;
+    BOOST_TEST(a[12] == flags_enum::bit_2);
+    BOOST_TEST(it[4] == (flags_enum::bit_4 | flags_enum::bit_0));
+    BOOST_TEST_EQ(a.end() - a.begin(), 20);
+    BOOST_TEST_EQ(std::count(a.cbegin(), a.cend(), flags_enum::bit_1), 14);
+    boost::flags::packed_flags_array<flags_enum>::const_iterator cit = it;
+    BOOST_TEST(*cit == flags_enum::bit_2);
+
+    BOOST_TEST(a.at(19) == flags_enum::bit_1);
+    BOOST_TEST_THROWS((void)a.at(20), std::out_of_range);
+    boost::flags::packed_flags_array<flags_enum> const& ca = a;
+    BOOST_TEST_THROWS((void)ca.at(20), std::out_of_range);
+
+    boost::flags::packed_flags_array<sparse_enum> s{ sparse_enum::s_15, sparse_enum::s_0 | sparse_enum::s_9 };
+    BOOST_TEST(s[0] == sparse_enum::s_15);
+    BOOST_TEST(s[1] == (sparse_enum::s_0 | sparse_enum::s_9));
+    s[0] |= sparse_enum::s_3;
+    BOOST_TEST(s[0] == (sparse_enum::s_3 | sparse_enum::s_15));
+}
+
+
+template<typename E, typename Pred>
+void check_scan(boost::flags::packed_flags_array<E> const& a, std::vector<E> const& values, Pred pred) {
+    std::vector<std::uint32_t> expected;
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (pred(values[i])) {
+            expected.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+
+    std::vector<std::uint32_t> selection(values.size());
+    std::size_t const count = boost::flags::scan_packed(a, pred, selection.data());
+    selection.resize(count);
+    BOOST_TEST(selection == expected);
+
+    std::vector<std::uint64_t> bitmap((values.size() + 63) / 64);
+    BOOST_TEST_EQ(boost::flags::scan_packed_bitmap(a, pred, bitmap.data()), expected.size());
+    for (std::uint32_t i : expected) {
+        BOOST_TEST((bitmap[i / 64] >> (i % 64)) & 1);
+    }
+}
+
+template<typename E>
+void check_scans(E m1, E m2) {
+    for (std::size_t n : { 0, 1, 12, 64, 65, 300, 1001 }) {
+        std::vector<E> const values = make_values<E>(n, 7 * n + 3, domain_bits<E>);
+        boost::flags::packed_flags_array<E> a;
+        a.assign(values.data(), values.size());
+
+        check_scan(a, values, boost::flags::match_all(m1));
+        check_scan(a, values, boost::flags::match_none(m1 | m2));
+        check_scan(a, values, boost::flags::match(m1 | m2, m2));
+        check_scan(a, values, boost::flags::match(E{}, E{}));
+        // never satisfied: expected is not within the mask
+        check_scan(a, values, boost::flags::match(m1, m2));
+        // general predicates
+        check_scan(a, values, [m1](E v) { return boost::flags::any(v & m1); });
+    }
+}
+
+void test_scans() {
+    check_scans(flags_enum::bit_1 | flags_enum::bit_4, flags_enum::bit_2);
+    check_scans(sparse_enum::s_9, sparse_enum::s_0 | sparse_enum::s_15);
+    check_scans(byte_enum::byte_7, byte_enum::byte_0);
+    check_scans(single_enum::single, single_enum{});
+    check_scans(wide_enum::wide_63, wide_enum::wide_0);
+}
+
+
+void test_memory() {
+    // 5 of 32 bits per element
+    std::vector<flags_enum> const values = make_values<flags_enum>(100000, 1, domain_bits<flags_enum>);
+    boost::flags::packed_flags_array<flags_enum> a;
+    a.assign(values.data(), values.size());
+    BOOST_TEST(a.memory_bytes() * 6 < values.size() * sizeof(flags_enum));
+}
+
+
+int main() {
+    test_arrays();
+    test_proxies();
+    test_scans();
+    test_memory();
+
+    return boost::report_errors();
+}
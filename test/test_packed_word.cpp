@@ -0,0 +1,251 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_packed_word
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/packed_word.hpp>
+
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+state_flags : unsigned int {
+    ready = boost::flags::nth_bit(0), // == 0x01
+    busy = boost::flags::nth_bit(1), // == 0x02
+    failed = boost::flags::nth_bit(2), // == 0x04
+};
+
+BOOST_FLAGS(state_flags)
+
+constexpr state_flags boost_flags_domain(state_flags) {
+    return state_flags::ready | state_flags::busy | state_flags::failed;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+access_flags : std::uint16_t {
+    may_read = boost::flags::nth_bit(0), // == 0x01
+    may_write = boost::flags::nth_bit(1), // == 0x02
+    may_exec = boost::flags::nth_bit(4), // == 0x10
+};
+
+BOOST_FLAGS(access_flags)
+
+constexpr access_flags boost_flags_domain(access_flags) {
+    return access_flags::may_read | access_flags::may_write | access_flags::may_exec;
+}
+
+
+// state: bits 0-2, access: bits 8-12, counter: bits 13-24
+using word = boost::flags::packed_word<
+    boost::flags::field<state_flags, 0>,
+    boost::flags::field<access_flags, 8>,
+    boost::flags::uint_field<12>>;
+
+static_assert(std::is_same<word::word_type, std::uint32_t>::value, "");
+static_assert(sizeof(word) == 4, "");
+static_assert(std::is_trivially_copyable<word>::value, "");
+static_assert(word::offset<2>() == 13, "");
+static_assert(word::mask<0>() == 0x7u, "");
+static_assert(word::mask<1>() == 0x1300u, "");
+static_assert(word::mask<2>() == 0x1ffe000u, "");
+static_assert(std::is_same<word::value_type<2>, std::uint16_t>::value, "");
+
+// fields with automatic offsets
+using small_word = boost::flags::packed_word<
+    boost::flags::field<state_flags>,
+    boost::flags::uint_field<5>>;
+
+static_assert(std::is_same<small_word::word_type, std::uint8_t>::value, "");
+static_assert(small_word::offset<1>() == 3, "");
+
+// sparse domains may interleave
+using interleaved = boost::flags::packed_word<
+    boost::flags::field<access_flags, 0>,
+    boost::flags::uint_field<2, 2>>;
+
+static_assert(interleaved::mask<1>() == 0xcu, "");
+
+
+void test_access() {
+    word w;
+    BOOST_TEST_EQ(w.to_bits(), 0u);
+
+    w.set<0>(state_flags::busy);
+    w.set<access_flags>(access_flags::may_read | access_flags::may_exec);
+    w.set<2>(4095);
+    BOOST_TEST(w.get<0>() == state_flags::busy);
+    BOOST_TEST(w.get<state_flags>() == state_flags::busy);
+    BOOST_TEST(w.get<1>() == (access_flags::may_read | access_flags::may_exec));
+    BOOST_TEST_EQ(w.get<2>(), 4095u);
+    BOOST_TEST_EQ(w.to_bits(), 0x2u | 0x1100u | (4095u << 13));
+
+    // replacing a field leaves the others unchanged
+    w.set<2>(17);
+    BOOST_TEST_EQ(w.get<2>(), 17u);
+    BOOST_TEST(w.get<0>() == state_flags::busy);
+    BOOST_TEST(w.get<1>() == (access_flags::may_read | access_flags::may_exec));
+
+    // bits outside of the domain don't leak into other fields
+    w.set<0>(static_cast<state_flags>(0xffffffffu));
+    BOOST_TEST(w.get<0>() == (state_flags::ready | state_flags::busy | state_flags::failed));
+    BOOST_TEST(w.get<1>() == (access_flags::may_read | access_flags::may_exec));
+    BOOST_TEST_EQ(w.get<2>(), 17u);
+
+    word const v(state_flags::ready, access_flags::may_write, 3);
+    BOOST_TEST(v.get<0>() == state_flags::ready);
+    BOOST_TEST(v.get<1>() == access_flags::may_write);
+    BOOST_TEST_EQ(v.get<2>(), 3u);
+    BOOST_TEST(word::from_bits(v.to_bits()) == v);
+    BOOST_TEST(v != w);
+
+    small_word s(state_flags::failed, 31);
+    BOOST_TEST_EQ(s.to_bits(), 0x4u | (31u << 3));
+
+#ifdef TEST_COMPILE_FAIL_PACKED_WORD
+    // the counter overlaps the access flags
+    boost::flags::packed_word<boost::flags::field<access_flags, 0>, boost::flags::uint_field<4, 3>> overlapping;
+    BOOST_TEST_EQ(overlapping.to_bits(), 0u);
+#endif // TEST_COMPILE_FAIL_PACKED_WORD
+}
+
+
+void test_operators() {
+    word w(state_flags::ready, access_flags::may_read, 100);
+
+    w.ref<0>() |= state_flags::busy | state_flags::failed;
+    BOOST_TEST(w.get<0>() == (state_flags::ready | state_flags::busy | state_flags::failed));
+    w.ref<0>() &= ~state_flags::ready;
+    BOOST_TEST(w.get<0>() == (state_flags::busy | state_flags::failed));
+    w.ref<state_flags>() ^= state_flags::busy | state_flags::ready;
+    BOOST_TEST(w.get<0>() == (state_flags::ready | state_flags::failed));
+    w.ref<0>() &= state_flags::failed;
+    BOOST_TEST(w.ref<0>() == state_flags::failed);
+    BOOST_TEST(state_flags::failed == w.ref<0>());
+    BOOST_TEST(w.ref<0>() != state_flags::ready);
+
+    // the complement only clears bits of its own field
+    w.ref<1>() |= access_flags::may_write;
+    w.ref<1>() &= ~access_flags::may_read;
+    BOOST_TEST(w.get<1>() == access_flags::may_write);
+    BOOST_TEST(w.get<0>() == state_flags::failed);
+    BOOST_TEST_EQ(w.get<2>(), 100u);
+
+    w.ref<2>() = 7;
+    BOOST_TEST_EQ(w.get<2>(), 7u);
+    std::uint16_t const counter = w.ref<2>();
+    BOOST_TEST_EQ(counter, 7u);
+
+    // the flag tests work on the field values
+    BOOST_TEST(boost::flags::any(w.get<1>() & access_flags::may_write));
+    BOOST_TEST(boost::flags::none(w.get<0>() & state_flags::ready));
+}
+
+
+constexpr word constexpr_word() {
+    word w;
+    w.set<0>(state_flags::ready);
+    w.ref<0>() |= state_flags::failed;
+    w.ref<2>() = 5;
+    return w;
+}
+
+void test_constexpr() {
+    constexpr word w = constexpr_word();
+    static_assert(w.get<0>() == (state_flags::ready | state_flags::failed), "");
+    static_assert(w.get<2>() == 5, "");
+    BOOST_TEST_EQ(w.to_bits(), 0x5u | (5u << 13));
+}
+
+
+void test_atomic() {
+    boost::flags::atomic_packed_word<
+        boost::flags::field<state_flags, 0>,
+        boost::flags::field<access_flags, 8>,
+        boost::flags::uint_field<12>> a{ word(state_flags::ready, access_flags{}, 0) };
+    BOOST_TEST(a.is_lock_free());
+
+    BOOST_TEST(a.fetch_or<1>(access_flags::may_read).get<1>() == access_flags{});
+    BOOST_TEST(a.fetch_xor<0>(state_flags::busy).get<0>() == state_flags::ready);
+    BOOST_TEST(a.fetch_and<0>(~state_flags::ready).get<0>() == (state_flags::ready | state_flags::busy));
+    BOOST_TEST(a.fetch_and<1>(access_flags::may_write).get<1>() == access_flags::may_read);
+    BOOST_TEST(a.load() == word(state_flags::busy, access_flags{}, 0));
+
+    // several fields in one compare-exchange
+    word expected(state_flags::busy, access_flags{}, 0);
+    BOOST_TEST(a.compare_exchange_strong(expected, word(state_flags::ready, access_flags::may_exec, 1)));
+    expected = word(state_flags::busy, access_flags{}, 0);
+    BOOST_TEST(!a.compare_exchange_strong(expected, word()));
+    BOOST_TEST(expected == word(state_flags::ready, access_flags::may_exec, 1));
+
+    word const old = a.update([](word& w) {
+        w.ref<0>() |= state_flags::failed;
+        w.set<2>(static_cast<std::uint16_t>(w.get<2>() + 1));
+    });
+    BOOST_TEST(old == word(state_flags::ready, access_flags::may_exec, 1));
+    BOOST_TEST(a.load() == word(state_flags::ready | state_flags::failed, access_flags::may_exec, 2));
+
+    BOOST_TEST(a.exchange(word()) == word(state_flags::ready | state_flags::failed, access_flags::may_exec, 2));
+    a.store(word(state_flags{}, access_flags::may_read, 9));
+    BOOST_TEST_EQ(a.load().get<2>(), 9u);
+}
+
+
+void test_atomic_threads() {
+    boost::flags::atomic_packed_word<
+        boost::flags::field<state_flags, 0>,
+        boost::flags::field<access_flags, 8>,
+        boost::flags::uint_field<12>> a;
+
+    // concurrent counter increments together with flag toggles of other fields
+    auto increment = [&a] {
+        for (int i = 0; i < 1000; ++i) {
+            (void)a.update([](word& w) {
+                w.set<2>(static_cast<std::uint16_t>(w.get<2>() + 1));
+                w.ref<0>() ^= state_flags::busy;
+            });
+        }
+    };
+    auto toggle = [&a] {
+        for (int i = 0; i < 1000; ++i) {
+            (void)a.fetch_xor<1>(access_flags::may_exec);
+        }
+    };
+    std::thread t1(increment), t2(increment), t3(toggle);
+    t1.join();
+    t2.join();
+    t3.join();
+
+    word const w = a.load();
+    BOOST_TEST_EQ(w.get<2>(), 2000u);
+    BOOST_TEST(w.get<0>() == state_flags{});
+    BOOST_TEST(w.get<1>() == access_flags{});
+}
+
+
+int main() {
+    test_access();
+    test_operators();
+    test_constexpr();
+    test_atomic();
+    test_atomic_threads();
+
+    return boost::report_errors();
+}
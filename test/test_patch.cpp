@@ -0,0 +1,198 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_patch
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/patch.hpp>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "include_test_post.hpp"
+#include "include_test_values.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+    bit_3 = boost::flags::nth_bit(3), // == 0x08
+};
+
+// enable flags_enum
+BOOST_FLAGS(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+byte_enum : unsigned char {
+    byte_0 = boost::flags::nth_bit(0), // == 0x01
+    byte_7 = boost::flags::nth_bit(7), // == 0x80
+};
+
+// enable byte_enum
+BOOST_FLAGS_ENABLE(byte_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+wide_enum : std::uint64_t {
+    wide_0 = boost::flags::nth_bit(0), // == 0x01
+    wide_63 = boost::flags::nth_bit<std::uint64_t>(63),
+};
+
+// enable wide_enum
+BOOST_FLAGS_ENABLE(wide_enum)
+
+
+using patch = boost::flags::flag_patch<flags_enum>;
+
+// patches are constant expressions
+constexpr patch layer_1 = patch{}.set(flags_enum::bit_0 | flags_enum::bit_1).toggle(flags_enum::bit_3);
+constexpr patch layer_2 = patch{}.clear(flags_enum::bit_1).toggle(flags_enum::bit_0 | flags_enum::bit_2);
+static_assert(layer_1.then(layer_2)(flags_enum::bit_2) == (flags_enum::bit_3), "");
+static_assert(boost::flags::compose(layer_2, layer_1) == layer_1.then(layer_2), "");
+static_assert(patch{}.is_identity(), "");
+static_assert(patch{}.set(flags_enum::bit_0).clear(flags_enum::bit_0).set_mask() == flags_enum{}, "");
+
+
+void test_single() {
+    flags_enum const v = flags_enum::bit_0 | flags_enum::bit_2;
+
+    BOOST_TEST(patch{}(v) == v);
+    BOOST_TEST(patch{}.set(flags_enum::bit_1)(v) == (v | flags_enum::bit_1));
+    BOOST_TEST(patch{}.clear(flags_enum::bit_0)(v) == flags_enum::bit_2);
+    BOOST_TEST(patch{}.toggle(flags_enum::bit_0 | flags_enum::bit_3)(v) == (flags_enum::bit_2 | flags_enum::bit_3));
+    BOOST_TEST(patch{}.assign(flags_enum::bit_3)(v) == flags_enum::bit_3);
+
+    // the builders agree with the utility functions
+    for (bool b : { false, true }) {
+        BOOST_TEST(patch{}.modify(flags_enum::bit_1 | flags_enum::bit_2, b)(v) == boost::flags::modify(v, flags_enum::bit_1 | flags_enum::bit_2, b));
+        BOOST_TEST(patch{}.add_if(flags_enum::bit_3, b)(v) == boost::flags::add_if(v, flags_enum::bit_3, b));
+        BOOST_TEST(patch{}.remove_if(flags_enum::bit_2, b)(v) == boost::flags::remove_if(v, flags_enum::bit_2, b));
+    }
+
+    // overlapping masks: set and clear force the value, toggle inverts it
+    patch const p(flags_enum::bit_0 | flags_enum::bit_1, flags_enum::bit_1 | flags_enum::bit_2, flags_enum::bit_1 | flags_enum::bit_3);
+    BOOST_TEST(p.set_mask() == flags_enum::bit_0);
+    BOOST_TEST(p.clear_mask() == (flags_enum::bit_1 | flags_enum::bit_2));
+    BOOST_TEST(p.toggle_mask() == flags_enum::bit_3);
+    BOOST_TEST(p(v) == (flags_enum::bit_0 | flags_enum::bit_3));
+}
+
+
+template<typename E>
+void check_composition() {
+    using U = typename std::underlying_type<E>::type;
+    using P = boost::flags::flag_patch<E>;
+    random_values<E> random;
+
+    for (int i = 0; i < 1000; ++i) {
+        P const p1(random(), random(), random());
+        P const p2(random(), random(), random());
+        P const p3(random(), random(), random());
+
+        // raw masks: the patch equals ((v & ~clear) | set) ^ toggle
+        E const s = random(), c = random(), t = random();
+        P const raw(s, c, t);
+
+        P const p21 = boost::flags::compose(p2, p1);
+        for (int j = 0; j < 8; ++j) {
+            E const v = random();
+            BOOST_TEST(raw(v) == static_cast<E>(static_cast<U>(((static_cast<U>(v) & ~static_cast<U>(c)) | static_cast<U>(s)) ^ static_cast<U>(t))));
+            BOOST_TEST(p21(v) == p2(p1(v)));
+            BOOST_TEST(p1.then(p2).then(p3)(v) == p3(p2(p1(v))));
+        }
+
+        // associativity (the representation is unique)
+        BOOST_TEST(boost::flags::compose(p3, p21) == boost::flags::compose(boost::flags::compose(p3, p2), p1));
+        BOOST_TEST(p1.then(P{}) == p1);
+        BOOST_TEST(P{}.then(p1) == p1);
+    }
+}
+
+void test_composition() {
+    check_composition<flags_enum>();
+    check_composition<byte_enum>();
+    check_composition<wide_enum>();
+}
+
+
+template<typename E>
+void check_apply(std::size_t n) {
+    using P = boost::flags::flag_patch<E>;
+    random_values<E> random;
+
+    std::vector<E> values(n);
+    for (E& v : values) {
+        v = random();
+    }
+    P const p = P{}.set(random()).clear(random()).toggle(random());
+
+    std::vector<E> expected;
+    for (E v : values) {
+        expected.push_back(p(v));
+    }
+
+    // executor running the tasks inline
+    auto inline_executor = [](std::function<void()> task) { task(); };
+
+    std::vector<E> v = values;
+    boost::flags::apply_patch(v, p);
+    BOOST_TEST(v == expected);
+
+    v = values;
+    boost::flags::apply_patch(boost::flags::execution::scalar, v, p);
+    BOOST_TEST(v == expected);
+
+    v = values;
+    boost::flags::apply_patch(boost::flags::execution::parallel(3), v, p);
+    BOOST_TEST(v == expected);
+
+    v = values;
+    boost::flags::apply_patch(boost::flags::execution::parallel(inline_executor, 5), v.data(), v.size(), p);
+    BOOST_TEST(v == expected);
+
+    // the identity leaves the values unchanged
+    v = values;
+    boost::flags::apply_patch(v, P{});
+    BOOST_TEST(v == values);
+}
+
+void test_apply() {
+    for (std::size_t n : { 0, 1, 5, 31, 32, 100, 257, 1000 }) {
+        check_apply<flags_enum>(n);
+        check_apply<byte_enum>(n);
+        check_apply<wide_enum>(n);
+    }
+
+    // the layers are applied in one pass
+    std::vector<flags_enum> values(100, flags_enum::bit_1 | flags_enum::bit_2);
+    boost::flags::apply_patch(values, layer_1.then(layer_2));
+    BOOST_TEST(values[99] == (flags_enum::bit_3));
+}
+
+
+int main() {
+    report_config();
+    test_single();
+    test_composition();
+    test_apply();
+
+    return boost::report_errors();
+}
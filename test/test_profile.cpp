@@ -0,0 +1,183 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// per-call-site profiling of the flag tests (requires C++20)
+// if a path is passed as argument, the report is also written to it (cf. tools/flags_profile_dump.cpp),
+// options starting with `--` are ignored
+
+#define TEST_NAMESPACE test_profile
+#include "include_test.hpp"
+
+#define BOOST_FLAGS_PROFILE 1
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+};
+
+BOOST_FLAGS(flags_enum)
+
+
+using boost::flags::profile::site_record;
+
+site_record const* find_line(std::vector<site_record> const& records, std::uint32_t line) {
+    auto it = std::find_if(records.begin(), records.end(), [&](site_record const& r) { return r.line == line; });
+    return it == records.end() ? nullptr : &*it;
+}
+
+
+void test_sites() {
+    boost::flags::profile::reset();
+
+    std::uint32_t line_any = 0, line_and = 0, line_intersect = 0, line_none = 0;
+    for (unsigned int i = 0; i < 100; ++i) {
+        flags_enum const e = boost::flags::from_underlying<flags_enum>(i % 8);
+        line_any = __LINE__; (void)boost::flags::any(e & flags_enum::bit_0);
+        line_and = __LINE__; (void)(e BOOST_FLAGS_AND flags_enum::bit_2);
+        line_intersect = __LINE__; (void)boost::flags::intersect(e, flags_enum::bit_0 | flags_enum::bit_1);
+        line_none = __LINE__; (void)boost::flags::none(e);
+        (void)boost::flags::disjoint(e, flags_enum::bit_2);
+    }
+
+    auto const records = boost::flags::profile::snapshot();
+    BOOST_TEST_EQ(records.size(), 5u);
+
+    site_record const* r = find_line(records, line_any);
+    BOOST_TEST(r != nullptr);
+    if (r) {
+        BOOST_TEST_EQ(r->true_count, 50u);
+        BOOST_TEST_EQ(r->false_count, 50u);
+        BOOST_TEST(r->file.find("test_profile.cpp") != std::string::npos);
+        BOOST_TEST(r->function.find("test_sites") != std::string::npos);
+    }
+
+    r = find_line(records, line_and);
+    BOOST_TEST(r != nullptr);
+    if (r) {
+        BOOST_TEST_EQ(r->true_count, 48u);
+        BOOST_TEST_EQ(r->false_count, 52u);
+    }
+
+    r = find_line(records, line_intersect);
+    BOOST_TEST(r != nullptr);
+    if (r) {
+        BOOST_TEST_EQ(r->true_count, 75u);
+        BOOST_TEST_EQ(r->false_count, 25u);
+    }
+
+    r = find_line(records, line_none);
+    BOOST_TEST(r != nullptr);
+    if (r) {
+        BOOST_TEST_EQ(r->true_count, 13u);
+        BOOST_TEST_EQ(r->false_count, 87u);
+    }
+}
+
+
+void test_threads() {
+    boost::flags::profile::reset();
+
+    std::uint32_t const line = __LINE__ + 3;
+    auto body = [] {
+        for (int i = 0; i < 1000; ++i) {
+            (void)boost::flags::any(flags_enum::bit_1);
+        }
+    };
+    std::thread t1(body), t2(body);
+    t1.join();
+    t2.join();
+    body();
+
+    // the counters of finished threads are merged
+    auto const records = boost::flags::profile::snapshot();
+    site_record const* r = find_line(records, line);
+    BOOST_TEST(r != nullptr);
+    if (r) {
+        BOOST_TEST_EQ(r->true_count, 3000u);
+        BOOST_TEST_EQ(r->false_count, 0u);
+    }
+}
+
+
+void test_report(char const* path) {
+    boost::flags::profile::reset();
+    for (int i = 0; i < 10; ++i) {
+        (void)boost::flags::any(boost::flags::from_underlying<flags_enum>(i & 1));
+    }
+    auto const records = boost::flags::profile::snapshot();
+
+    std::stringstream report;
+    boost::flags::profile::write_report(report, records);
+    auto const read = boost::flags::profile::read_report(report);
+    BOOST_TEST_EQ(read.size(), records.size());
+    for (std::size_t i = 0; i < std::min(read.size(), records.size()); ++i) {
+        BOOST_TEST_EQ(read[i].file, records[i].file);
+        BOOST_TEST_EQ(read[i].function, records[i].function);
+        BOOST_TEST_EQ(read[i].line, records[i].line);
+        BOOST_TEST_EQ(read[i].column, records[i].column);
+        BOOST_TEST_EQ(read[i].true_count, 5u);
+        BOOST_TEST_EQ(read[i].false_count, 5u);
+    }
+
+    std::ostringstream dump;
+    boost::flags::profile::dump_report(dump, read);
+    BOOST_TEST(dump.str().find("test_profile.cpp") != std::string::npos);
+
+    // malformed reports
+    std::istringstream garbage("not a report");
+    BOOST_TEST_THROWS(boost::flags::profile::read_report(garbage), std::runtime_error);
+    std::string truncated = report.str();
+    truncated.resize(truncated.size() - 1);
+    std::istringstream truncated_report(truncated);
+    BOOST_TEST_THROWS(boost::flags::profile::read_report(truncated_report), std::runtime_error);
+    // huge counts of strings resp. records are not allocated up front
+    std::string const header = report.str().substr(0, 8);
+    std::istringstream huge_strings(header + "\xff\xff\xff\xff");
+    BOOST_TEST_THROWS(boost::flags::profile::read_report(huge_strings), std::runtime_error);
+    std::istringstream huge_records(header + std::string(4, '\0') + "\xff\xff\xff\xff");
+    BOOST_TEST_THROWS(boost::flags::profile::read_report(huge_records), std::runtime_error);
+
+    if (path) {
+        BOOST_TEST(boost::flags::profile::write_report(path));
+    }
+}
+
+
+void test_constexpr() {
+    boost::flags::profile::reset();
+
+    // constant expressions are not counted
+    constexpr bool b = boost::flags::any(flags_enum::bit_0) && (flags_enum::bit_0 BOOST_FLAGS_AND flags_enum::bit_0);
+    static_assert(b, "");
+    BOOST_TEST(boost::flags::profile::snapshot().empty());
+}
+
+
+int main(int argc, char* argv[]) {
+    test_sites();
+    test_threads();
+    test_report(argc > 1 && std::string(argv[1]).rfind("--", 0) != 0 ? argv[1] : nullptr);
+    test_constexpr();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,172 @@
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_reduce
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/reduce.hpp>
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "include_test_post.hpp"
+#include "include_test_values.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+    bit_31 = boost::flags::nth_bit<unsigned int>(31),
+};
+
+// enable flags_enum
+BOOST_FLAGS_ENABLE(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+byte_enum : unsigned char {
+    byte_0 = boost::flags::nth_bit(0), // == 0x01
+    byte_7 = boost::flags::nth_bit(7), // == 0x80
+};
+
+// enable byte_enum
+BOOST_FLAGS_ENABLE(byte_enum)
+
+
+template<typename E>
+void check_range(std::vector<E> const& values) {
+    using U = typename std::underlying_type<E>::type;
+    U expected_or = 0;
+    U expected_and = static_cast<U>(~U(0));
+    U expected_xor = 0;
+    boost::flags::bit_histogram_t<E> expected_histogram{};
+    for (E v : values) {
+        U const u = static_cast<U>(v);
+        expected_or |= u;
+        expected_and &= u;
+        expected_xor ^= u;
+        for (std::size_t b = 0; b < expected_histogram.size(); ++b) {
+            expected_histogram[b] += (u >> b) & 1;
+        }
+    }
+
+    // executor running the tasks inline
+    auto inline_executor = [](std::function<void()> task) { task(); };
+
+    BOOST_TEST(boost::flags::reduce_or(values) == static_cast<E>(expected_or));
+    BOOST_TEST(boost::flags::reduce_or(boost::flags::execution::scalar, values) == static_cast<E>(expected_or));
+    BOOST_TEST(boost::flags::reduce_or(boost::flags::execution::simd, values) == static_cast<E>(expected_or));
+    BOOST_TEST(boost::flags::reduce_or(boost::flags::execution::parallel(3), values) == static_cast<E>(expected_or));
+    BOOST_TEST(boost::flags::reduce_or(boost::flags::execution::parallel(inline_executor, 5), values) == static_cast<E>(expected_or));
+
+    BOOST_TEST(boost::flags::reduce_and(values) == static_cast<E>(expected_and));
+    BOOST_TEST(boost::flags::reduce_and(boost::flags::execution::scalar, values) == static_cast<E>(expected_and));
+    BOOST_TEST(boost::flags::reduce_and(boost::flags::execution::parallel(4), values) == static_cast<E>(expected_and));
+
+    BOOST_TEST(boost::flags::reduce_xor(values) == static_cast<E>(expected_xor));
+    BOOST_TEST(boost::flags::reduce_xor(boost::flags::execution::scalar, values) == static_cast<E>(expected_xor));
+    BOOST_TEST(boost::flags::reduce_xor(boost::flags::execution::parallel(inline_executor, 2), values) == static_cast<E>(expected_xor));
+
+    auto h = boost::flags::bit_histogram(values);
+    BOOST_TEST_ALL_EQ(h.begin(), h.end(), expected_histogram.begin(), expected_histogram.end());
+    h = boost::flags::bit_histogram(boost::flags::execution::scalar, values);
+    BOOST_TEST_ALL_EQ(h.begin(), h.end(), expected_histogram.begin(), expected_histogram.end());
+    h = boost::flags::bit_histogram(boost::flags::execution::parallel(3), values);
+    BOOST_TEST_ALL_EQ(h.begin(), h.end(), expected_histogram.begin(), expected_histogram.end());
+    h = boost::flags::bit_histogram(boost::flags::execution::parallel(inline_executor, 7), values);
+    BOOST_TEST_ALL_EQ(h.begin(), h.end(), expected_histogram.begin(), expected_histogram.end());
+}
+
+void test_reductions() {
+    for (std::size_t n : { 0, 1, 5, 31, 32, 100, 255, 256, 257, 1000, 5000 }) {
+        check_range(make_values<flags_enum>(n));
+        check_range(make_values<byte_enum>(n));
+    }
+}
+
+void test_known_values() {
+    std::vector<flags_enum> values(1000, flags_enum::bit_0 | flags_enum::bit_31);
+    values[500] = flags_enum::bit_1 | flags_enum::bit_31;
+
+    BOOST_TEST(boost::flags::reduce_or(values) == (flags_enum::bit_0 | flags_enum::bit_1 | flags_enum::bit_31));
+    BOOST_TEST(boost::flags::reduce_and(values) == flags_enum::bit_31);
+    BOOST_TEST(boost::flags::reduce_xor(values) == (flags_enum::bit_0 | flags_enum::bit_1));
+
+    auto h = boost::flags::bit_histogram(values);
+    BOOST_TEST_EQ(h.size(), 32u);
+    BOOST_TEST_EQ(h[0], 999u);
+    BOOST_TEST_EQ(h[1], 1u);
+    BOOST_TEST_EQ(h[2], 0u);
+    BOOST_TEST_EQ(h[31], 1000u);
+}
+
+void test_execution() {
+    std::vector<flags_enum> const values = make_values<flags_enum>(1000);
+    flags_enum const expected = boost::flags::reduce_or(boost::flags::execution::scalar, values);
+
+    // policies with zero tasks process the range in one chunk
+    auto inline_executor = [](std::function<void()> task) { task(); };
+    BOOST_TEST(boost::flags::reduce_or(boost::flags::execution::parallel_t<boost::flags::execution::thread_executor>{ {}, 0 }, values) == expected);
+    BOOST_TEST(boost::flags::reduce_or(boost::flags::execution::parallel_t<decltype(inline_executor)>{ inline_executor, 0 }, values) == expected);
+
+    // an executor failing to post the third task: the posted tasks finish before the exception is propagated
+    std::vector<std::thread> threads;
+    std::atomic<std::size_t> processed{ 0 };
+    auto failing_executor = [&](std::function<void()> task) {
+        if (threads.size() == 2) {
+            throw std::runtime_error("executor failed");
+        }
+        threads.emplace_back([task, &processed] {
+            std::this_thread::yield();
+            task();
+            ++processed;
+        });
+    };
+    BOOST_TEST_THROWS((void)boost::flags::reduce_or(boost::flags::execution::parallel(failing_executor, 4), values), std::runtime_error);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    BOOST_TEST_EQ(processed.load(), 2u);
+
+    // exceptions thrown while processing a chunk are rethrown after all chunks are finished
+    for (std::size_t failing : { 0, 2 }) {
+        std::atomic<std::size_t> chunks{ 0 };
+        auto const body = [&](std::size_t task, std::size_t, std::size_t) {
+            ++chunks;
+            if (task == failing) {
+                throw std::runtime_error("chunk failed");
+            }
+        };
+        BOOST_TEST_THROWS(boost::flags::impl::parallel_chunks(boost::flags::execution::parallel(4), 100, body), std::runtime_error);
+        BOOST_TEST_EQ(chunks.load(), 4u);
+        chunks = 0;
+        BOOST_TEST_THROWS(boost::flags::impl::parallel_chunks(boost::flags::execution::parallel(inline_executor, 4), 100, body), std::runtime_error);
+        BOOST_TEST_EQ(chunks.load(), 4u);
+    }
+}
+
+
+int main() {
+    report_config();
+    test_reductions();
+    test_known_values();
+    test_execution();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,143 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_scan
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/scan.hpp>
+#include <cstdint>
+#include <vector>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+    bit_3 = boost::flags::nth_bit(3), // == 0x08
+};
+
+// enable flags_enum
+BOOST_FLAGS_ENABLE(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+small_enum : unsigned char {
+    small_0 = boost::flags::nth_bit(0), // == 0x01
+    small_1 = boost::flags::nth_bit(1), // == 0x02
+};
+
+// enable small_enum
+BOOST_FLAGS_ENABLE(small_enum)
+
+
+// 64-byte record with the flags at a fixed offset
+struct record {
+    std::uint64_t id;
+    flags_enum flags;
+    small_enum small;
+    char payload[51];
+};
+
+flags_enum flags_of(std::size_t i) {
+    return boost::flags::from_underlying<flags_enum>(static_cast<unsigned int>(i * 7 % 16));
+}
+
+std::vector<record> make_records(std::size_t n) {
+    std::vector<record> records(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        records[i].id = i;
+        records[i].flags = flags_of(i);
+        records[i].small = (i % 3 == 0) ? small_enum::small_1 : small_enum::small_0;
+    }
+    return records;
+}
+
+
+void test_predicates() {
+    auto m = boost::flags::match(flags_enum::bit_0 | flags_enum::bit_1, flags_enum::bit_1);
+    BOOST_TEST(m(flags_enum::bit_1));
+    BOOST_TEST(m(flags_enum::bit_1 | flags_enum::bit_2));
+    BOOST_TEST(!m(flags_enum::bit_0 | flags_enum::bit_1));
+    BOOST_TEST(!m(flags_enum::bit_2));
+
+    auto all = boost::flags::match_all(flags_enum::bit_0 | flags_enum::bit_3);
+    BOOST_TEST(all(flags_enum::bit_0 | flags_enum::bit_3));
+    BOOST_TEST(!all(flags_enum::bit_0));
+
+    auto none = boost::flags::match_none(flags_enum::bit_0 | flags_enum::bit_3);
+    BOOST_TEST(none(flags_enum::bit_1));
+    BOOST_TEST(!none(flags_enum::bit_3));
+}
+
+
+void test_selection() {
+    // sizes not multiple of the block size
+    for (std::size_t n : { std::size_t(0), std::size_t(1), std::size_t(63), std::size_t(64), std::size_t(130), std::size_t(1000) }) {
+        auto records = make_records(n);
+        auto pred = boost::flags::match(flags_enum::bit_0 | flags_enum::bit_2, flags_enum::bit_2);
+
+        std::vector<std::uint32_t> expected;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (pred(records[i].flags)) {
+                expected.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        std::vector<std::uint32_t> selection(n);
+        std::size_t count = boost::flags::scan_member<&record::flags>(records, pred, selection.data());
+        selection.resize(count);
+        BOOST_TEST_ALL_EQ(selection.begin(), selection.end(), expected.begin(), expected.end());
+
+        // arbitrary callables
+        std::vector<std::size_t> selection_lambda(n);
+        count = boost::flags::scan_member<&record::flags>(records.data(), records.size(),
+            [](flags_enum e) { return boost::flags::any(e & flags_enum::bit_2) && !(e & flags_enum::bit_0); },
+            selection_lambda.data());
+        BOOST_TEST_EQ(count, expected.size());
+        for (std::size_t i = 0; i < count && i < expected.size(); ++i) {
+            BOOST_TEST_EQ(selection_lambda[i], expected[i]);
+        }
+    }
+}
+
+
+void test_bitmap() {
+    std::size_t const n = 200;
+    auto records = make_records(n);
+
+    std::vector<std::uint64_t> bitmap((n + 63) / 64);
+    std::size_t count = boost::flags::scan_member_bitmap<&record::small>(records, boost::flags::match_all(small_enum::small_1), bitmap.data());
+
+    std::size_t expected_count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        bool const expected = (i % 3 == 0);
+        expected_count += expected;
+        BOOST_TEST_EQ(((bitmap[i / 64] >> (i % 64)) & 1) != 0, expected);
+    }
+    BOOST_TEST_EQ(count, expected_count);
+}
+
+
+int main() {
+    report_config();
+    test_predicates();
+    test_selection();
+    test_bitmap();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,194 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_series
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/series.hpp>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_5 = boost::flags::nth_bit(5), // == 0x20
+};
+
+// enable flags_enum
+BOOST_FLAGS(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+byte_enum : unsigned char {
+    byte_0 = boost::flags::nth_bit(0), // == 0x01
+    byte_7 = boost::flags::nth_bit(7), // == 0x80
+};
+
+// enable byte_enum
+BOOST_FLAGS_ENABLE(byte_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+wide_enum : std::uint64_t {
+    wide_0 = boost::flags::nth_bit(0), // == 0x01
+    wide_63 = boost::flags::nth_bit<std::uint64_t>(63),
+};
+
+// enable wide_enum
+BOOST_FLAGS_ENABLE(wide_enum)
+
+
+// a random walk: every `stride`-th step (on average) toggles a random bit, stride 1 changes every value
+template<typename E>
+std::vector<E> make_series(std::size_t n, std::size_t stride) {
+    using U = typename std::underlying_type<E>::type;
+    std::vector<E> values(n);
+    std::uint64_t state = 12345;
+    U v = static_cast<U>(0x5a5a5a5a5a5a5a5aull);
+    for (std::size_t i = 0; i < n; ++i) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        if (stride == 1) {
+            v = static_cast<U>(state >> 11);
+        } else if ((state >> 20) % stride == 0) {
+            v = static_cast<U>(v ^ (U(1) << ((state >> 3) % (8 * sizeof(U)))));
+        }
+        values[i] = static_cast<E>(v);
+    }
+    return values;
+}
+
+template<typename E>
+std::string write_series(std::vector<E> const& values, std::size_t interval) {
+    std::ostringstream out(std::ios::binary);
+    boost::flags::series_writer<E> writer(out, interval);
+    // mixed single values and batches
+    std::size_t const head = values.size() / 3;
+    for (std::size_t i = 0; i < head; ++i) {
+        writer.push(values[i]);
+    }
+    writer.write(values.data() + head, values.size() - head);
+    BOOST_TEST_EQ(writer.size(), values.size());
+    writer.close();
+    return out.str();
+}
+
+template<typename E>
+void check_series(std::size_t n, std::size_t stride, std::size_t interval) {
+    std::vector<E> const values = make_series<E>(n, stride);
+    std::istringstream in(write_series(values, interval), std::ios::binary);
+    boost::flags::series_reader<E> reader(in);
+    BOOST_TEST_EQ(reader.size(), n);
+    BOOST_TEST_EQ(reader.checkpoint_interval(), interval);
+    BOOST_TEST(reader.read_all() == values);
+
+    // random access across the checkpoints
+    for (std::size_t i = 0; i < n; i += 1 + n / 17) {
+        BOOST_TEST(reader.at(i) == values[i]);
+    }
+    if (n > 10) {
+        std::vector<E> part(n / 2);
+        reader.read(n / 3, part);
+        BOOST_TEST(std::equal(part.begin(), part.end(), values.begin() + static_cast<std::ptrdiff_t>(n / 3)));
+    }
+    BOOST_TEST_THROWS((void)reader.at(n), std::out_of_range);
+}
+
+void test_round_trip() {
+    for (std::size_t n : { 0, 1, 2, 9, 100, 5000 }) {
+        for (std::size_t stride : { 1, 3, 50, 100000 }) {
+            for (std::size_t interval : { 1, 7, 4096 }) {
+                check_series<flags_enum>(n, stride, interval);
+                check_series<byte_enum>(n, stride, interval);
+                check_series<wide_enum>(n, stride, interval);
+            }
+        }
+    }
+}
+
+void test_compression() {
+    // on average one change per 100 values
+    std::vector<flags_enum> const values = make_series<flags_enum>(100000, 100);
+    std::string const bytes = write_series(values, 4096);
+    BOOST_TEST_LT(bytes.size() * 50, values.size() * sizeof(flags_enum));
+
+    // constant values
+    std::vector<wide_enum> const constant(100000, wide_enum::wide_0 | wide_enum::wide_63);
+    BOOST_TEST_LT(write_series(constant, 4096).size() * 1000, constant.size() * sizeof(wide_enum));
+}
+
+void test_errors() {
+    std::vector<flags_enum> const values = make_series<flags_enum>(1000, 10);
+    std::string const bytes = write_series(values, 64);
+
+    // different value size
+    {
+        std::istringstream in(bytes, std::ios::binary);
+        BOOST_TEST_THROWS(boost::flags::series_reader<byte_enum> reader(in), std::runtime_error);
+    }
+    // not a series
+    {
+        std::istringstream in("BFLT" + bytes.substr(4), std::ios::binary);
+        BOOST_TEST_THROWS(boost::flags::series_reader<flags_enum> reader(in), std::runtime_error);
+    }
+    // truncated
+    {
+        std::istringstream in(bytes.substr(0, bytes.size() - 5), std::ios::binary);
+        BOOST_TEST_THROWS(boost::flags::series_reader<flags_enum> reader(in), std::runtime_error);
+    }
+    // corrupted block
+    {
+        std::string corrupted = bytes;
+        corrupted[20] = char(0xff);
+        std::istringstream in(corrupted, std::ios::binary);
+        boost::flags::series_reader<flags_enum> reader(in);
+        BOOST_TEST_THROWS((void)reader.read_all(), std::runtime_error);
+        // the other blocks are still readable
+        BOOST_TEST(reader.at(999) == values[999]);
+    }
+    // block lengths exceeding the block (the length of the first block is stored at offset 16)
+    std::uint32_t length = 0;
+    for (std::size_t k = 0; k < 4; ++k) {
+        length |= std::uint32_t(static_cast<unsigned char>(bytes[16 + k])) << (8 * k);
+    }
+    for (std::uint32_t invalid : { length + 1, 0xfffffff0u }) {
+        std::string corrupted = bytes;
+        for (std::size_t k = 0; k < 4; ++k) {
+            corrupted[16 + k] = char((invalid >> (8 * k)) & 0xff);
+        }
+        std::istringstream in(corrupted, std::ios::binary);
+        boost::flags::series_reader<flags_enum> reader(in);
+        BOOST_TEST_THROWS((void)reader.at(0), std::runtime_error);
+        BOOST_TEST(reader.at(999) == values[999]);
+    }
+}
+
+
+int main() {
+    test_round_trip();
+    test_compression();
+    test_errors();
+
+    return boost::report_errors();
+}
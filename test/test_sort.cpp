@@ -0,0 +1,159 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_sort
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/sort.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "include_test_post.hpp"
+#include "include_test_values.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+};
+
+// enable flags_enum
+BOOST_FLAGS_ENABLE(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+sparse_enum : unsigned short {
+    sparse_2 = boost::flags::nth_bit(2),
+    sparse_5 = boost::flags::nth_bit(5),
+    sparse_11 = boost::flags::nth_bit(11),
+};
+
+// enable sparse_enum
+BOOST_FLAGS_ENABLE(sparse_enum)
+
+// restrict the domain to the three enumerators
+constexpr sparse_enum boost_flags_domain(sparse_enum) {
+    return sparse_enum::sparse_2 | sparse_enum::sparse_5 | sparse_enum::sparse_11;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+signed_enum : int {
+    signed_0 = boost::flags::nth_bit(0), // == 0x01
+};
+
+// enable signed_enum
+BOOST_FLAGS_ENABLE(signed_enum)
+
+
+struct record {
+    sparse_enum flags;
+    std::size_t id;
+};
+
+
+template<typename E>
+void check_sort(std::vector<E> values) {
+    auto expected = values;
+    std::stable_sort(expected.begin(), expected.end(), boost::flags::total_order);
+    boost::flags::radix_sort_by_flags(values);
+    BOOST_TEST(values == expected);
+}
+
+void test_sort_values() {
+    for (std::size_t n : { 0, 1, 2, 100, 1000, 5000 }) {
+        check_sort(make_values<flags_enum>(n, 4711, 0xffffffffu));
+        check_sort(make_values<flags_enum>(n, 4711, 0x3u));
+        check_sort(make_values<flags_enum>(n, 4711, 0x00ff0000u));
+        check_sort(make_values<sparse_enum>(n, 4711, 0x0824u));
+        check_sort(make_values<signed_enum>(n, 4711, 0xffffffffu));
+        check_sort(make_values<signed_enum>(n, 4711, 0x8000000fu));
+    }
+}
+
+
+void test_stable_projection() {
+    auto const flags = make_values<sparse_enum>(2000, 4711, 0x0824u);
+    std::vector<record> records;
+    for (std::size_t i = 0; i < flags.size(); ++i) {
+        records.push_back({ flags[i], i });
+    }
+
+    auto expected = records;
+    std::stable_sort(expected.begin(), expected.end(), [](record const& a, record const& b) {
+        return boost::flags::total_order(a.flags, b.flags);
+    });
+
+    auto sorted = records;
+    boost::flags::radix_sort_by_flags(sorted, &record::flags);
+    BOOST_TEST_EQ(sorted.size(), expected.size());
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        BOOST_TEST(sorted[i].flags == expected[i].flags);
+        BOOST_TEST_EQ(sorted[i].id, expected[i].id);
+    }
+
+    // lambda projection on iterators
+    sorted = records;
+    boost::flags::radix_sort_by_flags(sorted.begin(), sorted.end(), [](record const& r) { return r.flags; });
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        BOOST_TEST_EQ(sorted[i].id, expected[i].id);
+    }
+}
+
+
+void test_group_by() {
+    std::vector<std::pair<flags_enum, std::string>> items = {
+        { flags_enum::bit_1, "a" },
+        { flags_enum::bit_0, "b" },
+        { flags_enum::bit_1, "c" },
+        { flags_enum::bit_0 | flags_enum::bit_1, "d" },
+        { flags_enum::bit_0, "e" },
+    };
+
+    auto const groups = boost::flags::group_by_flags(items, [](auto const& item) { return item.first; });
+    BOOST_TEST_EQ(groups.size(), 3u);
+    if (groups.size() == 3) {
+        BOOST_TEST(groups[0].value == flags_enum::bit_0);
+        BOOST_TEST_EQ(groups[0].last - groups[0].first, 2);
+        BOOST_TEST_EQ(groups[0].first->second, "b");
+        BOOST_TEST_EQ((groups[0].first + 1)->second, "e");
+
+        BOOST_TEST(groups[1].value == flags_enum::bit_1);
+        BOOST_TEST_EQ(groups[1].first->second, "a");
+        BOOST_TEST_EQ((groups[1].first + 1)->second, "c");
+
+        BOOST_TEST(groups[2].value == (flags_enum::bit_0 | flags_enum::bit_1));
+        BOOST_TEST(groups[2].last == items.end());
+    }
+
+    std::vector<flags_enum> empty;
+    BOOST_TEST(boost::flags::group_by_flags(empty).empty());
+}
+
+
+int main() {
+    report_config();
+    test_sort_values();
+    test_stable_projection();
+    test_group_by();
+
+    return boost::report_errors();
+}
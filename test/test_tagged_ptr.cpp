@@ -0,0 +1,234 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_tagged_ptr
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/tagged_ptr.hpp>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+node_flags : unsigned char {
+    marked = boost::flags::nth_bit(0), // == 0x01
+    dirty = boost::flags::nth_bit(1), // == 0x02
+    leaf = boost::flags::nth_bit(2), // == 0x04
+};
+
+BOOST_FLAGS(node_flags)
+
+constexpr node_flags boost_flags_domain(node_flags) {
+    return node_flags::marked | node_flags::dirty | node_flags::leaf;
+}
+
+
+// a node linking to other nodes: tagged_ptr<node, ...> is named while node is incomplete
+struct node {
+    boost::flags::tagged_ptr<node, node_flags> next;
+    std::uint64_t value = 0;
+};
+
+static_assert(sizeof(boost::flags::tagged_ptr<node, node_flags>) == sizeof(node*), "");
+static_assert(sizeof(node) == 16, "");
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+wide_flags : unsigned int {
+    w_0 = boost::flags::nth_bit(0), // == 0x01
+    w_4 = boost::flags::nth_bit(4), // == 0x10
+};
+
+BOOST_FLAGS(wide_flags)
+
+constexpr wide_flags boost_flags_domain(wide_flags) {
+    return wide_flags::w_0 | wide_flags::w_4;
+}
+
+
+void test_tag_operators() {
+    node n1, n2;
+    boost::flags::tagged_ptr<node, node_flags> p(&n1, node_flags::dirty);
+    BOOST_TEST(p.get() == &n1);
+    BOOST_TEST(p.tag() == node_flags::dirty);
+    BOOST_TEST(static_cast<bool>(p));
+    BOOST_TEST_EQ(p.tag_mask(), 7u);
+
+    p |= node_flags::marked;
+    BOOST_TEST(p.tag() == (node_flags::marked | node_flags::dirty));
+    BOOST_TEST(p.get() == &n1);
+
+    p &= ~node_flags::dirty;
+    BOOST_TEST(p.tag() == node_flags::marked);
+
+    p ^= node_flags::leaf | node_flags::marked;
+    BOOST_TEST(p.tag() == node_flags::leaf);
+
+    p &= node_flags::dirty;
+    BOOST_TEST(p.tag() == node_flags{});
+    BOOST_TEST(p.get() == &n1);
+
+    p.modify_tag(node_flags::dirty | node_flags::leaf, true);
+    BOOST_TEST(p.tag() == (node_flags::dirty | node_flags::leaf));
+    p.modify_tag(node_flags::dirty, false);
+    BOOST_TEST(p.tag() == node_flags::leaf);
+
+    // the flag tests work on the tag
+    BOOST_TEST(boost::flags::any(p.tag() & node_flags::leaf));
+    BOOST_TEST(boost::flags::disjoint(p.tag(), node_flags::marked | node_flags::dirty));
+
+    p.set_pointer(&n2);
+    BOOST_TEST(p.get() == &n2);
+    BOOST_TEST(p.tag() == node_flags::leaf);
+    p.set_tag(node_flags::marked);
+    BOOST_TEST(p.get() == &n2);
+    BOOST_TEST(p.tag() == node_flags::marked);
+    BOOST_TEST(&p->value == &n2.value);
+    BOOST_TEST(&*p == &n2);
+
+    // values outside of the domain don't touch the pointer
+    p |= static_cast<node_flags>(0xf8);
+    BOOST_TEST(p.get() == &n2);
+    BOOST_TEST(p.tag() == node_flags::marked);
+
+    // a null pointer with a tag
+    boost::flags::tagged_ptr<node, node_flags> q(nullptr);
+    BOOST_TEST(!q);
+    q.set_tag(node_flags::leaf);
+    BOOST_TEST(!q);
+    BOOST_TEST(q.get() == nullptr);
+    BOOST_TEST(q.tag() == node_flags::leaf);
+
+    q.reset(&n2, node_flags::marked);
+    BOOST_TEST(q == p);
+    q.reset();
+    BOOST_TEST(q != p);
+    BOOST_TEST_EQ(q.to_bits(), 0u);
+    BOOST_TEST(decltype(p)::from_bits(p.to_bits()) == p);
+}
+
+
+void test_alignment() {
+    // over-aligned allocations provide more tag bits
+    using ptr = boost::flags::tagged_ptr<char, wide_flags, 32>;
+    BOOST_TEST_EQ(ptr::alignment(), 32u);
+    alignas(32) char buffer[32];
+    ptr p(buffer, wide_flags::w_4);
+    BOOST_TEST(p.get() == buffer);
+    BOOST_TEST(p.tag() == wide_flags::w_4);
+    p ^= wide_flags::w_0;
+    BOOST_TEST(p.tag() == (wide_flags::w_0 | wide_flags::w_4));
+
+#ifdef TEST_COMPILE_FAIL_TAGGED_PTR
+    // the domain of wide_flags doesn't fit into the 3 low bits of an std::uint64_t*
+    std::uint64_t u = 0;
+    boost::flags::tagged_ptr<std::uint64_t, wide_flags> too_small(&u);
+    BOOST_TEST(too_small.get() == &u);
+#endif // TEST_COMPILE_FAIL_TAGGED_PTR
+}
+
+
+void test_linked_nodes() {
+    std::vector<std::unique_ptr<node>> nodes;
+    for (int i = 0; i < 10; ++i) {
+        nodes.push_back(std::make_unique<node>());
+        nodes.back()->value = static_cast<std::uint64_t>(i);
+        if (i > 0) {
+            nodes[i - 1]->next.reset(nodes[i].get(), i % 2 ? node_flags::dirty : node_flags::leaf);
+        }
+    }
+
+    std::uint64_t sum = 0;
+    int dirty = 0;
+    for (node* n = nodes.front().get(); n; n = n->next.get()) {
+        sum += n->value;
+        dirty += boost::flags::any(n->next.tag() & node_flags::dirty);
+    }
+    BOOST_TEST_EQ(sum, 45u);
+    BOOST_TEST_EQ(dirty, 5);
+}
+
+
+void test_atomic() {
+    node n1, n2;
+    using ptr = boost::flags::tagged_ptr<node, node_flags>;
+    boost::flags::atomic_tagged_ptr<node, node_flags> a{ ptr(&n1) };
+    BOOST_TEST(a.is_lock_free());
+
+    ptr const old = a.fetch_or_tag(node_flags::marked);
+    BOOST_TEST(old.tag() == node_flags{});
+    BOOST_TEST(a.load().tag() == node_flags::marked);
+    BOOST_TEST(a.load().get() == &n1);
+
+    BOOST_TEST(a.fetch_xor_tag(node_flags::leaf).tag() == node_flags::marked);
+    BOOST_TEST(a.fetch_and_tag(~node_flags::marked).tag() == (node_flags::marked | node_flags::leaf));
+    BOOST_TEST(a.load().tag() == node_flags::leaf);
+    (void)a.fetch_and_tag(node_flags::dirty);
+    BOOST_TEST(a.load() == ptr(&n1));
+
+    // a marked pointer is not replaced
+    ptr expected(&n1, node_flags::marked);
+    BOOST_TEST(!a.compare_exchange_strong(expected, ptr(&n2)));
+    BOOST_TEST(expected == ptr(&n1));
+    BOOST_TEST(a.compare_exchange_strong(expected, ptr(&n2, node_flags::dirty)));
+    BOOST_TEST(a.load() == ptr(&n2, node_flags::dirty));
+
+    BOOST_TEST(a.exchange(ptr(&n1)) == ptr(&n2, node_flags::dirty));
+    a.store(ptr(nullptr));
+    BOOST_TEST(!a.load());
+}
+
+
+void test_atomic_threads() {
+    node n;
+    using ptr = boost::flags::tagged_ptr<node, node_flags>;
+    boost::flags::atomic_tagged_ptr<node, node_flags> a{ ptr(&n) };
+
+    // concurrent toggling of different tag bits, every bit is toggled an even number of times
+    auto toggle = [&a](node_flags bit) {
+        for (int i = 0; i < 10000; ++i) {
+            (void)a.fetch_xor_tag(bit);
+        }
+    };
+    // concurrent compare-exchange loops setting and clearing `dirty`
+    auto cas = [&a] {
+        for (int i = 0; i < 10000; ++i) {
+            ptr expected = a.load();
+            while (!a.compare_exchange_weak(expected, ptr(expected.get(), expected.tag() ^ node_flags::dirty))) {
+            }
+        }
+    };
+    std::thread t1(toggle, node_flags::marked), t2(toggle, node_flags::leaf), t3(cas);
+    t1.join();
+    t2.join();
+    t3.join();
+
+    BOOST_TEST(a.load() == ptr(&n));
+}
+
+
+int main() {
+    test_tag_operators();
+    test_alignment();
+    test_linked_nodes();
+    test_atomic();
+    test_atomic_threads();
+
+    return boost::report_errors();
+}
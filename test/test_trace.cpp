@@ -0,0 +1,245 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// tracing of flag changes (requires C++20)
+
+#define TEST_NAMESPACE test_trace
+#include "include_test.hpp"
+
+#define BOOST_FLAGS_TRACE_CAPACITY 16
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/trace.hpp>
+
+#include <sstream>
+#include <thread>
+
+#include "include_test_post.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_2 = boost::flags::nth_bit(2), // == 0x04
+};
+
+BOOST_FLAGS(flags_enum)
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+small_enum : unsigned char {
+    s_0 = boost::flags::nth_bit(0), // == 0x01
+    s_7 = boost::flags::nth_bit(7), // == 0x80
+};
+
+// enable small_enum with disabled complement
+BOOST_FLAGS(small_enum, BOOST_FLAGS_DISABLE_COMPLEMENT)
+
+
+using boost::flags::trace::event_record;
+
+void test_operators() {
+    boost::flags::trace::reset();
+
+    boost::flags::traced_flags<flags_enum> t;
+    std::uint32_t const line = __LINE__ + 1;
+    t |= flags_enum::bit_0 | flags_enum::bit_2;
+    t &= ~flags_enum::bit_0;
+    t ^= flags_enum::bit_1;
+    t = flags_enum::bit_0;
+    t.modify_inplace(flags_enum::bit_1, true);
+    boost::flags::modify_inplace(t, flags_enum::bit_0, false);
+    t &= flags_enum::bit_1;
+
+    BOOST_TEST(t.value() == flags_enum::bit_1);
+    BOOST_TEST(t == flags_enum::bit_1);
+
+    auto const records = boost::flags::trace::snapshot();
+    BOOST_TEST_EQ(records.size(), 7u);
+    std::uint64_t const expected[][2] = { {0, 5}, {5, 4}, {4, 6}, {6, 1}, {1, 3}, {3, 2}, {2, 2} };
+    for (std::size_t i = 0; i < std::min<std::size_t>(records.size(), 7); ++i) {
+        event_record const& r = records[i];
+        BOOST_TEST_EQ(r.old_value, expected[i][0]);
+        BOOST_TEST_EQ(r.new_value, expected[i][1]);
+        BOOST_TEST_EQ(r.line, line + i);
+        BOOST_TEST_EQ(r.object, reinterpret_cast<std::uintptr_t>(&t));
+        BOOST_TEST(r.file.find("test_trace.cpp") != std::string::npos);
+        BOOST_TEST(r.function.find("test_operators") != std::string::npos);
+        if (i > 0) {
+            BOOST_TEST(records[i - 1].timestamp <= r.timestamp);
+        }
+    }
+    if (records.size() == 7) {
+        BOOST_TEST_EQ(records[1].changed(), 1u);
+        BOOST_TEST_EQ(records[6].changed(), 0u);
+    }
+
+    // copies are not recorded
+    boost::flags::traced_flags<flags_enum> copy = t;
+    copy = t;
+    BOOST_TEST_EQ(boost::flags::trace::snapshot().size(), 7u);
+
+    boost::flags::trace::reset();
+    BOOST_TEST(boost::flags::trace::snapshot().empty());
+}
+
+
+void test_disabled_complement() {
+    boost::flags::trace::reset();
+
+    boost::flags::traced_flags<small_enum> t(small_enum::s_0 | small_enum::s_7);
+    t &= ~small_enum::s_7;
+    BOOST_TEST(t == small_enum::s_0);
+
+    auto const records = boost::flags::trace::snapshot();
+    BOOST_TEST_EQ(records.size(), 1u);
+    if (records.size() == 1) {
+        BOOST_TEST_EQ(records[0].old_value, 0x81u);
+        BOOST_TEST_EQ(records[0].new_value, 0x01u);
+    }
+}
+
+
+void test_ring() {
+    boost::flags::trace::reset();
+
+    // only the last BOOST_FLAGS_TRACE_CAPACITY events are kept
+    boost::flags::traced_flags<flags_enum> t;
+    for (unsigned int i = 0; i < 40; ++i) {
+        t = boost::flags::from_underlying<flags_enum>(i % 8);
+    }
+    auto const records = boost::flags::trace::snapshot();
+    BOOST_TEST_EQ(records.size(), boost::flags::trace::capacity);
+    if (!records.empty()) {
+        BOOST_TEST_EQ(records.front().new_value, (40u - boost::flags::trace::capacity) % 8);
+        BOOST_TEST_EQ(records.back().new_value, 39u % 8);
+    }
+}
+
+
+void test_threads() {
+    boost::flags::trace::reset();
+
+    auto body = [] {
+        boost::flags::traced_flags<flags_enum> t;
+        for (int i = 0; i < 5; ++i) {
+            t ^= flags_enum::bit_2;
+        }
+    };
+    std::thread t1(body), t2(body);
+    t1.join();
+    t2.join();
+    body();
+
+    // the events of finished threads are collected
+    auto const records = boost::flags::trace::snapshot();
+    BOOST_TEST_EQ(records.size(), 15u);
+    std::size_t threads[3] = {};
+    std::uint32_t ids[3] = {};
+    std::size_t distinct = 0;
+    for (event_record const& r : records) {
+        std::size_t k = 0;
+        while (k < distinct && ids[k] != r.thread) {
+            ++k;
+        }
+        if (k == distinct && distinct < 3) {
+            ids[distinct++] = r.thread;
+        }
+        if (k < 3) {
+            ++threads[k];
+        }
+    }
+    BOOST_TEST_EQ(distinct, 3u);
+    BOOST_TEST_EQ(threads[0], 5u);
+    BOOST_TEST_EQ(threads[1], 5u);
+    BOOST_TEST_EQ(threads[2], 5u);
+}
+
+
+void test_export() {
+    boost::flags::trace::reset();
+    boost::flags::traced_flags<flags_enum> t;
+    for (int i = 0; i < 4; ++i) {
+        t |= flags_enum::bit_0;
+        t &= ~flags_enum::bit_0;
+    }
+    auto const records = boost::flags::trace::snapshot();
+
+    std::stringstream trace;
+    boost::flags::trace::write_trace(trace, records);
+    auto const read = boost::flags::trace::read_trace(trace);
+    BOOST_TEST_EQ(read.size(), records.size());
+    for (std::size_t i = 0; i < std::min(read.size(), records.size()); ++i) {
+        BOOST_TEST_EQ(read[i].timestamp, records[i].timestamp);
+        BOOST_TEST_EQ(read[i].object, records[i].object);
+        BOOST_TEST_EQ(read[i].old_value, records[i].old_value);
+        BOOST_TEST_EQ(read[i].new_value, records[i].new_value);
+        BOOST_TEST_EQ(read[i].file, records[i].file);
+        BOOST_TEST_EQ(read[i].function, records[i].function);
+        BOOST_TEST_EQ(read[i].line, records[i].line);
+        BOOST_TEST_EQ(read[i].column, records[i].column);
+        BOOST_TEST_EQ(read[i].thread, records[i].thread);
+    }
+
+    // sites are stored once
+    BOOST_TEST(trace.str().size() < records.size() * 48 + 1024);
+
+    std::ostringstream dump;
+    boost::flags::trace::dump_trace(dump, read);
+    BOOST_TEST(dump.str().find("test_trace.cpp") != std::string::npos);
+
+    // malformed traces
+    std::istringstream garbage("not a trace");
+    BOOST_TEST_THROWS(boost::flags::trace::read_trace(garbage), std::runtime_error);
+    std::string truncated = trace.str();
+    truncated.resize(truncated.size() - 1);
+    std::istringstream truncated_trace(truncated);
+    BOOST_TEST_THROWS(boost::flags::trace::read_trace(truncated_trace), std::runtime_error);
+    // huge counts of sites resp. events are not allocated up front
+    std::string const header = trace.str().substr(0, 8);
+    std::istringstream huge_sites(header + std::string(4, '\0') + "\xff\xff\xff\xff");
+    BOOST_TEST_THROWS(boost::flags::trace::read_trace(huge_sites), std::runtime_error);
+    std::istringstream huge_events(header + std::string(8, '\0') + std::string(8, '\xff'));
+    BOOST_TEST_THROWS(boost::flags::trace::read_trace(huge_events), std::runtime_error);
+}
+
+
+constexpr flags_enum constexpr_changes() {
+    boost::flags::traced_flags<flags_enum> t;
+    t |= flags_enum::bit_1;
+    t.modify_inplace(flags_enum::bit_2, true);
+    return t;
+}
+
+void test_constexpr() {
+    boost::flags::trace::reset();
+
+    // constant expressions are not recorded
+    constexpr flags_enum e = constexpr_changes();
+    static_assert(e == (flags_enum::bit_1 | flags_enum::bit_2), "");
+    BOOST_TEST(boost::flags::trace::snapshot().empty());
+}
+
+
+int main() {
+    test_operators();
+    test_disabled_complement();
+    test_ring();
+    test_threads();
+    test_export();
+    test_constexpr();
+
+    return boost::report_errors();
+}
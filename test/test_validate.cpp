@@ -0,0 +1,193 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+#define TEST_NAMESPACE test_validate
+#include "include_test.hpp"
+
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/flags/validate.hpp>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "include_test_post.hpp"
+#include "include_test_values.hpp"
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+flags_enum : unsigned int {
+    bit_0 = boost::flags::nth_bit(0), // == 0x01
+    bit_1 = boost::flags::nth_bit(1), // == 0x02
+    bit_5 = boost::flags::nth_bit(5), // == 0x20
+};
+
+// enable flags_enum with masking
+BOOST_FLAGS(flags_enum, BOOST_FLAGS_CHECK_MASK)
+
+constexpr flags_enum boost_flags_domain(flags_enum) {
+    return flags_enum::bit_0 | flags_enum::bit_1 | flags_enum::bit_5;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+byte_enum : unsigned char {
+    byte_0 = boost::flags::nth_bit(0), // == 0x01
+    byte_6 = boost::flags::nth_bit(6), // == 0x40
+};
+
+// enable byte_enum
+BOOST_FLAGS_ENABLE(byte_enum)
+
+constexpr byte_enum boost_flags_domain(byte_enum) {
+    return byte_enum::byte_0 | byte_enum::byte_6;
+}
+
+
+enum
+#ifndef TEST_COMPILE_UNSCOPED
+    class
+#endif // TEST_COMPILE_UNSCOPED
+wide_enum : std::uint64_t {
+    wide_0 = boost::flags::nth_bit(0), // == 0x01
+    wide_63 = boost::flags::nth_bit<std::uint64_t>(63),
+};
+
+// enable wide_enum
+BOOST_FLAGS_ENABLE(wide_enum)
+
+constexpr wide_enum boost_flags_domain(wide_enum) {
+    return wide_enum::wide_0 | wide_enum::wide_63;
+}
+
+
+// the range overloads only accept contiguous ranges
+template<typename... Args>
+struct has_validate {
+    template<typename... Ts>
+    static auto check(int) -> decltype(void(boost::flags::validate(std::declval<Ts const&>()...)), std::true_type{});
+    template<typename...>
+    static std::false_type check(...);
+
+    static constexpr bool value = decltype(check<Args...>(0))::value;
+};
+
+template<typename... Args>
+struct has_sanitize {
+    template<typename... Ts>
+    static auto check(int) -> decltype(void(boost::flags::sanitize(std::declval<Ts&>()...)), std::true_type{});
+    template<typename...>
+    static std::false_type check(...);
+
+    static constexpr bool value = decltype(check<Args...>(0))::value;
+};
+
+static_assert(has_validate<std::vector<flags_enum>>::value, "");
+static_assert(has_validate<boost::flags::execution::simd_t, std::vector<flags_enum>>::value, "");
+static_assert(has_validate<boost::flags::execution::simd_t, flags_enum const*, std::size_t>::value, "");
+static_assert(!has_validate<flags_enum const*, std::size_t>::value, "");
+static_assert(!has_validate<std::vector<flags_enum>, std::size_t>::value, "");
+static_assert(has_sanitize<std::vector<flags_enum>>::value, "");
+static_assert(!has_sanitize<flags_enum*, std::size_t>::value, "");
+
+
+// random values, every `stride`-th value with bits outside of the domain
+template<typename E>
+std::vector<E> make_invalid_values(std::size_t n, std::size_t stride) {
+    using U = typename std::underlying_type<E>::type;
+    constexpr U mask = static_cast<U>(boost::flags::domain_mask_v<E>);
+    std::vector<E> values = make_values<E>(n, 12345, mask);
+    for (std::size_t i = 0; stride != 0 && i < n; i += stride) {
+        values[i] = static_cast<E>(static_cast<U>(static_cast<U>(values[i]) | static_cast<U>(~mask)));
+    }
+    return values;
+}
+
+template<typename E>
+void check_range(std::size_t n, std::size_t stride) {
+    using U = typename std::underlying_type<E>::type;
+    constexpr U mask = static_cast<U>(boost::flags::domain_mask_v<E>);
+
+    std::vector<E> const values = make_invalid_values<E>(n, stride);
+    std::size_t expected_changed = 0;
+    std::vector<E> expected;
+    for (E v : values) {
+        expected_changed += (static_cast<U>(v) & ~mask) != 0;
+        expected.push_back(static_cast<E>(static_cast<U>(v) & mask));
+    }
+    bool const expected_valid = expected_changed == 0;
+
+    // executor running the tasks inline
+    auto inline_executor = [](std::function<void()> task) { task(); };
+
+    BOOST_TEST_EQ(boost::flags::validate(values), expected_valid);
+    BOOST_TEST_EQ(boost::flags::validate(boost::flags::execution::scalar, values), expected_valid);
+    BOOST_TEST_EQ(boost::flags::validate(boost::flags::execution::parallel(3), values), expected_valid);
+    BOOST_TEST_EQ(boost::flags::validate(boost::flags::execution::parallel(inline_executor, 5), values), expected_valid);
+
+    std::vector<E> v = values;
+    BOOST_TEST_EQ(boost::flags::sanitize(v), expected_changed);
+    BOOST_TEST(v == expected);
+    BOOST_TEST(boost::flags::validate(v));
+    BOOST_TEST_EQ(boost::flags::sanitize(v), 0u);
+
+    v = values;
+    BOOST_TEST_EQ(boost::flags::sanitize(boost::flags::execution::scalar, v), expected_changed);
+    BOOST_TEST(v == expected);
+
+    v = values;
+    BOOST_TEST_EQ(boost::flags::sanitize(boost::flags::execution::parallel(3), v), expected_changed);
+    BOOST_TEST(v == expected);
+
+    v = values;
+    BOOST_TEST_EQ(boost::flags::sanitize(boost::flags::execution::parallel(inline_executor, 7), v.data(), v.size()), expected_changed);
+    BOOST_TEST(v == expected);
+}
+
+void test_ranges() {
+    for (std::size_t n : { 0, 1, 5, 31, 32, 100, 257, 1000 }) {
+        for (std::size_t stride : { 0, 1, 3, 64, 999 }) {
+            check_range<flags_enum>(n, stride);
+            check_range<byte_enum>(n, stride);
+            check_range<wide_enum>(n, stride);
+        }
+    }
+}
+
+void test_known_values() {
+    std::vector<flags_enum> values(100, flags_enum::bit_0 | flags_enum::bit_5);
+    BOOST_TEST(boost::flags::validate(values));
+
+    // a single stray bit is detected
+    values[77] = static_cast<flags_enum>(0x21u | 0x400u);
+    BOOST_TEST(!boost::flags::validate(values));
+    BOOST_TEST(!boost::flags::validate(boost::flags::execution::simd, values.data() + 70, 10));
+    BOOST_TEST(boost::flags::validate(boost::flags::execution::simd, values.data(), 77));
+
+    BOOST_TEST_EQ(boost::flags::sanitize(values), 1u);
+    BOOST_TEST(values[77] == (flags_enum::bit_0 | flags_enum::bit_5));
+
+    // the sanitized values agree with options::check_mask
+    BOOST_TEST(values[77] == boost::flags::from_underlying<flags_enum>(0x21u | 0x400u));
+}
+
+
+int main() {
+    report_config();
+    test_ranges();
+    test_known_values();
+
+    return boost::report_errors();
+}
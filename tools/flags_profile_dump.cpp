@@ -0,0 +1,61 @@
+
+// Copyright 2024, 2025 Tobias Loew.
+//
+// Distributed under the Boost Software License, Version 1.0.
+//
+// See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt
+
+// prints the reports of the per-call-site profiling (BOOST_FLAGS_PROFILE, cf. <boost/flags/profile.hpp>)
+//
+// usage: flags_profile_dump <report>...
+//
+// the counters of multiple reports (e.g. of several processes) are added up per call site
+
+#include <boost/flags/profile.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <report>...\n";
+        return 2;
+    }
+
+    using boost::flags::profile::site_record;
+    std::map<std::tuple<std::string, std::uint32_t, std::uint32_t>, site_record> sites;
+    for (int i = 1; i < argc; ++i) {
+        std::ifstream in(argv[i], std::ios::binary);
+        if (!in) {
+            std::cerr << argv[0] << ": cannot open " << argv[i] << "\n";
+            return 1;
+        }
+        try {
+            for (site_record const& r : boost::flags::profile::read_report(in)) {
+                site_record& s = sites[std::make_tuple(r.file, r.line, r.column)];
+                if (s.file.empty()) {
+                    s = r;
+                } else {
+                    s.true_count += r.true_count;
+                    s.false_count += r.false_count;
+                }
+            }
+        }
+        catch (std::exception const& e) {
+            std::cerr << argv[0] << ": " << argv[i] << ": " << e.what() << "\n";
+            return 1;
+        }
+    }
+
+    std::vector<site_record> records;
+    for (auto const& site : sites) {
+        records.push_back(site.second);
+    }
+    boost::flags::profile::dump_report(std::cout, records);
+    return 0;
+}